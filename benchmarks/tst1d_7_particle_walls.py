@@ -0,0 +1,84 @@
+# ----------------------------------------------------------------------------------------
+#                     SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Hot plasma between two reflecting walls. Each one is doubled, a tenth of a cell
+# behind it, by a wall which suppresses the particles : as they are all reflected
+# by the first wall, no particle must be suppressed (Ukin_bnd remains zero,
+# check with: validation.py -b tst1d_7_particle_walls.py -s Ukin_bnd -p 1e-10).
+
+import math
+
+Te_keV = 1.              # electron temperature in keV
+Te  = Te_keV/511.        # Te normalised in mec^2 (code units)
+vth = math.sqrt(Te)      # normalised thermal velocity
+Ld    = vth              # Debye length in normalised units
+dx  = Ld/10.             # spatial resolution
+Lsim = 24.*Ld            # simulation length
+tsim = 50.               # duration of the simulation
+
+mi = 25.0                # ion mass (use reduced one to accelerate computation)
+
+xwall_west = 2.*Ld       # reflecting walls
+xwall_east = 22.*Ld
+dwall = 0.1*dx           # distance to the suppressing walls behind them
+
+
+Main(
+    geometry = "1d3v",
+
+    interpolation_order = 2,
+
+    timestep = 0.95*dx,
+    sim_time = tsim,
+
+    cell_length = [dx],
+    sim_length  = [Lsim],
+
+    number_of_patches = [ 8 ],
+
+    bc_em_type_x = ['silver-muller','silver-muller'] ,
+
+    random_seed = 0
+)
+
+Species(
+    species_type = 'ion',
+    initPosition_type = 'random',
+    initMomentum_type = 'maxwell-juettner',
+    n_part_per_cell = 10,
+    mass = mi,
+    charge = 1.0,
+    nb_density = trapezoidal(1., xvacuum=xwall_west+dx, xplateau=xwall_east-xwall_west-2.*dx),
+    temperature = [Te],
+    bc_part_type_west = 'supp',
+    bc_part_type_east = 'supp'
+)
+Species(
+    species_type = 'eon',
+    initPosition_type = 'random',
+    initMomentum_type = 'maxwell-juettner',
+    n_part_per_cell = 10,
+    mass = 1.0,
+    charge = -1.0,
+    nb_density = trapezoidal(1., xvacuum=xwall_west+dx, xplateau=xwall_east-xwall_west-2.*dx),
+    temperature = [Te],
+    bc_part_type_west = 'supp',
+    bc_part_type_east = 'supp'
+)
+
+# The reflecting walls come first : the suppressing walls are tested after the reflection
+PartWall( kind = "refl", x = xwall_west )
+PartWall( kind = "supp", x = xwall_west - dwall )
+PartWall( kind = "refl", x = xwall_east )
+PartWall( kind = "supp", x = xwall_east + dwall )
+
+
+every=100
+
+DiagScalar(every = every)
+
+DiagFields(
+    every = every,
+    fields = ['Ex','Rho_ion','Rho_eon']
+)
@@ -0,0 +1,82 @@
+# ----------------------------------------------------------------------------------------
+#                     SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Thermal expansion of a plasma slab filling the first sixth of the box, run on several
+# MPI processes: the patches are balanced from their measured computation times.
+# The patches move between processes but the physics must not change: the energies must
+# match those obtained with measured_cost = False, and no energy is injected
+# (reference generated on 2 processes, check with: validation.py -b tst1d_8_load_balancing.py -p 1e-8).
+# The min/max of the fields are not diagnosed: they are those of the master process,
+# which depend on the patch distribution.
+
+import math
+
+Te_keV = 1.              # electron temperature in keV
+Te  = Te_keV/511.        # Te normalised in mec^2 (code units)
+vth = math.sqrt(Te)      # normalised thermal velocity
+Ld    = vth              # Debye length in normalised units
+dx  = Ld/10.             # spatial resolution
+Lsim = 128.*Ld           # simulation length
+tsim = 50.               # duration of the simulation
+
+mi = 100.0               # ion mass (use reduced one to accelerate computation)
+
+
+Main(
+    geometry = "1d3v",
+
+    interpolation_order = 2,
+
+    timestep = 0.95*dx,
+    sim_time = tsim,
+
+    cell_length = [dx],
+    sim_length  = [Lsim],
+
+    number_of_patches = [ 32 ],
+
+    bc_em_type_x = ['silver-muller','silver-muller'] ,
+
+    random_seed = 0
+)
+
+LoadBalancing(
+    every = 20,
+    measured_cost = True
+)
+
+Species(
+    species_type = 'ion',
+    initPosition_type = 'regular',
+    initMomentum_type = 'mj',
+    n_part_per_cell = 50,
+    mass = mi,
+    charge = 1.0,
+    nb_density = trapezoidal(1., xplateau=20.*Ld),
+    temperature = [1.e-6],
+    thermT = [1.e-6],
+    thermVelocity = [0.,0.,0.],
+    bc_part_type_west = 'refl',
+    bc_part_type_east = 'refl'
+)
+Species(
+    species_type = 'eon',
+    initPosition_type = 'regular',
+    initMomentum_type = 'maxwell-juettner',
+    n_part_per_cell = 50,
+    mass = 1.0,
+    charge = -1.0,
+    nb_density = trapezoidal(1., xplateau=20.*Ld),
+    temperature = [Te],
+    thermT = [Te],
+    thermVelocity = [0.,0.,0.],
+    bc_part_type_west = 'refl',
+    bc_part_type_east = 'refl'
+)
+
+
+DiagScalar(
+    every = 100,
+    vars = ['Utot','Uexp','Ubal_norm','Uelm','Ukin','Ukin_ion','Ukin_eon','Ukin_bnd','Ukin_inj_mvw','Ntot_ion','Ntot_eon']
+)
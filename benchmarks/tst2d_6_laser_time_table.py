@@ -0,0 +1,63 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+#
+# Oblique gaussian laser with a python time envelope, tabulated with time_envelope_sampling.
+# The phase varies along the box side: the samples are shared by all the patches.
+# The interpolation error is ~1e-4 of the laser energy: with time_envelope_sampling = 0.
+# (python called at each point of the boundary), Uelm must stay within 0.05 of the reference
+# (check with: validation.py -b tst2d_6_laser_time_table.py -s Uelm -p 0.05).
+
+import math
+
+l0 = 2.0*math.pi		# laser wavelength
+t0 = l0					# optical cicle
+Lsim = [10.*l0,20.*l0]	# length of the simulation
+Tsim = 20.*t0			# duration of the simulation
+resx = 10.				# nb of cells in on laser wavelength
+rest = 30.				# time of timestep in one optical cycle
+Tlaser = 10.*t0			# duration of the laser pulse
+
+Main(
+    geometry = "2d3v",
+
+    interpolation_order = 2 ,
+
+    cell_length = [l0/resx,l0/resx],
+    sim_length  = Lsim,
+
+    number_of_patches = [ 4, 8 ],
+
+    timestep = t0/rest,
+    sim_time = Tsim,
+
+    bc_em_type_x = ['silver-muller'],
+    bc_em_type_y = ['silver-muller'],
+
+    random_seed = 0
+)
+
+# sin^2 envelope defined in python (not one of the built-in profiles)
+def sin2_envelope(t):
+    if t<0. or t>Tlaser: return 0.
+    return math.sin(math.pi*t/Tlaser)**2
+
+LaserGaussian2D(
+    a0              = 1.,
+    omega           = 1.,
+    focus           = [Lsim[0]/2., Lsim[1]/2.],
+    waist           = 5.*l0,
+    incidence_angle = 0.3,
+    time_envelope   = sin2_envelope,
+    time_envelope_sampling = t0/rest
+)
+
+
+globalEvery = int(rest)
+
+DiagScalar(every=globalEvery)
+
+DiagFields(
+    every = globalEvery,
+    fields = ['Ex','Ey','Ez']
+)
@@ -358,6 +358,8 @@ void Checkpoint::restartAll( VectorPatch &vecPatches, unsigned int &itime,  Smil
 void Checkpoint::restartPatch( ElectroMagn* EMfields,std::vector<Species*> &vecSpecies, Params& params, hid_t patch_gid )
 { 
     hid_t aid, gid, did, sid;
+    // momenta and weights are converted by HDF5 if the dump was written with another particle precision
+    hid_t particle_real_type = ( sizeof(particle_real)==sizeof(float) ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE );
     
     restartFieldsPerProc(patch_gid, EMfields->Ex_);
     restartFieldsPerProc(patch_gid, EMfields->Ey_);
@@ -415,12 +417,12 @@ void Checkpoint::restartPatch( ElectroMagn* EMfields,std::vector<Species*> &vecS
                 ostringstream namePos("");
                 namePos << "Momentum-" << i;
                 did = H5Dopen(gid, namePos.str().c_str(), H5P_DEFAULT);
-                H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &vecSpecies[ispec]->particles->Momentum[i][0]);
+                H5Dread(did, particle_real_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, &vecSpecies[ispec]->particles->Momentum[i][0]);
                 H5Dclose(did);
             }
             
             did = H5Dopen(gid, "Weight", H5P_DEFAULT);
-            H5Dread(did, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &vecSpecies[ispec]->particles->Weight[0]);
+            H5Dread(did, particle_real_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, &vecSpecies[ispec]->particles->Weight[0]);
             H5Dclose(did);
             
             did = H5Dopen(gid, "Charge", H5P_DEFAULT);
@@ -223,10 +223,12 @@ void DiagnosticParticles::run( Patch* patch, int timestep )
     std::vector<Species*>& vecSpecies = patch->vecSpecies;
     
     Species *s;
-    Particles *p;
+    const Particles *p;
     vector<int> index_array;
-    vector<double> *x, *y, *z, *px, *py, *pz, *w, *chi=NULL, axis_array, data_array;
-    vector<short> *q;
+    ArrayView<const double> x, y, z;
+    ArrayView<const particle_real> px, py, pz, w, chi;
+    vector<double> axis_array, data_array;
+    ArrayView<const short> q;
     int axissize, ind;
     double axismin, axismax, mass, coeff;
     unsigned int ipart, npart;
@@ -239,16 +241,18 @@ void DiagnosticParticles::run( Patch* patch, int timestep )
         // make shortcuts
         s    = vecSpecies[species[ispec]];  // current species
         p    = (s->particles);              // current particles array
-        x    = &(p->Position[0]);           // -+
-        y    = &(p->Position[1]);           //  |- position
-        z    = &(p->Position[2]);           // -+
-        px   = &(p->Momentum[0]);           // -+
-        py   = &(p->Momentum[1]);           //  |- momentum
-        pz   = &(p->Momentum[2]);           // -+
-        q    = &(p->Charge);                // charge
-        w    = &(p->Weight);                // weight
+        x    = p->position(0);              // -+
+        if (p->dimension()>1)               //  |
+            y = p->position(1);             //  |- position
+        if (p->dimension()>2)               //  |
+            z = p->position(2);             // -+
+        px   = p->momentum(0);              // -+
+        py   = p->momentum(1);              //  |- momentum
+        pz   = p->momentum(2);              // -+
+        q    = p->charge();                 // charge
+        w    = p->weight();                 // weight
         if (s->dynamics_type == "rrll")
-            chi  = &(p->Chi);               // chi (for rad reaction particles particles)
+            chi  = p->chi();                // chi (for rad reaction particles particles)
         mass = s->mass;       // mass
         npart = p->size();    // number of particles
         
@@ -271,67 +275,67 @@ void DiagnosticParticles::run( Patch* patch, int timestep )
             
             if      (axistype == "x"     )
                 for ( ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (*x)[ipart];
+                    axis_array[ipart] = x[ipart];
             
             else if (axistype == "y"     )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (*y)[ipart];
+                    axis_array[ipart] = y[ipart];
             
             else if (axistype == "z"     )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (*z)[ipart];
+                    axis_array[ipart] = z[ipart];
             
             else if (axistype == "px"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = mass * (*px)[ipart];
+                    axis_array[ipart] = mass * px[ipart];
             
             else if (axistype == "py"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = mass * (*py)[ipart];
+                    axis_array[ipart] = mass * py[ipart];
             
             else if (axistype == "pz"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = mass * (*pz)[ipart];
+                    axis_array[ipart] = mass * pz[ipart];
             
             else if (axistype == "p"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = mass * sqrt(pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2));
+                    axis_array[ipart] = mass * sqrt(pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2));
             
             else if (axistype == "gamma" )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = sqrt( 1. + pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2) );
+                    axis_array[ipart] = sqrt( 1. + pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2) );
             
             else if (axistype == "ekin" )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = mass * (sqrt( 1. + pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2) ) - 1.);
+                    axis_array[ipart] = mass * (sqrt( 1. + pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2) ) - 1.);
             
             else if (axistype == "vx"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (*px)[ipart] / sqrt( 1. + pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2) );
+                    axis_array[ipart] = px[ipart] / sqrt( 1. + pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2) );
             
             else if (axistype == "vy"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (*py)[ipart] / sqrt( 1. + pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2) );
+                    axis_array[ipart] = py[ipart] / sqrt( 1. + pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2) );
             
             else if (axistype == "vz"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (*pz)[ipart] / sqrt( 1. + pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2) );
+                    axis_array[ipart] = pz[ipart] / sqrt( 1. + pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2) );
                     
             else if (axistype == "v"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = pow( 1. + 1./(pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2)) , -0.5);
+                    axis_array[ipart] = pow( 1. + 1./(pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2)) , -0.5);
             
             else if (axistype == "vperp2"    )
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (pow((*py)[ipart],2) + pow((*pz)[ipart],2)) / (1. + pow((*px)[ipart],2) + pow((*py)[ipart],2) + pow((*pz)[ipart],2) );
+                    axis_array[ipart] = (pow(py[ipart],2) + pow(pz[ipart],2)) / (1. + pow(px[ipart],2) + pow(py[ipart],2) + pow(pz[ipart],2) );
             
             else if (axistype == "charge")
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (double) (*q)[ipart];
+                    axis_array[ipart] = (double) q[ipart];
             
             else if (axistype == "chi")
                 for (ipart = 0 ; ipart < npart ; ipart++)
-                    axis_array[ipart] = (double) (*chi)[ipart];
+                    axis_array[ipart] = (double) chi[ipart];
             
             else   ERROR("In particle diagnostics, axis `" << axistype << "` unknown");
             
@@ -395,67 +399,67 @@ void DiagnosticParticles::run( Patch* patch, int timestep )
         // ------------------------------
         if      (output == "density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = (*w)[ipart];
+                data_array[ipart] = w[ipart];
         
         else if (output == "charge_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = (*w)[ipart] * (double)((*q)[ipart]);
+                data_array[ipart] = w[ipart] * (double)(q[ipart]);
         
         else if (output == "jx_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = (*w)[ipart] * (double)((*q)[ipart]) * (*px)[ipart] / sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = w[ipart] * (double)(q[ipart]) * px[ipart] / sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "jy_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = (*w)[ipart] * (double)((*q)[ipart]) * (*py)[ipart] / sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = w[ipart] * (double)(q[ipart]) * py[ipart] / sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "jz_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = (*w)[ipart] * (double)((*q)[ipart]) * (*pz)[ipart] / sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = w[ipart] * (double)(q[ipart]) * pz[ipart] / sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "ekin_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (sqrt(1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart]) - 1.);
+                data_array[ipart] = mass * w[ipart] * (sqrt(1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart]) - 1.);
         
         else if (output == "p_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * sqrt((*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart]);
+                data_array[ipart] = mass * w[ipart] * sqrt(px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart]);
         
         else if (output == "px_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*px)[ipart];
+                data_array[ipart] = mass * w[ipart] * px[ipart];
         
         else if (output == "py_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*py)[ipart];
+                data_array[ipart] = mass * w[ipart] * py[ipart];
         
         else if (output == "pz_density")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*pz)[ipart];
+                data_array[ipart] = mass * w[ipart] * pz[ipart];
         
         else if (output == "pressure_xx")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*px)[ipart]*(*px)[ipart]/ sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = mass * w[ipart] * px[ipart]*px[ipart]/ sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "pressure_yy")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*py)[ipart]*(*py)[ipart]/ sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = mass * w[ipart] * py[ipart]*py[ipart]/ sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "pressure_zz")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*pz)[ipart]*(*pz)[ipart]/ sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = mass * w[ipart] * pz[ipart]*pz[ipart]/ sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "pressure_xy")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*px)[ipart]*(*py)[ipart]/ sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = mass * w[ipart] * px[ipart]*py[ipart]/ sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "pressure_xz")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*px)[ipart]*(*pz)[ipart]/ sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = mass * w[ipart] * px[ipart]*pz[ipart]/ sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         else if (output == "pressure_yz")
             for (ipart = 0 ; ipart < npart ; ipart++)
-                data_array[ipart] = mass * (*w)[ipart] * (*py)[ipart]*(*pz)[ipart]/ sqrt( 1. + (*px)[ipart]*(*px)[ipart] + (*py)[ipart]*(*py)[ipart] + (*pz)[ipart]*(*pz)[ipart] );
+                data_array[ipart] = mass * w[ipart] * py[ipart]*pz[ipart]/ sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
         
         // 3 - sum the data into the data_sum according to the indexes
         // ---------------------------------------------------------------
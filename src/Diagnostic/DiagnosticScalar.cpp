@@ -186,6 +186,8 @@ void DiagnosticScalar::compute( Patch* patch, int timestep )
         append("Ntot_"+nameSpec,nPart);
         append("Zavg_"+nameSpec,charge_avg);
         append("Ukin_"+nameSpec,ener_tot);
+        if (vecSpecies[ispec]->merge_every > 0)
+            append("Nmerged_"+nameSpec,vecSpecies[ispec]->getNbrOfMergedParticles());
         
         // incremement the total kinetic energy
         Ukin += ener_tot;
@@ -12,6 +12,7 @@
 #include "SimWindow.h"
 #include "Patch.h"
 #include "Profile.h"
+#include "Laser.h"
 #include "SolverFactory.h"
 
 using namespace std;
@@ -28,6 +29,7 @@ nDim_field     ( params.nDim_field ),
 cell_volume    ( params.cell_volume),
 n_space        ( params.n_space    ),
 oversize       ( params.oversize   ),
+fusedMaxwell   ( false             ),
 nrj_mw_lost    (  0.               ),
 nrj_new_fields (  0.               )
 {
@@ -206,6 +208,23 @@ void ElectroMagn::boundaryConditions(int itime, double time_dual, Patch* patch,
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Evaluate the python parts of the laser profiles at time_dual, so that boundaryConditions is thread-safe
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::prepareLasers(double time_dual, Patch* patch, Params &params, SimWindow* simWindow)
+{
+    // Same conditions as the application of the lasers in boundaryConditions
+    if ( simWindow && simWindow->isMoving(time_dual) ) return;
+    if ( emBoundCond[0]==NULL ) return;
+    
+    if ( patch->isWestern() )
+        for (unsigned int ilaser=0; ilaser<emBoundCond[0]->vecLaser.size(); ilaser++)
+            emBoundCond[0]->vecLaser[ilaser]->prepare(params, patch, time_dual);
+    if ( patch->isEastern() )
+        for (unsigned int ilaser=0; ilaser<emBoundCond[1]->vecLaser.size(); ilaser++)
+            emBoundCond[1]->vecLaser[ilaser]->prepare(params, patch, time_dual);
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Method used to create a dump of the data contained in ElectroMagn
 // ---------------------------------------------------------------------------------------------------------------------
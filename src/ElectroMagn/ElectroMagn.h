@@ -222,7 +222,17 @@ public:
     Solver* MaxwellFaradaySolver_;
     virtual void saveMagneticFields() = 0;
     virtual void centerMagneticFields() = 0;
+    //! True if solveMaxwellFused is available (replaces saveMagneticFields, solveMaxwellAmpere, the Faraday solver
+    //! and centerMagneticFields, the latter being restricted to the oversize layers in centerMagneticFieldsBorders)
+    bool fusedMaxwell;
+    virtual void solveMaxwellFused() {}
+    //! centerMagneticFields split in the points out of the oversize layers, which can be centered before the
+    //! exchange of B is completed, and the points of the oversize layers
+    virtual void centerMagneticFieldsInterior() = 0;
+    virtual void centerMagneticFieldsBorders() = 0;
     void boundaryConditions(int itime, double time_dual, Patch* patch, Params &params, SimWindow* simWindow);
+    //! Evaluates the python functions of the lasers used by boundaryConditions (by a single thread)
+    void prepareLasers(double time_dual, Patch* patch, Params &params, SimWindow* simWindow);
     
     void laserDisabled();
     
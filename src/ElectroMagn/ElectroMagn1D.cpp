@@ -376,6 +376,45 @@ void ElectroMagn1D::centerMagneticFields()
 }//END centerMagneticFields
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Center the Magnetic Fields out of the oversize layers (does not need the ghost cells of B)
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn1D::centerMagneticFieldsInterior()
+{
+    Field1D* B1D  [3] = { static_cast<Field1D*>(Bx_) , static_cast<Field1D*>(By_) , static_cast<Field1D*>(Bz_)  };
+    Field1D* B1D_m[3] = { static_cast<Field1D*>(Bx_m), static_cast<Field1D*>(By_m), static_cast<Field1D*>(Bz_m) };
+    const unsigned int ox = oversize[0];
+    
+    for (unsigned int icomp=0 ; icomp<3 ; icomp++) {
+        const unsigned int nx = B1D[icomp]->dims_[0];
+        for (unsigned int i=ox ; i<nx-ox ; i++) {
+            (*B1D_m[icomp])(i) = ( (*B1D[icomp])(i) + (*B1D_m[icomp])(i) )*0.5;
+        }
+    }
+    
+}//END centerMagneticFieldsInterior
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Center the Magnetic Fields in the oversize layers
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn1D::centerMagneticFieldsBorders()
+{
+    Field1D* B1D  [3] = { static_cast<Field1D*>(Bx_) , static_cast<Field1D*>(By_) , static_cast<Field1D*>(Bz_)  };
+    Field1D* B1D_m[3] = { static_cast<Field1D*>(Bx_m), static_cast<Field1D*>(By_m), static_cast<Field1D*>(Bz_m) };
+    const unsigned int ox = oversize[0];
+    
+    for (unsigned int icomp=0 ; icomp<3 ; icomp++) {
+        const unsigned int nx = B1D[icomp]->dims_[0];
+        for (unsigned int i=0 ; i<nx ; i++) {
+            if ( i==ox ) i = nx-ox;
+            (*B1D_m[icomp])(i) = ( (*B1D[icomp])(i) + (*B1D_m[icomp])(i) )*0.5;
+        }
+    }
+    
+}//END centerMagneticFieldsBorders
+
+
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Reset/Increment the averaged fields
@@ -480,14 +519,20 @@ void ElectroMagn1D::applyExternalField(Field* my_field,  Profile *profile, Patch
 
     Field1D* field1D=static_cast<Field1D*>(my_field);
     
-    vector<double> pos(1);
-    pos[0] = dx * ((double)(patch->getCellStartingGlobalIndex(0))+(field1D->isDual(0)?-0.5:0.));
+    double pos0 = dx * ((double)(patch->getCellStartingGlobalIndex(0))+(field1D->isDual(0)?-0.5:0.));
     int N = (int)field1D->dims()[0];
     
+    // Evaluate the profile on all points at once
+    vector<vector<double> > pos(1, vector<double>(N));
+    vector<double> values;
     // USING UNSIGNED INT CREATES PB WITH PERIODIC BCs
     for (int i=0 ; i<N ; i++) {
-        (*field1D)(i) += profile->valueAt(pos);
-        pos[0] += dx;
+        pos[0][i] = pos0;
+        pos0 += dx;
+    }
+    profile->valuesAt(pos, values);
+    for (int i=0 ; i<N ; i++) {
+        (*field1D)(i) += values[i];
     }
         
     if(emBoundCond[0]) emBoundCond[0]->save_fields_BC1D(my_field);
@@ -500,6 +545,8 @@ void ElectroMagn1D::initAntennas(Patch* patch)
     
     // Filling the space profiles of antennas
     for (unsigned int i=0; i<antennas.size(); i++) {
+        if (antennas[i].field) delete antennas[i].field;
+        antennas[i].field = NULL;
         if      (antennas[i].fieldName == "Jx")
             antennas[i].field = new Field1D(dimPrim, 0, false, "Jx");
         else if (antennas[i].fieldName == "Jy")
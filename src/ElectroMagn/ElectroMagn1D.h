@@ -52,6 +52,12 @@ public:
     //! Method used to center the Magnetic fields (used to push the particles)
     void centerMagneticFields();
     
+    //! Method used to center the Magnetic fields out of the oversize layers
+    void centerMagneticFieldsInterior();
+    
+    //! Method used to center the Magnetic fields in the oversize layers
+    void centerMagneticFieldsBorders();
+    
     //! Method used to reset/increment the averaged fields
     void incrementAvgFields(unsigned int time_step);
     
@@ -42,6 +42,9 @@ isNorthern(patch->isNorthern())
     dt_ov_dy = timestep/dy;
     dy_ov_dt = 1.0/dt_ov_dy;
     
+    // The fused Maxwell step (solveMaxwellFused) is written for the Yee stencil
+    fusedMaxwell = ( params.maxwell_sol == "Yee" );
+    
     // ----------------------
     // Electromagnetic fields
     // ----------------------
@@ -444,6 +447,7 @@ void ElectroMagn2D::saveMagneticFields()
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Solve the Maxwell-Ampere equation
+//   Single sweep along the 1st direction on the flat arrays, as in MF_Solver2D_Yee (vectorized inner loops)
 // ---------------------------------------------------------------------------------------------------------------------
 void ElectroMagn2D::solveMaxwellAmpere()
 {
@@ -457,30 +461,242 @@ void ElectroMagn2D::solveMaxwellAmpere()
     Field2D* Jx2D = static_cast<Field2D*>(Jx_);
     Field2D* Jy2D = static_cast<Field2D*>(Jy_);
     Field2D* Jz2D = static_cast<Field2D*>(Jz_);
-    // Electric field Ex^(d,p)
+    
+    double* __restrict__ Ex = Ex2D->data();
+    double* __restrict__ Ey = Ey2D->data();
+    double* __restrict__ Ez = Ez2D->data();
+    const double* __restrict__ Bx = Bx2D->data();
+    const double* __restrict__ By = By2D->data();
+    const double* __restrict__ Bz = Bz2D->data();
+    const double* __restrict__ Jx = Jx2D->data();
+    const double* __restrict__ Jy = Jy2D->data();
+    const double* __restrict__ Jz = Jz2D->data();
+    const unsigned int sEx = Ex2D->stride(), sEy = Ey2D->stride(), sEz = Ez2D->stride();
+    const unsigned int sBx = Bx2D->stride(), sBy = By2D->stride(), sBz = Bz2D->stride();
+    const unsigned int sJx = Jx2D->stride(), sJy = Jy2D->stride(), sJz = Jz2D->stride();
+    const double dt = timestep, dtdx = dt_ov_dx, dtdy = dt_ov_dy;
+    
     for (unsigned int i=0 ; i<nx_d ; i++) {
+        // Electric field Ex^(d,p)
+        double*       __restrict__ ex = Ex + i*sEx;
+        const double* __restrict__ jx = Jx + i*sJx;
+        const double* __restrict__ bz = Bz + i*sBz;
+        #pragma omp simd
         for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*Ex2D)(i,j) += -timestep*(*Jx2D)(i,j) + dt_ov_dy * ( (*Bz2D)(i,j+1) - (*Bz2D)(i,j) );
+            ex[j] += -dt*jx[j] + dtdy * ( bz[j+1] - bz[j] );
         }
-    }
-    
-    // Electric field Ey^(p,d)
-    for (unsigned int i=0 ; i<nx_p ; i++) {
+        if (i==nx_p) break;
+        
+        // Electric field Ey^(p,d)
+        double*       __restrict__ ey    = Ey + i*sEy;
+        const double* __restrict__ jy    = Jy + i*sJy;
+        const double* __restrict__ bz_ip = bz + sBz;
+        #pragma omp simd
         for (unsigned int j=0 ; j<ny_d ; j++) {
-            (*Ey2D)(i,j) += -timestep*(*Jy2D)(i,j) - dt_ov_dx * ( (*Bz2D)(i+1,j) - (*Bz2D)(i,j) );
+            ey[j] += -dt*jy[j] - dtdx * ( bz_ip[j] - bz[j] );
+        }
+        
+        // Electric field Ez^(p,p)
+        double*       __restrict__ ez    = Ez + i*sEz;
+        const double* __restrict__ jz    = Jz + i*sJz;
+        const double* __restrict__ bx    = Bx + i*sBx;
+        const double* __restrict__ by    = By + i*sBy;
+        const double* __restrict__ by_ip = by + sBy;
+        #pragma omp simd
+        for (unsigned int j=0 ; j<ny_p ; j++) {
+            ez[j] += -dt*jz[j]
+            +        dtdx * ( by_ip[j] - by[j] )
+            -        dtdy * ( bx[j+1] - bx[j] );
         }
     }
     
-    // Electric field Ez^(p,p)
-    for (unsigned int i=0 ;  i<nx_p ; i++) {
+}//END solveMaxwellAmpere
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fused Maxwell step for the Yee solver : Maxwell-Ampere, Maxwell-Faraday and centering of B in a single sweep
+//   B^(n+1) is written in the arrays of B_m, which are then swapped with those of B : B^n is never copied.
+//   The row i of E is computed from the rows i and i+1 of B^n, the row i of B^(n+1) from the rows i and i-1 of E,
+//   after which the row i of B^n is not used anymore and is replaced by B^(n+1/2).
+//   In the oversize layers, which are modified by the boundary conditions and the exchange of B, B_m keeps B^n and
+//   the centering is done by centerMagneticFieldsBorders.
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn2D::solveMaxwellFused()
+{
+    // Static-cast of the fields
+    Field2D* Ex2D   = static_cast<Field2D*>(Ex_);
+    Field2D* Ey2D   = static_cast<Field2D*>(Ey_);
+    Field2D* Ez2D   = static_cast<Field2D*>(Ez_);
+    Field2D* Bx2D   = static_cast<Field2D*>(Bx_);
+    Field2D* By2D   = static_cast<Field2D*>(By_);
+    Field2D* Bz2D   = static_cast<Field2D*>(Bz_);
+    Field2D* Bx2D_m = static_cast<Field2D*>(Bx_m);
+    Field2D* By2D_m = static_cast<Field2D*>(By_m);
+    Field2D* Bz2D_m = static_cast<Field2D*>(Bz_m);
+    Field2D* Jx2D   = static_cast<Field2D*>(Jx_);
+    Field2D* Jy2D   = static_cast<Field2D*>(Jy_);
+    Field2D* Jz2D   = static_cast<Field2D*>(Jz_);
+    
+    double* __restrict__ Ex = Ex2D->data();
+    double* __restrict__ Ey = Ey2D->data();
+    double* __restrict__ Ez = Ez2D->data();
+    // B^n, then B^(n+1/2) out of the oversize layers
+    double* __restrict__ Bx = Bx2D->data();
+    double* __restrict__ By = By2D->data();
+    double* __restrict__ Bz = Bz2D->data();
+    // B^(n+1)
+    double* __restrict__ Bx_new = Bx2D_m->data();
+    double* __restrict__ By_new = By2D_m->data();
+    double* __restrict__ Bz_new = Bz2D_m->data();
+    const double* __restrict__ Jx = Jx2D->data();
+    const double* __restrict__ Jy = Jy2D->data();
+    const double* __restrict__ Jz = Jz2D->data();
+    const unsigned int sEx = Ex2D->stride(), sEy = Ey2D->stride(), sEz = Ez2D->stride();
+    const unsigned int sBx = Bx2D->stride(), sBy = By2D->stride(), sBz = Bz2D->stride();
+    const unsigned int sJx = Jx2D->stride(), sJy = Jy2D->stride(), sJz = Jz2D->stride();
+    const double dt = timestep, dtdx = dt_ov_dx, dtdy = dt_ov_dy;
+    const unsigned int ox = oversize[0], oy = oversize[1];
+    
+    for (unsigned int i=0 ; i<nx_d ; i++) {
+        // Electric field Ex^(d,p)
+        double*       __restrict__ ex = Ex + i*sEx;
+        const double* __restrict__ jx = Jx + i*sJx;
+        double*       __restrict__ bz = Bz + i*sBz;
+        #pragma omp simd
         for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*Ez2D)(i,j) += -timestep*(*Jz2D)(i,j)
-            +               dt_ov_dx * ( (*By2D)(i+1,j) - (*By2D)(i,j) )
-            -               dt_ov_dy * ( (*Bx2D)(i,j+1) - (*Bx2D)(i,j) );
+            ex[j] += -dt*jx[j] + dtdy * ( bz[j+1] - bz[j] );
+        }
+        
+        double* __restrict__ bx = Bx + i*sBx;
+        double* __restrict__ by = By + i*sBy;
+        double* __restrict__ ez = Ez + i*sEz;
+        if (i<nx_p) {
+            // Electric field Ey^(p,d)
+            double*       __restrict__ ey    = Ey + i*sEy;
+            const double* __restrict__ jy    = Jy + i*sJy;
+            const double* __restrict__ bz_ip = bz + sBz;
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny_d ; j++) {
+                ey[j] += -dt*jy[j] - dtdx * ( bz_ip[j] - bz[j] );
+            }
+            
+            // Electric field Ez^(p,p)
+            const double* __restrict__ jz    = Jz + i*sJz;
+            const double* __restrict__ by_ip = by + sBy;
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny_p ; j++) {
+                ez[j] += -dt*jz[j]
+                +        dtdx * ( by_ip[j] - by[j] )
+                -        dtdy * ( bx[j+1] - bx[j] );
+            }
+            
+            // Magnetic field Bx^(p,d)
+            double* __restrict__ bx_new = Bx_new + i*sBx;
+            bx_new[0] = bx[0];
+            #pragma omp simd
+            for (unsigned int j=1 ; j<ny_d-1 ; j++) {
+                bx_new[j] = bx[j] - dtdy * ( ez[j] - ez[j-1] );
+            }
+            bx_new[ny_d-1] = bx[ny_d-1];
+            
+            if ( i>=ox && i<nx_p-ox ) {
+                #pragma omp simd
+                for (unsigned int j=oy ; j<ny_d-oy ; j++) {
+                    bx[j] = ( bx_new[j] + bx[j] )*0.5;
+                }
+            }
+        }
+        
+        double* __restrict__ by_new = By_new + i*sBy;
+        double* __restrict__ bz_new = Bz_new + i*sBz;
+        if (i==0 || i==nx_d-1) {
+            // Not computed by the solver : kept as is until the boundary conditions and the exchange
+            memcpy( by_new, by, ny_p*sizeof(double) );
+            memcpy( bz_new, bz, ny_d*sizeof(double) );
+        } else {
+            // Magnetic field By^(d,p)
+            const double* __restrict__ ez_im = ez - sEz;
+            #pragma omp simd
+            for (unsigned int j=0 ; j<ny_p ; j++) {
+                by_new[j] = by[j] + dtdx * ( ez[j] - ez_im[j] );
+            }
+            
+            // Magnetic field Bz^(d,d)
+            const double* __restrict__ ey    = Ey + i*sEy;
+            const double* __restrict__ ey_im = ey - sEy;
+            bz_new[0] = bz[0];
+            #pragma omp simd
+            for (unsigned int j=1 ; j<ny_d-1 ; j++) {
+                bz_new[j] = bz[j] + ( dtdy * ( ex[j] - ex[j-1] )
+                -                     dtdx * ( ey[j] - ey_im[j] ) );
+            }
+            bz_new[ny_d-1] = bz[ny_d-1];
+        }
+        
+        if ( i>=ox && i<nx_d-ox ) {
+            #pragma omp simd
+            for (unsigned int j=oy ; j<ny_p-oy ; j++) {
+                by[j] = ( by_new[j] + by[j] )*0.5;
+            }
+            #pragma omp simd
+            for (unsigned int j=oy ; j<ny_d-oy ; j++) {
+                bz[j] = ( bz_new[j] + bz[j] )*0.5;
+            }
         }
     }
+    
+    // B_m <- B^n (B^(n+1/2) out of the oversize layers) and B <- B^(n+1)
+    Bx2D->swapData( Bx2D_m );
+    By2D->swapData( By2D_m );
+    Bz2D->swapData( Bz2D_m );
+    
+}//END solveMaxwellFused
 
-}//END solveMaxwellAmpere
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Center the Magnetic Fields out of the oversize layers (does not need the ghost cells of B)
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn2D::centerMagneticFieldsInterior()
+{
+    Field2D* B2D  [3] = { static_cast<Field2D*>(Bx_) , static_cast<Field2D*>(By_) , static_cast<Field2D*>(Bz_)  };
+    Field2D* B2D_m[3] = { static_cast<Field2D*>(Bx_m), static_cast<Field2D*>(By_m), static_cast<Field2D*>(Bz_m) };
+    const unsigned int ox = oversize[0], oy = oversize[1];
+    
+    for (unsigned int icomp=0 ; icomp<3 ; icomp++) {
+        const unsigned int nx = B2D[icomp]->dims_[0];
+        const unsigned int ny = B2D[icomp]->dims_[1];
+        for (unsigned int i=ox ; i<nx-ox ; i++) {
+            for (unsigned int j=oy ; j<ny-oy ; j++) {
+                (*B2D_m[icomp])(i,j) = ( (*B2D[icomp])(i,j) + (*B2D_m[icomp])(i,j) )*0.5;
+            }
+        }
+    }
+    
+}//END centerMagneticFieldsInterior
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Center the Magnetic Fields in the oversize layers, left out by solveMaxwellFused and centerMagneticFieldsInterior
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn2D::centerMagneticFieldsBorders()
+{
+    Field2D* B2D  [3] = { static_cast<Field2D*>(Bx_) , static_cast<Field2D*>(By_) , static_cast<Field2D*>(Bz_)  };
+    Field2D* B2D_m[3] = { static_cast<Field2D*>(Bx_m), static_cast<Field2D*>(By_m), static_cast<Field2D*>(Bz_m) };
+    const unsigned int ox = oversize[0], oy = oversize[1];
+    
+    for (unsigned int icomp=0 ; icomp<3 ; icomp++) {
+        const unsigned int nx = B2D[icomp]->dims_[0];
+        const unsigned int ny = B2D[icomp]->dims_[1];
+        for (unsigned int i=0 ; i<nx ; i++) {
+            for (unsigned int j=0 ; j<ny ; j++) {
+                // Only both ends of the rows which are not in the oversize layers along x
+                if ( j==oy && i>=ox && i<nx-ox ) j = ny-oy;
+                (*B2D_m[icomp])(i,j) = ( (*B2D[icomp])(i,j) + (*B2D_m[icomp])(i,j) )*0.5;
+            }
+        }
+    }
+    
+}//END centerMagneticFieldsBorders
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -757,20 +973,29 @@ void ElectroMagn2D::applyExternalField(Field* my_field,  Profile *profile, Patch
     
     Field2D* field2D=static_cast<Field2D*>(my_field);
         
-    vector<double> pos(2,0);
-    pos[0]      = dx*((double)(patch->getCellStartingGlobalIndex(0))+(field2D->isDual(0)?-0.5:0.));
-    double pos1 = dy*((double)(patch->getCellStartingGlobalIndex(1))+(field2D->isDual(1)?-0.5:0.));
+    double pos0 = dx*((double)(patch->getCellStartingGlobalIndex(0))+(field2D->isDual(0)?-0.5:0.));
+    double pos1_min = dy*((double)(patch->getCellStartingGlobalIndex(1))+(field2D->isDual(1)?-0.5:0.));
     int N0 = (int)field2D->dims()[0];
     int N1 = (int)field2D->dims()[1];
     
+    // Evaluate the profile on all points at once
+    vector<vector<double> > pos(2, vector<double>(N0*N1));
+    vector<double> values;
     // UNSIGNED INT LEADS TO PB IN PERIODIC BCs
     for (int i=0 ; i<N0 ; i++) {
-        pos[1] = pos1;
+        double pos1 = pos1_min;
+        for (int j=0 ; j<N1 ; j++) {
+            pos[0][i*N1+j] = pos0;
+            pos[1][i*N1+j] = pos1;
+            pos1 += dy;
+        }
+        pos0 += dx;
+    }
+    profile->valuesAt(pos, values);
+    for (int i=0 ; i<N0 ; i++) {
         for (int j=0 ; j<N1 ; j++) {
-            (*field2D)(i,j) += profile->valueAt(pos);
-            pos[1] += dy;
+            (*field2D)(i,j) += values[i*N1+j];
         }
-        pos[0] += dx;
     }
     
     if (emBoundCond[0]!=0) emBoundCond[0]->save_fields_BC2D_Long(my_field);
@@ -787,6 +1012,8 @@ void ElectroMagn2D::initAntennas(Patch* patch)
     
     // Filling the space profiles of antennas
     for (unsigned int i=0; i<antennas.size(); i++) {
+        if (antennas[i].field) delete antennas[i].field;
+        antennas[i].field = NULL;
         if      (antennas[i].fieldName == "Jx")
             antennas[i].field = new Field2D(dimPrim, 0, false, "Jx");
         else if (antennas[i].fieldName == "Jy")
@@ -51,6 +51,15 @@ public:
     //! Method used to center the Magnetic fields (used to push the particles)
     void centerMagneticFields();
     
+    //! Method used to solve Maxwell-Ampere, Maxwell-Faraday (Yee) and center B in a single sweep
+    void solveMaxwellFused();
+    
+    //! Method used to center the Magnetic fields out of the oversize layers, during the exchange of B
+    void centerMagneticFieldsInterior();
+    
+    //! Method used to center the Magnetic fields in the oversize layers, after the exchange of B
+    void centerMagneticFieldsBorders();
+    
     //! Method used to reset/increment the averaged fields
     void incrementAvgFields(unsigned int time_step);
     
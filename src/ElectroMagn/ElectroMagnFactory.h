@@ -154,6 +154,7 @@ public:
             antenna.fieldName     = EMfields->antennas[n_antenna].fieldName    ;
             antenna.space_profile = EMfields->antennas[n_antenna].space_profile;
             antenna.time_profile  = EMfields->antennas[n_antenna].time_profile ;
+            antenna.field         = NULL;
             newEMfields->antennas.push_back(antenna);
         }
         
@@ -27,9 +27,12 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
     PyObject *chirp_profile, *time_profile;
     vector<PyObject*>  space_profile, phase_profile, space_time_profile;
     bool time, space, omega, chirp, phase, space_time;
-    double omega_value;
+    double omega_value(0.), time_envelope_sampling(0.);
     Profile *p, *pchirp, *ptime, *pspace1, *pspace2, *pphase1, *pphase2;
     omega      = PyTools::extract("omega",omega_value,"Laser",ilaser);
+    PyTools::extract("time_envelope_sampling",time_envelope_sampling,"Laser",ilaser);
+    if( time_envelope_sampling < 0. )
+        ERROR(errorPrefix << ": `time_envelope_sampling` must be positive");
     chirp      = PyTools::extract_pyProfile("chirp_profile"     , chirp_profile, "Laser", ilaser);
     time       = PyTools::extract_pyProfile("time_envelope"     , time_profile , "Laser", ilaser);
     space      = PyTools::extract2Profiles ("space_envelope"    , ilaser, space_profile     );
@@ -59,7 +62,7 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         name << "Laser[" << ilaser <<"].space_time_profile[0]";
         if( spacetime[0] ) {
             p = new Profile(space_time_profile[0], params.nDim_field, name.str());
-            profiles.push_back( new LaserProfileNonSeparable(p) );
+            profiles.push_back( new LaserProfileNonSeparable(p, true) );
             info << "\t\t\tfirst  axis : " << p->getInfo() << endl;
         } else {
             profiles.push_back( new LaserProfileNULL() );
@@ -70,7 +73,7 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         name << "Laser[" << ilaser <<"].space_time_profile[1]";
         if( spacetime[1] ) {
             p = new Profile(space_time_profile[1], params.nDim_field, name.str());
-            profiles.push_back( new LaserProfileNonSeparable(p) );
+            profiles.push_back( new LaserProfileNonSeparable(p, false) );
             info << "\t\t\tsecond axis : " << p->getInfo();
         } else {
             profiles.push_back( new LaserProfileNULL() );
@@ -108,6 +111,8 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         name << "Laser[" << ilaser <<"].time_envelope";
         ptime = new Profile(time_profile, 1, name.str());
         info << endl << "\t\t\ttime envelope      : " << ptime->getInfo();
+        if( time_envelope_sampling > 0. && ptime->usesPython() )
+            info << ", tabulated every " << time_envelope_sampling;
         
         // space envelope (By)
         name.str("");
@@ -133,9 +138,14 @@ Laser::Laser(Params &params, int ilaser, Patch* patch)
         pphase2 = new Profile(phase_profile[1], space_dims, name.str());
         info << endl << "\t\t\tphase          (z) : " << pphase2->getInfo();
         
+        // The table is only worth it for python time envelopes
+        LaserTimeTable* time_table = NULL;
+        if( time_envelope_sampling > 0. && ptime->usesPython() )
+            time_table = new LaserTimeTable(time_envelope_sampling);
+        
         // Create the LaserProfiles
-        profiles.push_back( new LaserProfileSeparable(omega_value, pchirp, ptime, pspace1, pphase1, true ) );
-        profiles.push_back( new LaserProfileSeparable(omega_value, pchirp, ptime, pspace2, pphase2, false) );
+        profiles.push_back( new LaserProfileSeparable(omega_value, pchirp, ptime, pspace1, pphase1, true , time_table) );
+        profiles.push_back( new LaserProfileSeparable(omega_value, pchirp, ptime, pspace2, pphase2, false, time_table) );
     
     }
     
@@ -188,17 +198,20 @@ void Laser::disable()
 // Separable laser profile constructor
 LaserProfileSeparable::LaserProfileSeparable(
     double omega, Profile* chirpProfile, Profile* timeProfile,
-    Profile* spaceProfile, Profile* phaseProfile, bool primal
+    Profile* spaceProfile, Profile* phaseProfile, bool primal, LaserTimeTable* time_table
 ):
     primal       ( primal       ),
     omega        ( omega        ),
     timeProfile  ( timeProfile  ),
     chirpProfile ( chirpProfile ),
     spaceProfile ( spaceProfile ),
-    phaseProfile ( phaseProfile )
+    phaseProfile ( phaseProfile ),
+    time_table   ( time_table   )
 {
     space_envelope = NULL;
     phase = NULL;
+    python = timeProfile->usesPython() || chirpProfile->usesPython();
+    if( time_table ) time_table->nprofiles++;
 }
 // Cloning constructor
 LaserProfileSeparable::LaserProfileSeparable(LaserProfileSeparable * lp) :
@@ -207,10 +220,14 @@ LaserProfileSeparable::LaserProfileSeparable(LaserProfileSeparable * lp) :
     timeProfile  ( new Profile(lp->timeProfile ) ),
     chirpProfile ( new Profile(lp->chirpProfile) ),
     spaceProfile ( new Profile(lp->spaceProfile) ),
-    phaseProfile ( new Profile(lp->phaseProfile) )
+    phaseProfile ( new Profile(lp->phaseProfile) ),
+    python       ( lp->python ),
+    time_table   ( lp->time_table )
 {
     space_envelope = NULL;
     phase = NULL;
+    // The table is shared with the original profile
+    if( time_table ) time_table->nprofiles++;
 }
 //Destructor
 LaserProfileSeparable::~LaserProfileSeparable()
@@ -223,6 +240,10 @@ LaserProfileSeparable::~LaserProfileSeparable()
     if(phaseProfile  ) delete phaseProfile;
     if(space_envelope) delete space_envelope;
     if(phase         ) delete phase;
+    if(time_table) {
+        time_table->nprofiles--;
+        if( time_table->nprofiles == 0 ) delete time_table;
+    }
 }
 
 
@@ -280,14 +301,131 @@ void LaserProfileSeparable::initFields(Params& params, Patch* patch)
 
 
 // Amplitude of a separable laser profile
+// Evaluates the time and chirp profiles when they call python
+void LaserProfileSeparable::prepare(Params& params, Patch* patch, double t)
+{
+    if( ! python ) return;
+    
+    prepared_omega = omega * chirpProfile->valueAt(t);
+    unsigned int n = space_envelope->dims_[0];
+    prepared_time_envelope.resize(n);
+    
+    // Samples the table over the times requested on the boundary of this patch
+    if( time_table ) {
+        double tmin = t - (*phase)(0) / prepared_omega;
+        double tmax = tmin;
+        for (unsigned int j=1 ; j<n ; j++) {
+            double tj = t - (*phase)(j) / prepared_omega;
+            if( tj < tmin ) tmin = tj;
+            if( tj > tmax ) tmax = tj;
+        }
+        time_table->prepare(timeProfile, t, tmin, tmax);
+    }
+    
+    for (unsigned int j=0 ; j<n ; j++) {
+        // The phase is often uniform : python is then called only once
+        if( j>0 && (*phase)(j)==(*phase)(j-1) ) {
+            prepared_time_envelope[j] = prepared_time_envelope[j-1];
+        } else {
+            double t0 = (*phase)(j) / prepared_omega;
+            if( time_table )
+                prepared_time_envelope[j] = time_table->valueAt(timeProfile, t-t0);
+            else
+                prepared_time_envelope[j] = timeProfile->valueAt(t-t0);
+        }
+    }
+}
+
+
+// The times t-t0 requested over the boundary increase by one timestep at each step, so that the nodes before
+// the first one requested at the previous step are dropped, and only the new nodes are evaluated with python.
+// The table is re-sampled from scratch when earlier times are requested (first step, or phases of a patch
+// received from another process): its size stays of the order of the range of t0 divided by the step.
+void LaserTimeTable::prepare(Profile* timeProfile, double t, double tmin, double tmax)
+{
+    int ka = (int) floor(tmin / step);
+    int kb = (int) floor(tmax / step) + 1;
+    
+    if( first || t != time ) {
+        // New timestep: drop the nodes which were not used at the previous one
+        if( ! first && kmin_used > kmin ) {
+            unsigned int ndrop = min( (size_t)(kmin_used-kmin), values.size() );
+            values.erase( values.begin(), values.begin()+ndrop );
+            kmin += ndrop;
+        }
+        first = false;
+        time = t;
+        kmin_used = ka;
+    } else if( ka < kmin_used ) {
+        kmin_used = ka;
+    }
+    
+    if( values.empty() || ka < kmin ) {
+        values.clear();
+        kmin = ka;
+    }
+    while( kmin + (int)values.size() <= kb ) {
+        values.push_back( timeProfile->valueAt( (kmin+(int)values.size())*step ) );
+    }
+}
+
+double LaserTimeTable::valueAt(Profile* timeProfile, double t)
+{
+    double x = t / step;
+    int k = (int) floor(x);
+    if( k < kmin || k+1 >= kmin + (int)values.size() )
+        return timeProfile->valueAt(t);
+    
+    double w = x - (double)k;
+    return (1.-w) * values[k-kmin] + w * values[k+1-kmin];
+}
+
+
 double LaserProfileSeparable::getAmplitude(std::vector<double> pos, double t, int j)
 {
-    double omega_ = omega * chirpProfile->valueAt(t);
-    double t0 = (*phase)(j) / omega_;
-    return timeProfile->valueAt(t-t0) * (*space_envelope)(j)
+    double omega_, t0, time_envelope;
+    if( python ) {
+        omega_ = prepared_omega;
+        t0 = (*phase)(j) / omega_;
+        time_envelope = prepared_time_envelope[j];
+    } else {
+        omega_ = omega * chirpProfile->valueAt(t);
+        t0 = (*phase)(j) / omega_;
+        time_envelope = timeProfile->valueAt(t-t0);
+    }
+    return time_envelope * (*space_envelope)(j)
            * sin( omega_*(t - t0) );
 }
 
+// Evaluates the profile on the boundary when it calls python (same positions as in the boundary conditions)
+void LaserProfileNonSeparable::prepare(Params& params, Patch* patch, double t)
+{
+    if( ! spaceAndTimeProfile->usesPython() ) return;
+    
+    if( params.geometry=="1d3v" ) {
+        
+        vector<double> pos(1);
+        pos[0] = 0.;
+        prepared_amplitude.resize(1);
+        prepared_amplitude[0] = spaceAndTimeProfile->valueAt(pos, t);
+        
+    } else if( params.geometry=="2d3v" ) {
+        
+        unsigned int ny_p = params.n_space[1]+1+2*params.oversize[1];
+        unsigned int ny_d = ny_p+1;
+        double dy = params.cell_length[1];
+        unsigned int n = primal ? ny_p : ny_d;
+        
+        vector<vector<double> > yp(1, vector<double>(n));
+        double y = patch->getDomainLocalMin(1) - ((primal?0.:0.5) + params.oversize[1])*dy;
+        for (unsigned int j=0 ; j<n ; j++) {
+            y += dy;
+            yp[0][j] = y;
+        }
+        spaceAndTimeProfile->valuesAt(yp, t, prepared_amplitude);
+    }
+}
+
 //Destructor
 LaserProfileNonSeparable::~LaserProfileNonSeparable()
 {
@@ -26,6 +26,8 @@ public:
     virtual std::string getInfo() { return "?"; };
     virtual void createFields(Params& params, Patch* patch) {};
     virtual void initFields  (Params& params, Patch* patch) {};
+    //! Evaluates beforehand, at time t, the parts of the profile which call python
+    virtual void prepare(Params& params, Patch* patch, double t) {};
 };
 
 
@@ -62,6 +64,15 @@ public:
         profiles[1]->initFields(params, patch);
     };
     
+    //! Evaluates the python functions of the profiles at time t, on the boundary of the patch.
+    //! Python cannot be called by several threads : this is done by one thread before the boundary conditions,
+    //! which may then call getAmplitude0/1 in parallel for all patches.
+    void prepare(Params& params, Patch* patch, double t)
+    {
+        profiles[0]->prepare(params, patch, t);
+        profiles[1]->prepare(params, patch, t);
+    };
+    
     //! Side (west/east) from which the laser enters the box
     std::string boxSide;
     
@@ -80,37 +91,77 @@ private:
 
 
 
+// Time envelope of a laser sampled every `step`, shared by the profiles (By and Bz) of all the clones of this laser.
+// Only the nodes around the times requested over the boundary at the current timestep are kept.
+class LaserTimeTable {
+public:
+    LaserTimeTable(double step) : nprofiles(0), step(step), time(0.), kmin(0), kmin_used(0), first(true) {};
+    
+    //! Samples (calling python) the nodes covering [tmin, tmax], requested at time t.
+    //! The nodes before the first one requested at the previous timestep are dropped.
+    void prepare(Profile* timeProfile, double t, double tmin, double tmax);
+    
+    //! Linear interpolation between the nodes (timeProfile is only called outside the sampled range)
+    double valueAt(Profile* timeProfile, double t);
+    
+    //! Number of laser profiles using this table (it is deleted by the last one)
+    unsigned int nprofiles;
+    
+private:
+    double step;
+    //! Time of the last call to prepare
+    double time;
+    //! Index of the first node in values, and of the first node requested during the current timestep
+    int kmin, kmin_used;
+    bool first;
+    std::vector<double> values;
+};
+
+
 // Laser profile for separable space and time
 class LaserProfileSeparable : public LaserProfile {
 friend class SmileiMPI;
 public:
-    LaserProfileSeparable(double, Profile*, Profile*, Profile*, Profile*, bool);
+    LaserProfileSeparable(double, Profile*, Profile*, Profile*, Profile*, bool, LaserTimeTable*);
     LaserProfileSeparable(LaserProfileSeparable*);
     ~LaserProfileSeparable();
     void createFields(Params& params, Patch* patch);
     void initFields  (Params& params, Patch* patch);
+    void prepare(Params& params, Patch* patch, double t);
     double getAmplitude(std::vector<double> pos, double t, int j);
 private:
     bool primal;
     double omega;
     Profile *timeProfile, *chirpProfile, *spaceProfile, *phaseProfile;
     Field *space_envelope, *phase;
+    //! True if the time or chirp profiles call python : they are then evaluated in prepare
+    bool python;
+    //! omega * chirp, and time envelope for each point of the boundary, evaluated in prepare
+    double prepared_omega;
+    std::vector<double> prepared_time_envelope;
+    //! Table of a python time envelope, shared with the other profiles of the laser (NULL if not tabulated)
+    LaserTimeTable* time_table;
 };
 
 // Laser profile for non-separable space and time
 class LaserProfileNonSeparable : public LaserProfile {
 friend class SmileiMPI;
 public:
-    LaserProfileNonSeparable(Profile * spaceAndTimeProfile)
-     : spaceAndTimeProfile(spaceAndTimeProfile) {};
+    LaserProfileNonSeparable(Profile * spaceAndTimeProfile, bool primal)
+     : primal(primal), spaceAndTimeProfile(spaceAndTimeProfile) {};
     LaserProfileNonSeparable(LaserProfileNonSeparable* lp)
-     : spaceAndTimeProfile(lp->spaceAndTimeProfile) {};
+     : primal(lp->primal), spaceAndTimeProfile(new Profile(lp->spaceAndTimeProfile)) {};
     ~LaserProfileNonSeparable();
+    void prepare(Params& params, Patch* patch, double t);
     inline double getAmplitude(std::vector<double> pos, double t, int j) {
+        if( spaceAndTimeProfile->usesPython() ) return prepared_amplitude[j];
         return spaceAndTimeProfile->valueAt(pos, t);
     }
 private:
+    bool primal;
     Profile * spaceAndTimeProfile;
+    //! Amplitude for each point of the boundary, evaluated in prepare when the profile calls python
+    std::vector<double> prepared_amplitude;
 };
 
 // Null laser profile
@@ -22,6 +22,11 @@ MF_Solver2D_Lehe::~MF_Solver2D_Lehe()
 {
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Maxwell-Faraday equation on the flat arrays of the fields (extended stencil)
+//   As in MF_Solver2D_Yee, all components are updated in a single sweep along the 1st direction, so that the rows
+//   i-2..i+1 of the electric field are loaded once, with vectorized inner loops along the 2nd direction.
+// ---------------------------------------------------------------------------------------------------------------------
 void MF_Solver2D_Lehe::operator() ( ElectroMagn* fields )
 {
     // Static-cast of the fields
@@ -31,35 +36,52 @@ void MF_Solver2D_Lehe::operator() ( ElectroMagn* fields )
     Field2D* Bx2D = static_cast<Field2D*>(fields->Bx_);
     Field2D* By2D = static_cast<Field2D*>(fields->By_);
     Field2D* Bz2D = static_cast<Field2D*>(fields->Bz_);
-
-
-
-//    for (unsigned int i=0 ; i<nx_p;  i++) {
-//    for (unsigned int i=1 ; i<nx_d-1;  i++) {
-    for (unsigned int i=1 ; i<nx_d-2;  i++) {
+    
+    const double* __restrict__ Ex = Ex2D->data();
+    const double* __restrict__ Ey = Ey2D->data();
+    const double* __restrict__ Ez = Ez2D->data();
+    double* __restrict__ Bx = Bx2D->data();
+    double* __restrict__ By = By2D->data();
+    double* __restrict__ Bz = Bz2D->data();
+    const unsigned int sEx = Ex2D->stride(), sEy = Ey2D->stride(), sEz = Ez2D->stride();
+    const unsigned int sBx = Bx2D->stride(), sBy = By2D->stride(), sBz = Bz2D->stride();
+    const double dtdx = dt_ov_dx, dtdy = dt_ov_dy;
+    const double Betax = Beta_x, betax = beta_x, Betay = Beta_y, betay = beta_y, delta = delta_x;
+    
+    for (unsigned int i=1 ; i<nx_d-2 ; i++) {
+        // Magnetic field Bx^(p,d)
+        double*       __restrict__ bx     = Bx + i*sBx;
+        const double* __restrict__ ez     = Ez + i*sEz;
+        const double* __restrict__ ez_ip  = ez + sEz;
+        const double* __restrict__ ez_im  = ez - sEz;
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bx2D)(i,j) -= dt_ov_dy * ( Beta_x*((*Ez2D)(i,j) - (*Ez2D)(i,j-1)) +beta_x*( (*Ez2D)(i+1,j)- (*Ez2D)(i+1,j-1) +(*Ez2D)(i-1,j)- (*Ez2D)(i-1,j-1)));
+            bx[j] -= dtdy * ( Betax*(ez[j] - ez[j-1]) + betax*( ez_ip[j] - ez_ip[j-1] + ez_im[j] - ez_im[j-1] ) );
         }
-    }
-    
-    // Magnetic field By^(d,p)
-    for (unsigned int i=2 ; i<nx_d-2 ; i++) {
+        if (i<2) continue;
+        
+        // Magnetic field By^(d,p)
+        double*       __restrict__ by     = By + i*sBy;
+        const double* __restrict__ ez_im2 = ez - 2*sEz;
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_p-1 ; j++) {
-            (*By2D)(i,j) += dt_ov_dx * ( Beta_y*((*Ez2D)(i,j) - (*Ez2D)(i-1,j)) +beta_y*((*Ez2D)(i,j+1)- (*Ez2D)(i-1,j+1) +(*Ez2D)(i,j-1)- (*Ez2D)(i-1,j-1) ) +delta_x*( (*Ez2D)(i+1,j) - (*Ez2D)(i-2,j)));
+            by[j] += dtdx * ( Betay*(ez[j] - ez_im[j]) + betay*( ez[j+1] - ez_im[j+1] + ez[j-1] - ez_im[j-1] ) + delta * ( ez_ip[j] - ez_im2[j] ) );
         }
-        //(*By2D)(i,0) += dt_ov_dx *( (1-2*beta_y)*((*Ez2D)(i,0) - (*Ez2D)(i-1,0)) +beta_y*((*Ez2D)(i,1)- (*Ez2D)(i-1,1) +(*Ez2D)(i,ny_p-1)- (*Ez2D)(i-1,ny_p-1) ) );
-        //(*By2D)(i,ny_p-1) += dt_ov_dx * ( (1-2*beta_y)*((*Ez2D)(i,ny_p-1) - (*Ez2D)(i-1,ny_p-1)) +beta_y*((*Ez2D)(i,0)- (*Ez2D)(i-1,0) +(*Ez2D)(i,ny_p-2)- (*Ez2D)(i-1,ny_p-2) ) );
-    
-    
-    // Magnetic field Bz^(d,d)
-    //for (unsigned int i=1 ; i<nx_d-1 ; i++) {
+        
+        // Magnetic field Bz^(d,d)
+        double*       __restrict__ bz     = Bz + i*sBz;
+        const double* __restrict__ ex     = Ex + i*sEx;
+        const double* __restrict__ ex_ip  = ex + sEx;
+        const double* __restrict__ ex_im  = ex - sEx;
+        const double* __restrict__ ey     = Ey + i*sEy;
+        const double* __restrict__ ey_im  = ey - sEy;
+        const double* __restrict__ ey_ip  = ey + sEy;
+        const double* __restrict__ ey_im2 = ey - 2*sEy;
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bz2D)(i,j) += dt_ov_dy * (Beta_x*( (*Ex2D)(i,j) - (*Ex2D)(i,j-1) ) +beta_x*((*Ex2D)(i+1,j)- (*Ex2D)(i+1,j-1)+ (*Ex2D)(i-1,j)- (*Ex2D)(i-1,j-1)))
-            -               dt_ov_dx * (Beta_y*( (*Ey2D)(i,j) - (*Ey2D)(i-1,j) ) +beta_y*((*Ey2D)(i,j+1)- (*Ey2D)(i-1,j+1)+ (*Ey2D)(i,j-1)- (*Ey2D)(i-1,j-1)) +delta_x*( (*Ey2D)(i+1,j) - (*Ey2D)(i-2,j)));
+            bz[j] += dtdy * ( Betax*(ex[j] - ex[j-1]) + betax*( ex_ip[j] - ex_ip[j-1] + ex_im[j] - ex_im[j-1] ) )
+            -        dtdx * ( Betay*(ey[j] - ey_im[j]) + betay*( ey[j+1] - ey_im[j+1] + ey[j-1] - ey_im[j-1] ) + delta * ( ey_ip[j] - ey_im2[j] ) );
         }
     }
-//}// end parallel
 }//END solveMaxwellFaraday
 
-
-
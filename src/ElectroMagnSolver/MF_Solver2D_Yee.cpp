@@ -13,6 +13,11 @@ MF_Solver2D_Yee::~MF_Solver2D_Yee()
 {
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Maxwell-Faraday equation on the flat arrays of the fields
+//   All components are updated in a single sweep along the 1st direction : the rows i and i-1 of the electric field
+//   are loaded once for Bx, By and Bz, and the inner loops along the 2nd direction are vectorized.
+// ---------------------------------------------------------------------------------------------------------------------
 void MF_Solver2D_Yee::operator() ( ElectroMagn* fields )
 {
     // Static-cast of the fields
@@ -23,35 +28,44 @@ void MF_Solver2D_Yee::operator() ( ElectroMagn* fields )
     Field2D* By2D = static_cast<Field2D*>(fields->By_);
     Field2D* Bz2D = static_cast<Field2D*>(fields->Bz_);
     
-    // Magnetic field Bx^(p,d)
-    //cout << "nx_p,nx_d-1" << nx_p << " " << nx_d-1 ;
-    //{
-    {
-        for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bx2D)(0,j) -= dt_ov_dy * ( (*Ez2D)(0,j) - (*Ez2D)(0,j-1) );
-        }
-    }
-    //    for (unsigned int i=0 ; i<nx_p;  i++) {
-    for (unsigned int i=1 ; i<nx_d-1;  i++) {
+    const double* __restrict__ Ex = Ex2D->data();
+    const double* __restrict__ Ey = Ey2D->data();
+    const double* __restrict__ Ez = Ez2D->data();
+    double* __restrict__ Bx = Bx2D->data();
+    double* __restrict__ By = By2D->data();
+    double* __restrict__ Bz = Bz2D->data();
+    const unsigned int sEx = Ex2D->stride(), sEy = Ey2D->stride(), sEz = Ez2D->stride();
+    const unsigned int sBx = Bx2D->stride(), sBy = By2D->stride(), sBz = Bz2D->stride();
+    const double dtdx = dt_ov_dx, dtdy = dt_ov_dy;
+    
+    for (unsigned int i=0 ; i<nx_d-1 ; i++) {
+        // Magnetic field Bx^(p,d)
+        double*       __restrict__ bx = Bx + i*sBx;
+        const double* __restrict__ ez = Ez + i*sEz;
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bx2D)(i,j) -= dt_ov_dy * ( (*Ez2D)(i,j) - (*Ez2D)(i,j-1) );
+            bx[j] -= dtdy * ( ez[j] - ez[j-1] );
         }
-        //    }
+        if (i==0) continue;
         
         // Magnetic field By^(d,p)
-        //    for (unsigned int i=1 ; i<nx_d-1 ; i++) {
+        double*       __restrict__ by    = By + i*sBy;
+        const double* __restrict__ ez_im = ez - sEz;
+        #pragma omp simd
         for (unsigned int j=0 ; j<ny_p ; j++) {
-            (*By2D)(i,j) += dt_ov_dx * ( (*Ez2D)(i,j) - (*Ez2D)(i-1,j) );
+            by[j] += dtdx * ( ez[j] - ez_im[j] );
         }
-        //}
         
         // Magnetic field Bz^(d,d)
-        //for (unsigned int i=1 ; i<nx_d-1 ; i++) {
+        double*       __restrict__ bz    = Bz + i*sBz;
+        const double* __restrict__ ex    = Ex + i*sEx;
+        const double* __restrict__ ey    = Ey + i*sEy;
+        const double* __restrict__ ey_im = ey - sEy;
+        #pragma omp simd
         for (unsigned int j=1 ; j<ny_d-1 ; j++) {
-            (*Bz2D)(i,j) += dt_ov_dy * ( (*Ex2D)(i,j) - (*Ex2D)(i,j-1) )
-            -               dt_ov_dx * ( (*Ey2D)(i,j) - (*Ey2D)(i-1,j) );
+            bz[j] += dtdy * ( ex[j] - ex[j-1] )
+            -        dtdx * ( ey[j] - ey_im[j] );
         }
     }
-    //}// end parallel
 }
 
@@ -4,6 +4,8 @@
 #include <vector>
 #include <cstring>
 
+#include "AlignedVector.h"
+
 using namespace std;
 
 
@@ -55,7 +57,7 @@ Field2D::~Field2D()
 {
 
     if (data_!=NULL) {
-        delete [] data_;
+        AlignedAllocator<double>().deallocate(data_, globalDims_);
         delete [] data_2D;
     }
 }
@@ -69,11 +71,15 @@ void Field2D::allocateDims(std::vector<unsigned int> dims )
     //! \todo{Comment on what you are doing here (MG for JD)}
     dims_=dims;
     if (dims_.size()!=2) ERROR("Alloc error must be 2 : " << dims.size());
-    if (data_!=NULL) delete [] data_;
+    if (data_!=NULL) {
+        AlignedAllocator<double>().deallocate(data_, globalDims_);
+        delete [] data_2D;
+    }
 
     isDual_.resize( dims.size(), 0 );
 
-    data_ = new double[dims_[0]*dims_[1]];
+    // rows are contiguous (stride = dims_[1]), the array starts on a cache line and is padded to whole cache lines
+    data_ = AlignedAllocator<double>().allocate(dims_[0]*dims_[1]);
     //! \todo{check row major order!!! (JD)}
 
     data_2D= new double*[dims_[0]];
@@ -88,7 +94,7 @@ void Field2D::allocateDims(std::vector<unsigned int> dims )
 
 void Field2D::deallocateDims()
 {
-    delete [] data_;
+    AlignedAllocator<double>().deallocate(data_, globalDims_);
     data_ = NULL;
     delete [] data_2D;
     data_2D = NULL;
@@ -111,7 +117,10 @@ void Field2D::allocateDims(std::vector<unsigned int> dims, unsigned int mainDim,
     //! \todo{Comment on what you are doing here (MG for JD)}
     dims_=dims;
     if (dims_.size()!=2) ERROR("Alloc error must be 2 : " << dims.size());
-    if (data_) delete [] data_;
+    if (data_) {
+        AlignedAllocator<double>().deallocate(data_, globalDims_);
+        delete [] data_2D;
+    }
     
     // isPrimal define if mainDim is Primal or Dual
     isDual_.resize( dims.size(), 0 );
@@ -125,7 +134,8 @@ void Field2D::allocateDims(std::vector<unsigned int> dims, unsigned int mainDim,
     for ( unsigned int j=0 ; j<dims.size() ; j++ )
         dims_[j] += isDual_[j];
     
-    data_ = new double[dims_[0]*dims_[1]];
+    // rows are contiguous (stride = dims_[1]), the array starts on a cache line and is padded to whole cache lines
+    data_ = AlignedAllocator<double>().allocate(dims_[0]*dims_[1]);
     //! \todo{check row major order!!! (JD)}
     
     data_2D= new double*[dims_[0]];
@@ -4,6 +4,7 @@
 #include <cmath>
 
 #include <vector>
+#include <algorithm>
 
 #include "Field.h"
 
@@ -70,6 +71,20 @@ public:
     //! this will present the data as a 2d matrix
     double **data_2D;
     
+    //! Number of elements between (i,j) and (i+1,j) in the linearized array data_ : the row length dims_[1], not
+    //! padded (only data_ itself is aligned on SMILEI_ALIGNMENT bytes, the other rows are in general not).
+    //! Kernels should index data_ with this stride rather than going through data_2D or operator()
+    inline unsigned int stride() const {
+        return dims_[1];
+    }
+    
+    //! Exchange the arrays of two fields with the same dimensions, without copying them
+    //! (the Field objects themselves, which are referenced by the diagnostics, are left in place)
+    inline void swapData( Field2D* f ) {
+        std::swap( data_  , f->data_   );
+        std::swap( data_2D, f->data_2D );
+    }
+    
     virtual double norm2(unsigned int istart[3][2], unsigned int bufsize[3][2]);
 
 private:
@@ -19,10 +19,16 @@ public:
     Interpolator(Params& params, Patch* patch);
     virtual ~Interpolator() {};
     
-    virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread) = 0;
+    //! Interpolate the fields of particles istart to iend in the thread buffers of smpi,
+    //!   particle ipart being stored at index ipart-ipart_ref
+    virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref = 0) = 0;
     
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) = 0;
 
+protected:
+    //! Number of particles whose interpolation coefficients are computed at once by the vectorized interpolations
+    static const int vecsize = 32;
+
 private:
 
 };//END class
@@ -14,10 +14,24 @@ public:
     
     virtual ~Interpolator1D() override {};
     
-    virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread) override = 0;
+    virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref) override = 0;
     virtual void operator() (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) override = 0;
 
 protected:
+    //! Interpolate the field f for np particles, nodes idx-nodes/2 to idx+nodes/2 of particle ip being weighted
+    //!   by coeff[inode*vecsize+ip]. The result of particle ip is written in res[ip].
+    template<int nodes>
+    inline void computeBlock( double* coeff, int* idx, Field* f, double* res, int np ) {
+        double* data = f->data_;
+        #pragma omp simd
+        for (int ip=0 ; ip<np ; ip++) {
+            double interp_res(0.);
+            for (int inode=0 ; inode<nodes ; inode++)
+                interp_res += coeff[inode*vecsize+ip] * data[ idx[ip]+inode-nodes/2 ];
+            res[ip] = interp_res;
+        }
+    };
+    
     //! Inverse of the spatial-step
     double dx_inv_;
     unsigned int index_domain_begin;
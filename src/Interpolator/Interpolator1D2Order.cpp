@@ -98,20 +98,66 @@ void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particl
     
 }
 
-void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+// ---------------------------------------------------------------------------------------------------------------------
+// Interpolation of the fields of particles istart to iend-1, vectorized over blocks of vecsize particles
+//   The coefficients of all the particles of a block are computed first (SoA arrays), then each field is gathered
+//   for the whole block in the aligned component arrays of smpi->dynamics_Epart and dynamics_Bpart.
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator1D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
-    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
-    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
-    
-    //Loop on bin particles
-    for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
-        //Buffering of iol and delta
-        (*iold)[ipart] = ip_;
-        (*delta)[ipart] = xjmxi;
+    double* Epart[3], *Bpart[3];
+    for (unsigned int i=0 ; i<3 ; i++) {
+        Epart[i] = smpi->dynamics_Epart[ithread][i].data() + (istart-ipart_ref);
+        Bpart[i] = smpi->dynamics_Bpart[ithread][i].data() + (istart-ipart_ref);
+    }
+    int*    iold     = smpi->dynamics_iold[ithread].data()     + (istart-ipart_ref);
+    double* deltaold = smpi->dynamics_deltaold[ithread].data() + (istart-ipart_ref);
+    
+    double* position_x = particles.position(0).data();
+    
+    // Interpolation coefficients and indexes of the central nodes, stored as [node][particle]
+    double coeffp[3*vecsize], coeffd[3*vecsize];
+    int idxp[vecsize], idxd[vecsize];
+    
+    for (int ivect=istart ; ivect<iend ; ivect+=vecsize) {
+        int np = min( vecsize, iend-ivect );
+        int ib = ivect-istart;
+        
+        #pragma omp simd
+        for (int ip=0 ; ip<np ; ip++) {
+            // Particle position (in units of the spatial-step)
+            double xjn = position_x[ivect+ip]*dx_inv_;
+            double xjmxi, xjmxi2;
+            
+            // Dual grid : Ex, By, Bz
+            int idn = round(xjn+0.5);
+            xjmxi  = xjn - (double)idn +0.5;
+            xjmxi2 = xjmxi*xjmxi;
+            coeffd[          ip] = 0.5 * (xjmxi2-xjmxi+0.25);
+            coeffd[  vecsize+ip] = (0.75-xjmxi2);
+            coeffd[2*vecsize+ip] = 0.5 * (xjmxi2+xjmxi+0.25);
+            idxd[ip] = idn - index_domain_begin;
+            
+            // Primal grid : Ey, Ez, Bx
+            int ipn = round(xjn);
+            xjmxi  = xjn -(double)ipn;
+            xjmxi2 = xjmxi*xjmxi;
+            coeffp[          ip] = 0.5 * (xjmxi2-xjmxi+0.25);
+            coeffp[  vecsize+ip] = (0.75-xjmxi2);
+            coeffp[2*vecsize+ip] = 0.5 * (xjmxi2+xjmxi+0.25);
+            idxp[ip] = ipn - index_domain_begin;
+            
+            //Buffering of iold and delta
+            iold    [ib+ip] = idxp[ip];
+            deltaold[ib+ip] = xjmxi;
+        }
+        
+        computeBlock<3>( coeffd, idxd, EMfields->Ex_ , Epart[0]+ib, np );
+        computeBlock<3>( coeffd, idxd, EMfields->By_m, Bpart[1]+ib, np );
+        computeBlock<3>( coeffd, idxd, EMfields->Bz_m, Bpart[2]+ib, np );
+        computeBlock<3>( coeffp, idxp, EMfields->Ey_ , Epart[1]+ib, np );
+        computeBlock<3>( coeffp, idxp, EMfields->Ez_ , Epart[2]+ib, np );
+        computeBlock<3>( coeffp, idxp, EMfields->Bx_m, Bpart[0]+ib, np );
     }
     
 }
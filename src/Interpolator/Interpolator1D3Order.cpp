@@ -104,20 +104,28 @@ void Interpolator1D3Order::operator() (ElectroMagn* EMfields, Particles &particl
     (*JLoc).x = compute(coeffd_, Jx1D,  id_);  
     
 }
-void Interpolator1D3Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+void Interpolator1D3Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
+    std::vector<AlignedVector<double>> *Epart = &(smpi->dynamics_Epart[ithread]);
+    std::vector<AlignedVector<double>> *Bpart = &(smpi->dynamics_Bpart[ithread]);
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
     
+    LocalFields ELoc, BLoc;
+    
     //Loop on bin particles
     for (int ipart=istart ; ipart<iend; ipart++ ) {
         //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
-        //Buffering of iol and delta
-        (*iold)[ipart] = ip_;
-        (*delta)[ipart] = xi;
+        (*this)(EMfields, particles, ipart, &ELoc, &BLoc);
+        //Buffering of the fields, iol and delta
+        (*Epart)[0][ipart-ipart_ref] = ELoc.x;
+        (*Epart)[1][ipart-ipart_ref] = ELoc.y;
+        (*Epart)[2][ipart-ipart_ref] = ELoc.z;
+        (*Bpart)[0][ipart-ipart_ref] = BLoc.x;
+        (*Bpart)[1][ipart-ipart_ref] = BLoc.y;
+        (*Bpart)[2][ipart-ipart_ref] = BLoc.z;
+        (*iold)[ipart-ipart_ref] = ip_;
+        (*delta)[ipart-ipart_ref] = xi;
     }
     
 }
@@ -14,10 +14,26 @@ public:
 
     virtual ~Interpolator2D() override {} ;
 
-    virtual void operator()  (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread) override = 0  ;
+    virtual void operator()  (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref) override = 0  ;
     virtual void operator()  (ElectroMagn* EMfields, Particles &particles, int ipart, LocalFields* ELoc, LocalFields* BLoc, LocalFields* JLoc, double* RhoLoc) override = 0;
 
 protected:
+    //! Interpolate the field f for np particles, on nodes (idx-nodes/2 to idx+nodes/2, idy-nodes/2 to idy+nodes/2)
+    //!   weighted by coeffx[inode*vecsize+ip]*coeffy[jnode*vecsize+ip]. The result of particle ip is written in res[ip].
+    template<int nodes>
+    inline void computeBlock( double* coeffx, double* coeffy, int* idx, int* idy, Field* f, double* res, int np ) {
+        double* data = f->data_;
+        int ny = f->dims_[1];
+        #pragma omp simd
+        for (int ip=0 ; ip<np ; ip++) {
+            double interp_res(0.);
+            for (int inode=0 ; inode<nodes ; inode++)
+                for (int jnode=0 ; jnode<nodes ; jnode++)
+                    interp_res += coeffx[inode*vecsize+ip] * coeffy[jnode*vecsize+ip] * data[ (idx[ip]+inode-nodes/2)*ny + idy[ip]+jnode-nodes/2 ];
+            res[ip] = interp_res;
+        }
+    };
+    
     //! Inverse of the spatial-step
     double dx_inv_;
     double dy_inv_;
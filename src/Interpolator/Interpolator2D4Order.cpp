@@ -183,22 +183,103 @@ void Interpolator2D4Order::operator() (ElectroMagn* EMfields, Particles &particl
     (*RhoLoc) = compute( &coeffxp_[2], &coeffyp_[2], Rho2D, ip_, jp_);
     
 }
-void Interpolator2D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+// ---------------------------------------------------------------------------------------------------------------------
+// Interpolation of the fields of particles istart to iend-1, vectorized over blocks of vecsize particles
+//   The coefficients of all the particles of a block are computed first (SoA arrays), then each field is gathered
+//   for the whole block in the aligned component arrays of smpi->dynamics_Epart and dynamics_Bpart.
+// ---------------------------------------------------------------------------------------------------------------------
+void Interpolator2D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
-    std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
-    std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
-    
-    //Loop on bin particles
-    for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //Interpolation on current particle
-        (*this)(EMfields, particles, ipart, &(*Epart)[ipart], &(*Bpart)[ipart]);
-        //Buffering of iol and delta
-        (*iold)[ipart*2] = ip_;
-        (*iold)[ipart*2+1] = jp_;
-        (*delta)[ipart*2] = deltax;
-        (*delta)[ipart*2+1] = deltay;
+    double* Epart[3], *Bpart[3];
+    for (unsigned int i=0 ; i<3 ; i++) {
+        Epart[i] = smpi->dynamics_Epart[ithread][i].data() + (istart-ipart_ref);
+        Bpart[i] = smpi->dynamics_Bpart[ithread][i].data() + (istart-ipart_ref);
+    }
+    int*    iold     = smpi->dynamics_iold[ithread].data()     + 2*(istart-ipart_ref);
+    double* deltaold = smpi->dynamics_deltaold[ithread].data() + 2*(istart-ipart_ref);
+    
+    double* position_x = particles.position(0).data();
+    double* position_y = particles.position(1).data();
+    
+    // Interpolation coefficients and indexes of the central nodes, stored as [node][particle]
+    double cxp[5*vecsize], cxd[5*vecsize], cyp[5*vecsize], cyd[5*vecsize];
+    int idxp[vecsize], idxd[vecsize], idyp[vecsize], idyd[vecsize];
+    
+    for (int ivect=istart ; ivect<iend ; ivect+=vecsize) {
+        int np = min( vecsize, iend-ivect );
+        int ib = ivect-istart;
+        
+        #pragma omp simd
+        for (int ip=0 ; ip<np ; ip++) {
+            // Normalized particle position
+            double xpn = position_x[ivect+ip]*dx_inv_;
+            double ypn = position_y[ivect+ip]*dy_inv_;
+            
+            // Indexes of the central nodes
+            int ipn = round(xpn);
+            int idn = round(xpn+0.5);
+            int jpn = round(ypn);
+            int jdn = round(ypn+0.5);
+            
+            double delta, delta2, delta3, delta4;
+            
+            delta   = xpn - (double)idn + 0.5;
+            delta2  = delta*delta;
+            delta3  = delta2*delta;
+            delta4  = delta3*delta;
+            cxd[          ip] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            cxd[  vecsize+ip] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cxd[2*vecsize+ip] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
+            cxd[3*vecsize+ip] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cxd[4*vecsize+ip] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            
+            delta   = xpn - (double)ipn;
+            delta2  = delta*delta;
+            delta3  = delta2*delta;
+            delta4  = delta3*delta;
+            cxp[          ip] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            cxp[  vecsize+ip] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cxp[2*vecsize+ip] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
+            cxp[3*vecsize+ip] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cxp[4*vecsize+ip] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            deltaold[2*(ib+ip)] = delta;
+            
+            delta   = ypn - (double)jdn + 0.5;
+            delta2  = delta*delta;
+            delta3  = delta2*delta;
+            delta4  = delta3*delta;
+            cyd[          ip] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            cyd[  vecsize+ip] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cyd[2*vecsize+ip] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
+            cyd[3*vecsize+ip] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cyd[4*vecsize+ip] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            
+            delta   = ypn - (double)jpn;
+            delta2  = delta*delta;
+            delta3  = delta2*delta;
+            delta4  = delta3*delta;
+            cyp[          ip] = dble_1_ov_384   - dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 - dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            cyp[  vecsize+ip] = dble_19_ov_96   - dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  + dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cyp[2*vecsize+ip] = dble_115_ov_192 - dble_5_ov_8   * delta2 + dble_1_ov_4 * delta4;
+            cyp[3*vecsize+ip] = dble_19_ov_96   + dble_11_ov_24 * delta  + dble_1_ov_4 * delta2  - dble_1_ov_6  * delta3 - dble_1_ov_6  * delta4;
+            cyp[4*vecsize+ip] = dble_1_ov_384   + dble_1_ov_48  * delta  + dble_1_ov_16 * delta2 + dble_1_ov_12 * delta3 + dble_1_ov_12 * delta4;
+            deltaold[2*(ib+ip)+1] = delta;
+            
+            // First index for summation
+            idxp[ip] = ipn - i_domain_begin;
+            idxd[ip] = idn - i_domain_begin;
+            idyp[ip] = jpn - j_domain_begin;
+            idyd[ip] = jdn - j_domain_begin;
+            iold[2*(ib+ip)]   = idxp[ip];
+            iold[2*(ib+ip)+1] = idyp[ip];
+        }
+        
+        computeBlock<5>( cxd, cyp, idxd, idyp, EMfields->Ex_ , Epart[0]+ib, np ); // Ex^(d,p)
+        computeBlock<5>( cxp, cyd, idxp, idyd, EMfields->Ey_ , Epart[1]+ib, np ); // Ey^(p,d)
+        computeBlock<5>( cxp, cyp, idxp, idyp, EMfields->Ez_ , Epart[2]+ib, np ); // Ez^(p,p)
+        computeBlock<5>( cxp, cyd, idxp, idyd, EMfields->Bx_m, Bpart[0]+ib, np ); // Bx^(p,d)
+        computeBlock<5>( cxd, cyp, idxd, idyp, EMfields->By_m, Bpart[1]+ib, np ); // By^(d,p)
+        computeBlock<5>( cxd, cyd, idxd, idyd, EMfields->Bz_m, Bpart[2]+ib, np ); // Bz^(d,d)
     }
 
 }
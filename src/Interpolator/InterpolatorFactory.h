@@ -13,6 +13,8 @@
 
 #include "Tools.h"
 
+//! Each interpolator class is written for one (dimension, order) : the class selected here, once per patch, is
+//! only called through one virtual call per bin (the pushers are templated on the dimension instead, see PusherBoris)
 class InterpolatorFactory {
 public:
     static Interpolator* create(Params& params, Patch *patch) {
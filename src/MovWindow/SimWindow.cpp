@@ -13,6 +13,8 @@
 #include <omp.h>
 #include <fstream>
 #include <limits>
+#include <algorithm>
+#include <cmath>
 
 using namespace std;
 
@@ -24,6 +26,7 @@ SimWindow::SimWindow(Params& params)
     active = false;
     time_start = numeric_limits<double>::max();
     velocity_x = 1.;
+    profile_sampling = 0;
     
     if( PyTools::nComponents("MovingWindow") ) {
         active = true;
@@ -31,6 +34,10 @@ SimWindow::SimWindow(Params& params)
         PyTools::extract("time_start",time_start, "MovingWindow");
         
         PyTools::extract("velocity_x",velocity_x, "MovingWindow");
+        
+        PyTools::extract("profile_sampling",profile_sampling, "MovingWindow");
+        if( profile_sampling<0 )
+            ERROR("MovingWindow: profile_sampling must be positive");
     }
     
     cell_length_x_   = params.cell_length[0];
@@ -41,6 +48,8 @@ SimWindow::SimWindow(Params& params)
         MESSAGE(1,"Moving window is active:");
         MESSAGE(2,"velocity_x : " << velocity_x);
         MESSAGE(2,"time_start : " << time_start);
+        if( profile_sampling>0 )
+            MESSAGE(2,"python profiles tabulated every " << profile_sampling << " cells for the new patches");
     }
     
 }
@@ -76,13 +85,17 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
         vecPatches(ipatch)->hindex = vecPatches(ipatch)->neighbor_[0][0];
     }
     // Init new patches (really new and received)
+    vector<unsigned int> newPatches;
     for (int ipatch = 0 ; ipatch < nPatches ; ipatch++) {
-
-        if ( vecPatches(ipatch)->MPI_me_ != vecPatches(ipatch)->MPI_neighbor_[0][1] ) {
-            int patchid = vecPatches(ipatch)->neighbor_[0][1];
-            Patch* newPatch = PatchesFactory::clone(vecPatches(0),params, smpi, patchid, n_moved );
-            vecPatches.patches_.push_back( newPatch );
-        }
+        if ( vecPatches(ipatch)->MPI_me_ != vecPatches(ipatch)->MPI_neighbor_[0][1] )
+            newPatches.push_back( vecPatches(ipatch)->neighbor_[0][1] );
+    }
+    if( profile_sampling>0 && newPatches.size()>0 )
+        tabulateProfiles(vecPatches(0), newPatches, params);
+    for (unsigned int i = 0 ; i < newPatches.size() ; i++) {
+        Patch* newPatch = PatchesFactory::clone(vecPatches(0),params, smpi, newPatches[i], n_moved );
+        newPatch->EMfields->initAntennas(newPatch);
+        vecPatches.patches_.push_back( newPatch );
     }
 
     for ( int ipatch = nPatches-1 ; ipatch >= 0 ; ipatch--) {
@@ -142,6 +155,7 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
 
     //Wait for all send to be completed by the receivers too.
     //MPI_Barrier(MPI_COMM_WORLD);
+    smpi->waitPatchSends();
     smpi->barrier();
 
     // Suppress after exchange to not distrub patch position during exchange
@@ -196,6 +210,7 @@ void SimWindow::operate(VectorPatch& vecPatches, SmileiMPI* smpi, Params& params
     }
     
     vecPatches.set_refHindex() ;
+    vecPatches.init_neighbor_cache() ;
     vecPatches.update_field_list() ;
     
     return;
@@ -207,3 +222,63 @@ bool SimWindow::isMoving(double time_dual)
     return ((time_dual - time_start)*velocity_x > x_moved);
 }
 
+
+// Tabulate the python profiles needed to initialize the new patches (particles and antennas),
+// on the area covered by these patches. They are thus evaluated once for all the new patches of
+// this process, and the table is replaced at the next move.
+void SimWindow::tabulateProfiles(Patch* patch, vector<unsigned int>& newPatches, Params& params)
+{
+    unsigned int nDim = params.nDim_field;
+    vector<double> xmin(nDim, numeric_limits<double>::max()), xmax(nDim, -numeric_limits<double>::max());
+    unsigned int Pcoordinates[2];
+    for (unsigned int i = 0 ; i < newPatches.size() ; i++) {
+        if( nDim==1 )
+            Pcoordinates[0] = newPatches[i];
+        else
+            generalhilbertindexinv(params.mi[0], params.mi[1], &Pcoordinates[0], &Pcoordinates[1], newPatches[i]);
+        for (unsigned int idim = 0 ; idim < nDim ; idim++) {
+            double min_local = Pcoordinates[idim]*params.n_space[idim]*params.cell_length[idim];
+            if( idim==0 ) min_local += n_moved*params.cell_length[0];
+            xmin[idim] = min( xmin[idim], min_local );
+            xmax[idim] = max( xmax[idim], min_local + params.n_space[idim]*params.cell_length[idim] );
+        }
+    }
+    
+    // Nodes every profile_sampling cells, starting at a cell center, and covering the ghost cells
+    vector<double> step(nDim);
+    vector<unsigned int> n(nDim);
+    for (unsigned int idim = 0 ; idim < nDim ; idim++) {
+        xmin[idim] -= (params.oversize[idim]+1.5)*params.cell_length[idim];
+        xmax[idim] += (params.oversize[idim]+1)*params.cell_length[idim];
+        step[idim] = profile_sampling*params.cell_length[idim];
+        n[idim] = (unsigned int)ceil( (xmax[idim]-xmin[idim])/step[idim] ) + 1;
+    }
+    
+    vector<Profile*> profiles;
+    for (unsigned int ispec=0 ; ispec<patch->vecSpecies.size() ; ispec++) {
+        Species* species = patch->vecSpecies[ispec];
+        profiles.push_back( species->densityProfile );
+        profiles.push_back( species->ppcProfile     );
+        profiles.push_back( species->chargeProfile  );
+        for (unsigned int i=0 ; i<3 ; i++) {
+            profiles.push_back( species->velocityProfile   [i] );
+            profiles.push_back( species->temperatureProfile[i] );
+        }
+    }
+    
+    // Built-in profiles are faster to evaluate than to interpolate
+    for (unsigned int i=0 ; i<profiles.size() ; i++)
+        if( profiles[i]->usesPython() )
+            profiles[i]->tabulate(xmin, step, n);
+    
+    // The antennas are evaluated on the grid of their field : the nodes are moved by half a cell
+    // in the primal directions, so that they fall on the field points
+    for (unsigned int i=0 ; i<patch->EMfields->antennas.size() ; i++) {
+        Antenna& antenna = patch->EMfields->antennas[i];
+        if( !antenna.field || !antenna.space_profile->usesPython() ) continue;
+        vector<double> xmin_field = xmin;
+        for (unsigned int idim = 0 ; idim < nDim ; idim++)
+            if( !antenna.field->isDual(idim) ) xmin_field[idim] += 0.5*params.cell_length[idim];
+        antenna.space_profile->tabulate(xmin_field, step, n);
+    }
+}
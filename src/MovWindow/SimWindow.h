@@ -61,6 +61,11 @@ class SimWindow {
     double time_start;
     //! Keep track of old patches assignement
     std::vector<Patch*> vecPatches_old;
+    //! Number of cells between the nodes of the profile tables (0 if profiles are not tabulated)
+    int profile_sampling;
+    
+    //! Tabulate the python profiles of patch on the area of the patches to be created
+    void tabulateProfiles(Patch* patch, std::vector<unsigned int>& newPatches, Params& params);
 
 };
 
@@ -229,6 +229,10 @@ namelist("")
     if (!PyTools::extract("clrw",clrw, "Main")) {
         clrw = 1;
     }
+    
+    PyTools::extract("dynamics_block_size", dynamics_block_size, "Main");
+    if (dynamics_block_size < 0)
+        ERROR("The parameter dynamics_block_size must be positive (0 to disable the fused particle dynamics)");
         
     // --------------------
     // Number of patches
@@ -253,14 +257,39 @@ namelist("")
     }
     
     
+    aggregate_mpi_messages = false;
+    PyTools::extract("aggregate_mpi_messages", aggregate_mpi_messages, "Main");
+    
+    mpi_shared_memory = false;
+    PyTools::extract("mpi_shared_memory", mpi_shared_memory, "Main");
+    if (mpi_shared_memory && !aggregate_mpi_messages) {
+        WARNING("mpi_shared_memory requires aggregate_mpi_messages, which is enabled");
+        aggregate_mpi_messages = true;
+    }
+    
+    largest_patches_first = false;
+    PyTools::extract("largest_patches_first", largest_patches_first, "Main");
+    
     balancing_every = 150;
     coef_cell = 1.;
     coef_frozen = 0.1;
+    measured_cost = false;
+    max_migrating_patches = 0;
+    node_aware = false;
+    internode_tolerance = 0.05;
     if( PyTools::nComponents("LoadBalancing")>0 ) {
-        PyTools::extract("every"      , balancing_every, "LoadBalancing");
-        PyTools::extract("coef_cell"  , coef_cell      , "LoadBalancing");
-        PyTools::extract("coef_frozen", coef_frozen    , "LoadBalancing");
+        PyTools::extract("every"        , balancing_every, "LoadBalancing");
+        PyTools::extract("coef_cell"    , coef_cell      , "LoadBalancing");
+        PyTools::extract("coef_frozen"  , coef_frozen    , "LoadBalancing");
+        PyTools::extract("measured_cost", measured_cost  , "LoadBalancing");
+        PyTools::extract("max_migrating_patches", max_migrating_patches, "LoadBalancing");
+        PyTools::extract("node_aware"   , node_aware     , "LoadBalancing");
+        PyTools::extract("internode_tolerance", internode_tolerance, "LoadBalancing");
     }
+    if (internode_tolerance < 0.)
+        ERROR("LoadBalancing.internode_tolerance must be positive or zero");
+    if (max_migrating_patches < 0)
+        ERROR("LoadBalancing.max_migrating_patches must be positive or zero");
     
     //mi.resize(nDim_field, 0);
     mi.resize(3, 0);
@@ -405,6 +434,12 @@ void Params::print()
     MESSAGE(1,"Load balancing every " << balancing_every << " iterations.");
     MESSAGE(1,"Cell load coefficient = " << coef_cell );
     MESSAGE(1,"Frozen particle load coefficient = " << coef_frozen );
+    if (measured_cost)
+        MESSAGE(1,"Loads of the patches measured between two load balancings");
+    if (max_migrating_patches > 0)
+        MESSAGE(1,"At most " << max_migrating_patches << " patches migrating between two MPI processes per iteration");
+    if (node_aware)
+        MESSAGE(1,"Balanced between nodes (tolerance = " << internode_tolerance << "), then between the processes of each node");
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -93,6 +93,8 @@ public:
     //! Clusters width
     //unsigned int clrw;
     int clrw;
+    //! Number of particles processed at once through interpolation, push and projection (0 : whole bins, stage by stage)
+    int dynamics_block_size;
     //! Number of cells per cluster
     int n_cell_per_patch;
     
@@ -138,12 +140,26 @@ public:
     int tot_number_of_patches;
     //! Number of patches per direction
     std::vector<int> number_of_patches;
+    //! Ghost cells and particles exchanged with a neighbor MPI process in a single message per direction
+    bool aggregate_mpi_messages;
+    //! Aggregated messages to the processes of the same node copied through MPI shared memory windows
+    bool mpi_shared_memory;
+    //! Patches handed to the OpenMP threads by decreasing cost instead of the Hilbert order
+    bool largest_patches_first;
     //! Load balancing frequency
     int balancing_every;
     //! Load coefficient applied to a cell (default = 1)
     double coef_cell;
     //! Load coefficient applied to a frozen particle (default = 0.1)
     double coef_frozen;
+    //! Load of the patches measured (time spent in each patch) instead of estimated from the particles and cells
+    bool measured_cost;
+    //! Maximum number of patches moved between two consecutive MPI processes per timestep (0 = no limit)
+    int max_migrating_patches;
+    //! Load balanced between the nodes first, then between the processes of each node
+    bool node_aware;
+    //! Relative load imbalance between two consecutive nodes under which no patch moves between them
+    double internode_tolerance;
     //! Return if number of patch = number of MPI process, to tune IO //ism
     bool one_patch_per_MPI;
     
@@ -65,6 +65,9 @@ Patch::Patch(Patch* patch, Params& params, SmileiMPI* smpi, unsigned int ipatch,
 
 void Patch::initStep1(Params& params)
 {
+    load_time  = 0.;
+    load_steps = 0;
+    
     // for nDim_fields = 1 : bug if Pcoordinates.size = 1 !! 
     //Pcoordinates.resize(nDim_fields_);
     Pcoordinates.resize( 2 );
@@ -275,13 +278,19 @@ void Patch::initExchParticles(SmileiMPI* smpi, int ispec, Params& params)
 void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
 {
     int h0 = (*vecPatch)(0)->hindex;
+    // If aggregated, the numbers of particles are sent by AggregatedMPIbuffers::exchangeParticleCounts
+    bool aggregated = vecPatch->aggregatedMPIbuff.enabled;
     /********************************************************************************/
     // Exchange number of particles to exchange to establish or not a communication
     /********************************************************************************/
     for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
         if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) {
             vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor] = (vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor]).size();
-            if (is_a_MPI_neighbor(iDim, iNeighbor)) {
+            if (aggregated) {
+                if (!is_a_MPI_neighbor(iDim, iNeighbor))
+                    (*vecPatch)( neighbor_[iDim][iNeighbor]- h0 )->vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2] = vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor];
+            }
+            else if (is_a_MPI_neighbor(iDim, iNeighbor)) {
                 //If neighbour is MPI ==> I send him the number of particles I'll send later.
                 int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
                       MPI_Isend( &(vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor]), 1, MPI_INT, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
@@ -292,7 +301,7 @@ void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iD
             }
         } // END of Send
 
-        if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) {
+        if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL && !aggregated) {
             if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
                 //If other neighbour is MPI ==> I receive the number of particles I'll receive later.
                 int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1, iNeighbor+3 );
@@ -311,12 +320,13 @@ void Patch::initCommParticles(SmileiMPI* smpi, int ispec, Params& params, int iD
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim, VectorPatch * vecPatch)
 {
-    MPI_Datatype typePartSend, typePartRecv;
     Particles &cuParticles = (*vecSpecies[ispec]->particles);
 
     int n_part_send, n_part_recv;
     int h0 = (*vecPatch)(0)->hindex;
     double x_max = params.cell_length[iDim]*( params.n_space_global[iDim] );
+    // If aggregated, the particles are sent by AggregatedMPIbuffers::exchangeParticles from the send buffers
+    bool aggregated = vecPatch->aggregatedMPIbuff.enabled;
 
     /********************************************************************************/
     // Wait for end of communications over number of particles
@@ -325,12 +335,13 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
         MPI_Status sstat    [2];
         MPI_Status rstat    [2];
         if (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) {
-            if (is_a_MPI_neighbor(iDim, iNeighbor))
+            if (is_a_MPI_neighbor(iDim, iNeighbor) && !aggregated)
                 MPI_Wait( &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]), &(sstat[iNeighbor]) );
         }
         if (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) {
             if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2))  {
-                MPI_Wait( &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );
+                if (!aggregated)
+                    MPI_Wait( &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );
                 if (vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2]!=0) {
                     //If I receive particles over MPI, I initialize my receive buffer with the appropriate size.
                     vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2].initialize( vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2], cuParticles);
@@ -365,11 +376,14 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
                 // If MPI comm, first copy particles in the sendbuffer
                 for (int iPart=0 ; iPart<n_part_send ; iPart++) 
                     cuParticles.cp_particle(vecSpecies[ispec]->MPIbuff.part_index_send[iDim][iNeighbor][iPart], vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]);
-                // Then send particles
-                int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
-                typePartSend = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]) );
-                MPI_Isend( &((vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor]).position(0,0)), 1, typePartSend, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
-                MPI_Type_free( &typePartSend );
+                // Then pack and send particles
+                if (!aggregated) {
+                    int tag = buildtag( hindex, iDim+1, iNeighbor+3 );
+                    std::vector<char>& packed = vecSpecies[ispec]->MPIbuff.packedSend[iDim][iNeighbor];
+                    packed.resize( n_part_send*cuParticles.packedSize() );
+                    vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor].pack( &(packed[0]) );
+                    MPI_Isend( &(packed[0]), packed.size(), MPI_BYTE, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]) );
+                }
             }
             else {
                 //If not MPI comm, copy particles directly in the receive buffer
@@ -380,12 +394,12 @@ void Patch::CommParticles(SmileiMPI* smpi, int ispec, Params& params, int iDim,
                 
         n_part_recv = vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][(iNeighbor+1)%2];
         if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2)) {
-                // If MPI comm, receive particles in the recv buffer previously initialized.
-                typePartRecv = smpi->createMPIparticles( &(vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]) );
+            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2) && !aggregated) {
+                // If MPI comm, receive packed particles, unpacked in the recv buffer by finalizeCommParticles
+                std::vector<char>& packed = vecSpecies[ispec]->MPIbuff.packedRecv[iDim][(iNeighbor+1)%2];
+                packed.resize( n_part_recv*cuParticles.packedSize() );
                 int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+1 ,iNeighbor+3 );
-                MPI_Irecv( &((vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2]).position(0,0)), 1, typePartRecv, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
-                MPI_Type_free( &typePartRecv );
+                MPI_Irecv( &(packed[0]), packed.size(), MPI_BYTE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
             }
 
         } // END of Recv
@@ -429,6 +443,8 @@ void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, in
     }
 
     int n_part_send, n_part_recv, n_particles;
+    // If aggregated, the particles have already been received by AggregatedMPIbuffers::exchangeParticles
+    bool aggregated = vecPatch->aggregatedMPIbuff.enabled;
 
     /********************************************************************************/
     // Wait for end of communications over Particles
@@ -443,12 +459,14 @@ void Patch::finalizeCommParticles(SmileiMPI* smpi, int ispec, Params& params, in
 
  
         if ( (neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL) && (n_part_send!=0) ) {
-            if (is_a_MPI_neighbor(iDim, iNeighbor))
+            if (is_a_MPI_neighbor(iDim, iNeighbor) && !aggregated)
                 MPI_Wait( &(vecSpecies[ispec]->MPIbuff.srequest[iDim][iNeighbor]), &(sstat[iNeighbor]) );
         }
         if ( (neighbor_[iDim][(iNeighbor+1)%2]!=MPI_PROC_NULL) && (n_part_recv!=0) ) {
-            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2))
-                MPI_Wait( &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );     
+            if (is_a_MPI_neighbor(iDim, (iNeighbor+1)%2) && !aggregated) {
+                MPI_Wait( &(vecSpecies[ispec]->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]), &(rstat[(iNeighbor+1)%2]) );
+                vecSpecies[ispec]->MPIbuff.partRecv[iDim][(iNeighbor+1)%2].unpack( &(vecSpecies[ispec]->MPIbuff.packedRecv[iDim][(iNeighbor+1)%2][0]) );
+            }
 
             // Treat diagonalParticles
             if (iDim < ndim-1){ // No need to treat diag particles at last dimension.
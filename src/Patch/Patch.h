@@ -26,6 +26,7 @@ class Patch
     friend class VectorPatch;
     friend class SimWindow;
     friend class SyncVectorPatch;
+    friend class AggregatedMPIbuffers;
 public:
     //! Constructor for Patch
     Patch(Params& params, SmileiMPI* smpi, unsigned int ipatch, unsigned int n_moved);
@@ -94,7 +95,8 @@ public:
     void cleanup_sent_particles(int ispec, std::vector<int>* indexes_of_particles_to_exchange);
     
     //! init comm / sum densities
-    virtual void initSumField( Field* field, int iDim ) = 0;
+    //!   - itag identifies the field among those (at most 5) whose communications are in progress at the same time
+    virtual void initSumField( Field* field, int iDim, int itag ) = 0;
     //! finalize comm / sum densities
     virtual void finalizeSumField( Field* field, int iDim ) = 0;
     
@@ -102,8 +104,8 @@ public:
     virtual void initExchange( Field* field ) = 0;
     //! finalize comm / exchange fields
     virtual void finalizeExchange( Field* field ) = 0;
-    //! init comm / exchange fields in direction iDim only
-    virtual void initExchange( Field* field, int iDim ) = 0;
+    //! init comm / exchange fields in direction iDim only (itag as in initSumField)
+    virtual void initExchange( Field* field, int iDim, int itag ) = 0;
     //! finalize comm / exchange fields in direction iDim only
     virtual void finalizeExchange( Field* field, int iDim ) = 0;
     
@@ -196,6 +198,12 @@ public:
     //! The debye length, computed for collisions
     double debye_length_squared; 
     
+    //! Time (s) spent in the dynamics, the Maxwell solver and the collisions of the patch since the last load
+    //! balancing, accumulated if LoadBalancing.measured_cost (see SmileiMPI::recompute_patch_count)
+    double load_time;
+    //! Number of timesteps accumulated in load_time
+    unsigned int load_steps;
+    
 protected:
     // Complementary members for the description of the geometry
     // ---------------------------------------------------------
@@ -234,6 +242,7 @@ protected:
 //!  - 2 MPI process can have several communications in the same direction for the same operation
 //!  - the communication is identientified using :
 //!      - hilbert index of the sender + idir + ineighbor
+//!      - for fields, idir is shifted by 2*itag to separate the fields exchanged at the same time
 inline int buildtag(int hindex, int send, int recv) {
     std::stringstream stag("");
     stag << hindex << send  << recv;
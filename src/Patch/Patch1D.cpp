@@ -62,7 +62,7 @@ void Patch1D::initStep2(Params& params)
 // Initialize current patch sum Fields communications through MPI for direction iDim
 // Intra-MPI process communications managed by memcpy in SyncVectorPatch::sum()
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch1D::initSumField( Field* field, int iDim )
+void Patch1D::initSumField( Field* field, int iDim, int itag )
 {
     if (field->MPIbuff.srequest.size()==0)
         field->MPIbuff.allocate(1);
@@ -71,17 +71,14 @@ void Patch1D::initSumField( Field* field, int iDim )
     std::vector<unsigned int> isDual = field->isDual_;
     Field1D* f1D =  static_cast<Field1D*>(field);
     
-    // Use a buffer per direction to exchange data before summing
+    // Use a buffer per direction (kept by the field) to exchange data before summing
     // Size buffer is 2 oversize (1 inside & 1 outside of the current subdomain)
     std::vector<unsigned int> oversize2 = oversize;
     oversize2[0] *= 2;
     oversize2[0] += 1 + f1D->isDual_[0];
     
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        std::vector<unsigned int> tmp(nDim_fields_,0);
-        tmp[0] =    iDim  * n_elem[0] + (1-iDim) * oversize2[0];
-        buf[iDim][iNeighbor].allocateDims( tmp );
-    }
+    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++)
+        field->MPIbuff.sumBuffer[iDim][iNeighbor].resize( iDim  * n_elem[0] + (1-iDim) * oversize2[0] );
      
     int istart, ix;
     /********************************************************************************/
@@ -95,18 +92,18 @@ void Patch1D::initSumField( Field* field, int iDim )
         if ( is_a_MPI_neighbor( iDim, iNeighbor ) ) {
             istart = iNeighbor * ( n_elem[iDim]- oversize2[iDim] ) + (1-iNeighbor) * ( 0 );
             ix = (1-iDim)*istart;
-            int tag = buildtag( hindex, iDim, iNeighbor );
+            int tag = buildtag( hindex, iDim+2*itag, iNeighbor );
             MPI_Isend( &(f1D->data_[ix]), 1, ntype, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(f1D->MPIbuff.srequest[iDim][iNeighbor]) );
             //MPI_Send( &(f1D->data_[ix]), 1, ntype, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD );
             //MPI_Isend( &(f1D->data_[ix]), iDim  * n_elem[0] + (1-iDim) * oversize2[0], MPI_DOUBLE, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(f1D->MPIbuff.srequest[iDim][iNeighbor]) );
         } // END of Send
             
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            int tmp_elem = (buf[iDim][(iNeighbor+1)%2]).dims_[0];
-            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim, iNeighbor );
-            MPI_Irecv( &( (buf[iDim][(iNeighbor+1)%2]).data_[0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f1D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
+            std::vector<double>& buf = field->MPIbuff.sumBuffer[iDim][(iNeighbor+1)%2];
+            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+2*itag, iNeighbor );
+            MPI_Irecv( &(buf[0]), buf.size(), MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f1D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
             //MPI_Status stat;
-            //MPI_Recv( &( (buf[iDim][(iNeighbor+1)%2]).data_[0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &stat );
+            //MPI_Recv( &(buf[0]), buf.size(), MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &stat );
         } // END of Recv
             
     } // END for iNeighbor
@@ -157,17 +154,13 @@ void Patch1D::finalizeSumField( Field* field, int iDim )
         istart = ( (iNeighbor+1)%2 ) * ( n_elem[iDim]- oversize2[iDim] ) + (1-(iNeighbor+1)%2) * ( 0 );
         int ix0 = (1-iDim)*istart;
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            for (unsigned int ix=0 ; ix< (buf[iDim][(iNeighbor+1)%2]).dims_[0] ; ix++) {
-                f1D->data_[ix0+ix] += (buf[iDim][(iNeighbor+1)%2])(ix);
+            std::vector<double>& buf = field->MPIbuff.sumBuffer[iDim][(iNeighbor+1)%2];
+            for (unsigned int ix=0 ; ix< buf.size() ; ix++) {
+                f1D->data_[ix0+ix] += buf[ix];
             }
         } // END if
             
     } // END for iNeighbor
-        
-
-    for (int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++) {
-        buf[iDim][iNeighbor].deallocateDims();
-    }
 
 } // END finalizeSumField
 
@@ -250,7 +243,7 @@ void Patch1D::finalizeExchange( Field* field )
 // Initialize current patch exhange Fields communications through MPI for direction iDim
 // Intra-MPI process communications managed by memcpy in SyncVectorPatch::sum()
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch1D::initExchange( Field* field, int iDim )
+void Patch1D::initExchange( Field* field, int iDim, int itag )
 {
     if (field->MPIbuff.srequest.size()==0)
         field->MPIbuff.allocate(1);
@@ -268,7 +261,7 @@ void Patch1D::initExchange( Field* field, int iDim )
 
             istart = iNeighbor * ( n_elem[iDim]- (2*oversize[iDim]+1+isDual[iDim]) ) + (1-iNeighbor) * ( oversize[iDim] + 1 + isDual[iDim] );
             ix = (1-iDim)*istart;
-            int tag = buildtag( hindex, iDim, iNeighbor );
+            int tag = buildtag( hindex, iDim+2*itag, iNeighbor );
             MPI_Isend( &(f1D->data_[ix]), 1, ntype, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(f1D->MPIbuff.srequest[iDim][iNeighbor]) );
 
         } // END of Send
@@ -277,14 +270,14 @@ void Patch1D::initExchange( Field* field, int iDim )
 
             istart = ( (iNeighbor+1)%2 ) * ( n_elem[iDim] - 1 - (oversize[iDim]-1) ) + (1-(iNeighbor+1)%2) * ( 0 )  ;
             ix = (1-iDim)*istart;
-            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim, iNeighbor );
+            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+2*itag, iNeighbor );
             MPI_Irecv( &(f1D->data_[ix]), 1, ntype, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f1D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]));
 
         } // END of Recv
 
     } // END for iNeighbor
 
-} // END initExchange( Field* field, int iDim )
+} // END initExchange( Field* field, int iDim, int itag )
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -87,7 +87,7 @@ void Patch2D::initStep2(Params& params)
 // Initialize current patch sum Fields communications through MPI in direction iDim
 // Intra-MPI process communications managed by memcpy in SyncVectorPatch::sum()
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch2D::initSumField( Field* field, int iDim )
+void Patch2D::initSumField( Field* field, int iDim, int itag )
 {
     if (field->MPIbuff.srequest.size()==0)
         field->MPIbuff.allocate(2);
@@ -100,8 +100,7 @@ void Patch2D::initSumField( Field* field, int iDim )
     std::vector<unsigned int> isDual = field->isDual_;
     Field2D* f2D =  static_cast<Field2D*>(field);
    
-    // Use a buffer per direction to exchange data before summing
-    //Field2D buf[patch_ndims_][patch_nbNeighbors_];
+    // Use a buffer per direction (kept by the field) to exchange data before summing
     // Size buffer is 2 oversize (1 inside & 1 outside of the current subdomain)
     std::vector<unsigned int> oversize2 = oversize;
     oversize2[0] *= 2;
@@ -118,7 +117,7 @@ void Patch2D::initSumField( Field* field, int iDim )
             tmp[1] = (1-iDim) * n_elem[1] +    iDim  * oversize2[1];
         else 
             tmp[1] = 1;
-        buf[iDim][iNeighbor].allocateDims( tmp );
+        field->MPIbuff.sumBuffer[iDim][iNeighbor].resize( tmp[0]*tmp[1] );
     }
      
     int istart, ix, iy;
@@ -135,19 +134,17 @@ void Patch2D::initSumField( Field* field, int iDim )
             ix = (1-iDim)*istart;
             iy =    iDim *istart;
             //int tag = buildtag( 3, hindex, neighbor_[iDim][iNeighbor]);
-            int tag = buildtag( hindex, iDim, iNeighbor );
+            int tag = buildtag( hindex, iDim+2*itag, iNeighbor );
             //cout << hindex << " send to " << neighbor_[iDim][iNeighbor] << endl;
             //MPI_Isend( &(f2D->data_2D[ix][iy]), 1, ntype, 0, tag, MPI_COMM_SELF, &(f2D->MPIbuff.srequest[iDim][iNeighbor]) );
             MPI_Isend( &(f2D->data_2D[ix][iy]), 1, ntype, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(f2D->MPIbuff.srequest[iDim][iNeighbor]) );
         } // END of Send
             
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            int tmp_elem = (buf[iDim][(iNeighbor+1)%2]).dims_[0]*(buf[iDim][(iNeighbor+1)%2]).dims_[1];
+            std::vector<double>& buf = field->MPIbuff.sumBuffer[iDim][(iNeighbor+1)%2];
             //int tag = buildtag( 3, neighbor_[iDim][(iNeighbor+1)%2], hindex);
-            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim, iNeighbor );
-            //cout << hindex << " recv from " << neighbor_[iDim][(iNeighbor+1)%2] << " ; n_elements = " << tmp_elem << endl;
-            //MPI_Irecv( &( (buf[iDim][(iNeighbor+1)%2]).data_2D[0][0] ), tmp_elem, MPI_DOUBLE, 0, tag, MPI_COMM_SELF, &(f2D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
-            MPI_Irecv( &( (buf[iDim][(iNeighbor+1)%2]).data_2D[0][0] ), tmp_elem, MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f2D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
+            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+2*itag, iNeighbor );
+            MPI_Irecv( &(buf[0]), buf.size(), MPI_DOUBLE, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f2D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]) );
         } // END of Recv
             
     } // END for iNeighbor
@@ -163,19 +160,20 @@ void Patch2D::initSumField( Field* field, int iDim )
 void Patch2D::finalizeSumField( Field* field, int iDim )
 {
     int patch_ndims_(2);
-    int patch_nbNeighbors_(2);
     std::vector<unsigned int> n_elem = field->dims_;
     std::vector<unsigned int> isDual = field->isDual_;
     Field2D* f2D =  static_cast<Field2D*>(field);
    
-    // Use a buffer per direction to exchange data before summing
-    //Field2D buf[patch_ndims_][patch_nbNeighbors_];
+    // Use a buffer per direction (kept by the field) to exchange data before summing
     // Size buffer is 2 oversize (1 inside & 1 outside of the current subdomain)
     std::vector<unsigned int> oversize2 = oversize;
     oversize2[0] *= 2;
     oversize2[0] += 1 + f2D->isDual_[0];
     oversize2[1] *= 2;
     oversize2[1] += 1 + f2D->isDual_[1];
+    unsigned int nbuf[2];
+    nbuf[0] =    iDim  * n_elem[0] + (1-iDim) * oversize2[0];
+    nbuf[1] = (1-iDim) * n_elem[1] +    iDim  * oversize2[1];
     
     int istart;
     /********************************************************************************/
@@ -206,18 +204,14 @@ void Patch2D::finalizeSumField( Field* field, int iDim )
         int ix0 = (1-iDim)*istart;
         int iy0 =    iDim *istart;
         if ( is_a_MPI_neighbor( iDim, (iNeighbor+1)%2 ) ) {
-            for (unsigned int ix=0 ; ix< (buf[iDim][(iNeighbor+1)%2]).dims_[0] ; ix++) {
-                for (unsigned int iy=0 ; iy< (buf[iDim][(iNeighbor+1)%2]).dims_[1] ; iy++)
-                    f2D->data_2D[ix0+ix][iy0+iy] += (buf[iDim][(iNeighbor+1)%2])(ix,iy);
+            std::vector<double>& buf = field->MPIbuff.sumBuffer[iDim][(iNeighbor+1)%2];
+            for (unsigned int ix=0 ; ix< nbuf[0] ; ix++) {
+                for (unsigned int iy=0 ; iy< nbuf[1] ; iy++)
+                    f2D->data_2D[ix0+ix][iy0+iy] += buf[ix*nbuf[1]+iy];
             }
         } // END if
             
     } // END for iNeighbor
-        
-
-    for (int iNeighbor=0 ; iNeighbor<patch_nbNeighbors_ ; iNeighbor++) {
-        buf[iDim][iNeighbor].deallocateDims();
-    }
 
 } // END finalizeSumField
 
@@ -309,7 +303,7 @@ void Patch2D::finalizeExchange( Field* field )
 // Initialize current patch exhange Fields communications through MPI for direction iDim
 // Intra-MPI process communications managed by memcpy in SyncVectorPatch::sum()
 // ---------------------------------------------------------------------------------------------------------------------
-void Patch2D::initExchange( Field* field, int iDim )
+void Patch2D::initExchange( Field* field, int iDim, int itag )
 {
     if (field->MPIbuff.srequest.size()==0)
         field->MPIbuff.allocate(2);
@@ -330,7 +324,7 @@ void Patch2D::initExchange( Field* field, int iDim )
             istart = iNeighbor * ( n_elem[iDim]- (2*oversize[iDim]+1+isDual[iDim]) ) + (1-iNeighbor) * ( oversize[iDim] + 1 + isDual[iDim] );
             ix = (1-iDim)*istart;
             iy =    iDim *istart;
-            int tag = buildtag( hindex, iDim, iNeighbor );
+            int tag = buildtag( hindex, iDim+2*itag, iNeighbor );
             //MPI_Isend( &(f2D->data_2D[ix][iy]), 1, ntype, 0, tag, MPI_COMM_SELF, &(f2D->MPIbuff.srequest[iDim][iNeighbor]) );
             MPI_Isend( &(f2D->data_2D[ix][iy]), 1, ntype, MPI_neighbor_[iDim][iNeighbor], tag, MPI_COMM_WORLD, &(f2D->MPIbuff.srequest[iDim][iNeighbor]) );
 
@@ -341,7 +335,7 @@ void Patch2D::initExchange( Field* field, int iDim )
             istart = ( (iNeighbor+1)%2 ) * ( n_elem[iDim] - 1- (oversize[iDim]-1) ) + (1-(iNeighbor+1)%2) * ( 0 )  ;
             ix = (1-iDim)*istart;
             iy =    iDim *istart;
-            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim, iNeighbor );
+            int tag = buildtag( neighbor_[iDim][(iNeighbor+1)%2], iDim+2*itag, iNeighbor );
             //MPI_Irecv( &(f2D->data_2D[ix][iy]), 1, ntype, 0, tag, MPI_COMM_SELF, &(f2D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]));
             MPI_Irecv( &(f2D->data_2D[ix][iy]), 1, ntype, MPI_neighbor_[iDim][(iNeighbor+1)%2], tag, MPI_COMM_WORLD, &(f2D->MPIbuff.rrequest[iDim][(iNeighbor+1)%2]));
 
@@ -350,7 +344,7 @@ void Patch2D::initExchange( Field* field, int iDim )
     } // END for iNeighbor
 
 
-} // END initExchange( Field* field, int iDim )
+} // END initExchange( Field* field, int iDim, int itag )
 
 
 // ---------------------------------------------------------------------------------------------------------------------
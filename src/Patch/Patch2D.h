@@ -27,7 +27,7 @@ public:
     // --------------------------------------------------------------
 
     //! init comm / sum densities
-    void initSumField( Field* field, int iDim ) override final;
+    void initSumField( Field* field, int iDim, int itag ) override final;
     //! finalize comm / sum densities
     void finalizeSumField( Field* field, int iDim ) override final;
 
@@ -36,7 +36,7 @@ public:
     //! finalize comm / exchange fields
     void finalizeExchange( Field* field ) override final;
     //! init comm / exchange fields in direction iDim only
-    void initExchange( Field* field, int iDim ) override final;
+    void initExchange( Field* field, int iDim, int itag ) override final;
     //! finalize comm / exchange fields in direction iDim only
     void finalizeExchange( Field* field, int iDim ) override final;
 
@@ -48,8 +48,6 @@ public:
     //! MPI_Datatype to exchange [ndims_+1][iDim=0 prim/dial][iDim=1 prim/dial]
     //!   - +1 : an additional type to exchange clrw lines
     MPI_Datatype ntype_[3][2][2];
-    // Use a buffer per direction to exchange data before summing
-    Field2D buf[2][2];
 
 
 
@@ -55,7 +55,11 @@ public:
         vecPatches.printNumberOfParticles( smpi );
 
         vecPatches.set_refHindex();
+        vecPatches.init_neighbor_cache();
         
+        vecPatches.aggregatedMPIbuff.enabled = params.aggregate_mpi_messages;
+        vecPatches.aggregatedMPIbuff.sharedMemory = params.mpi_shared_memory;
+        vecPatches.aggregatedMPIbuff.allocate( params.nDim_field );
         vecPatches.update_field_list();
         
         vecPatches.createDiags( params, smpi );
@@ -11,9 +11,16 @@ using namespace std;
 
 void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Params &params, SmileiMPI* smpi)
 {
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
-        vecPatches(ipatch)->initExchParticles(smpi, ispec, params);
+    // Particle loops handed to the threads by decreasing cost (see VectorPatch::orderPatches)
+    if ( params.largest_patches_first ) {
+        #pragma omp for schedule(dynamic,1)
+        for (unsigned int iorder=0 ; iorder<vecPatches.size() ; iorder++)
+            vecPatches(vecPatches.scheduled(iorder))->initExchParticles(smpi, ispec, params);
+    }
+    else {
+        #pragma omp for schedule(runtime)
+        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
+            vecPatches(ipatch)->initExchParticles(smpi, ispec, params);
     }
 
     //cout << "init exch done" << endl;
@@ -25,10 +32,14 @@ void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Para
         for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
             vecPatches(ipatch)->initCommParticles(smpi, ispec, params, iDim, &vecPatches);
         }
+        if ( vecPatches.aggregatedMPIbuff.enabled )
+            vecPatches.aggregatedMPIbuff.exchangeParticleCounts( vecPatches, ispec, iDim );
         #pragma omp for schedule(runtime)
         for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
             vecPatches(ipatch)->CommParticles(smpi, ispec, params, iDim, &vecPatches);
         }
+        if ( vecPatches.aggregatedMPIbuff.enabled )
+            vecPatches.aggregatedMPIbuff.exchangeParticles( vecPatches, ispec, iDim );
         //cout << "init comm done for dim " << iDim << endl;
         //cout << "initCommParticles done for " << iDim << endl;
         #pragma omp for schedule(runtime)
@@ -38,49 +49,111 @@ void SyncVectorPatch::exchangeParticles(VectorPatch& vecPatches, int ispec, Para
         //cout << "final comm done for dim " << iDim << endl;
     }
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
-        vecPatches(ipatch)->vecSpecies[ispec]->sort_part();
+    if ( params.largest_patches_first ) {
+        #pragma omp for schedule(dynamic,1)
+        for (unsigned int iorder=0 ; iorder<vecPatches.size() ; iorder++)
+            vecPatches(vecPatches.scheduled(iorder))->vecSpecies[ispec]->sort_particles(params);
+    }
+    else {
+        #pragma omp for schedule(runtime)
+        for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++)
+            vecPatches(ipatch)->vecSpecies[ispec]->sort_particles(params);
+    }
 
 }
 
 void SyncVectorPatch::sumRhoJ(VectorPatch& vecPatches, unsigned int diag_flag )
+{
+    SyncVectorPatch::initSumRhoJ( vecPatches, diag_flag );
+    SyncVectorPatch::finalizeSumRhoJ( vecPatches, diag_flag );
+}
+
+void SyncVectorPatch::initSumRhoJ(VectorPatch& vecPatches, unsigned int diag_flag )
+{
+
+    SyncVectorPatch::initSum( vecPatches.listJx_ , vecPatches, 0 );
+    SyncVectorPatch::initSum( vecPatches.listJy_ , vecPatches, 1 );
+    SyncVectorPatch::initSum( vecPatches.listJz_ , vecPatches, 2 );
+    if(diag_flag) SyncVectorPatch::initSum( vecPatches.listrho_, vecPatches, 3 );
+}
+
+void SyncVectorPatch::finalizeSumRhoJ(VectorPatch& vecPatches, unsigned int diag_flag )
 {
 
-    SyncVectorPatch::sum( vecPatches.listJx_ , vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJy_ , vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJz_ , vecPatches );
-    if(diag_flag) SyncVectorPatch::sum( vecPatches.listrho_, vecPatches );
+    SyncVectorPatch::finalizeSum( vecPatches.listJx_ , vecPatches, 0 );
+    SyncVectorPatch::finalizeSum( vecPatches.listJy_ , vecPatches, 1 );
+    SyncVectorPatch::finalizeSum( vecPatches.listJz_ , vecPatches, 2 );
+    if(diag_flag) SyncVectorPatch::finalizeSum( vecPatches.listrho_, vecPatches, 3 );
 }
 
 void SyncVectorPatch::sumRhoJs(VectorPatch& vecPatches, int ispec )
 {
 
-    SyncVectorPatch::sum( vecPatches.listJxs_,  vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJys_,  vecPatches );
-    SyncVectorPatch::sum( vecPatches.listJzs_,  vecPatches );
-    SyncVectorPatch::sum( vecPatches.listrhos_, vecPatches );
+    // itag=4 : the sums of the total densities can be in progress (see VectorPatch::sumDensities)
+    SyncVectorPatch::initSum    ( vecPatches.listJxs_,  vecPatches, 4 );
+    SyncVectorPatch::finalizeSum( vecPatches.listJxs_,  vecPatches, 4 );
+    SyncVectorPatch::initSum    ( vecPatches.listJys_,  vecPatches, 4 );
+    SyncVectorPatch::finalizeSum( vecPatches.listJys_,  vecPatches, 4 );
+    SyncVectorPatch::initSum    ( vecPatches.listJzs_,  vecPatches, 4 );
+    SyncVectorPatch::finalizeSum( vecPatches.listJzs_,  vecPatches, 4 );
+    SyncVectorPatch::initSum    ( vecPatches.listrhos_, vecPatches, 4 );
+    SyncVectorPatch::finalizeSum( vecPatches.listrhos_, vecPatches, 4 );
 }
 
 void SyncVectorPatch::exchangeE( VectorPatch& vecPatches )
+{
+    SyncVectorPatch::initExchangeE( vecPatches );
+    SyncVectorPatch::finalizeExchangeE( vecPatches );
+}
+
+void SyncVectorPatch::initExchangeE( VectorPatch& vecPatches )
+{
+
+    SyncVectorPatch::initExchange( vecPatches.listEx_, vecPatches, 0 );
+    SyncVectorPatch::initExchange( vecPatches.listEy_, vecPatches, 1 );
+    SyncVectorPatch::initExchange( vecPatches.listEz_, vecPatches, 2 );
+}
+
+void SyncVectorPatch::finalizeExchangeE( VectorPatch& vecPatches )
 {
 
-    SyncVectorPatch::exchange( vecPatches.listEx_, vecPatches );
-    SyncVectorPatch::exchange( vecPatches.listEy_, vecPatches );
-    SyncVectorPatch::exchange( vecPatches.listEz_, vecPatches );
+    SyncVectorPatch::finalizeExchange( vecPatches.listEx_, vecPatches, 0 );
+    SyncVectorPatch::finalizeExchange( vecPatches.listEy_, vecPatches, 1 );
+    SyncVectorPatch::finalizeExchange( vecPatches.listEz_, vecPatches, 2 );
 }
 
 void SyncVectorPatch::exchangeB( VectorPatch& vecPatches )
+{
+    SyncVectorPatch::initExchangeB( vecPatches );
+    SyncVectorPatch::finalizeExchangeB( vecPatches );
+}
+
+void SyncVectorPatch::initExchangeB( VectorPatch& vecPatches )
+{
+
+    if ( vecPatches.listBx_[0]->dims_.size()>1 ) {
+        SyncVectorPatch::initExchange1( vecPatches.listBx_, vecPatches, 0 );
+        SyncVectorPatch::initExchange0( vecPatches.listBy_, vecPatches, 1 );
+        SyncVectorPatch::initExchange ( vecPatches.listBz_, vecPatches, 2 );
+    }
+    else if (vecPatches.listBx_[0]->dims_.size()==1) {
+        SyncVectorPatch::initExchange0( vecPatches.listBy_, vecPatches, 1 );
+        SyncVectorPatch::initExchange0( vecPatches.listBz_, vecPatches, 2 );
+    }
+
+}
+
+void SyncVectorPatch::finalizeExchangeB( VectorPatch& vecPatches )
 {
 
     if ( vecPatches.listBx_[0]->dims_.size()>1 ) {
-        SyncVectorPatch::exchange1( vecPatches.listBx_, vecPatches );
-        SyncVectorPatch::exchange0( vecPatches.listBy_, vecPatches );
-        SyncVectorPatch::exchange ( vecPatches.listBz_, vecPatches );
+        SyncVectorPatch::finalizeExchange1( vecPatches.listBx_, vecPatches, 0 );
+        SyncVectorPatch::finalizeExchange0( vecPatches.listBy_, vecPatches, 1 );
+        SyncVectorPatch::finalizeExchange ( vecPatches.listBz_, vecPatches, 2 );
     }
     else if (vecPatches.listBx_[0]->dims_.size()==1) {
-        SyncVectorPatch::exchange0( vecPatches.listBy_, vecPatches );
-        SyncVectorPatch::exchange0( vecPatches.listBz_, vecPatches );
+        SyncVectorPatch::finalizeExchange0( vecPatches.listBy_, vecPatches, 1 );
+        SyncVectorPatch::finalizeExchange0( vecPatches.listBz_, vecPatches, 2 );
     }
 
 }
@@ -88,7 +161,17 @@ void SyncVectorPatch::exchangeB( VectorPatch& vecPatches )
 
 void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
 {
-    unsigned int nx_,ny_, h0, oversize[2], n_space[2],gsp[2];
+    SyncVectorPatch::initSum( fields, vecPatches, 0 );
+    SyncVectorPatch::finalizeSum( fields, vecPatches, 0 );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sum along x between patches of the same MPI process and post the MPI sums along x
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initSum( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
+{
+    unsigned int ny_, h0, oversize[2], n_space[2],gsp[2];
     double *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
@@ -98,7 +181,6 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
     n_space[0] = vecPatches(0)->EMfields->n_space[0];
     n_space[1] = vecPatches(0)->EMfields->n_space[1];
     
-    nx_ = fields[0]->dims_[0];
     ny_ = 1;
     if (fields[0]->dims_.size()>1)
         ny_ = fields[0]->dims_[1];
@@ -120,15 +202,49 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
 
     }
     
+    if ( vecPatches.aggregatedMPIbuff.enabled ) {
+        vecPatches.aggregatedMPIbuff.initFields( fields, vecPatches, 0, itag, true );
+        return;
+    }
+
     for (int iDim=0;iDim<1;iDim++) {
         #pragma omp for schedule(runtime)
         for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-            vecPatches(ipatch)->initSumField( fields[ipatch], iDim ); // initialize
+            vecPatches(ipatch)->initSumField( fields[ipatch], iDim, itag ); // initialize
         }
+    }
+
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Complete the MPI sums along x, then sum along y
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::finalizeSum( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
+{
+    unsigned int nx_,ny_, h0, oversize[2], n_space[2],gsp[2];
+    double *pt1,*pt2;
+    h0 = vecPatches(0)->hindex;
+
+    oversize[0] = vecPatches(0)->EMfields->oversize[0];
+    oversize[1] = vecPatches(0)->EMfields->oversize[1];
     
-        #pragma omp for schedule(runtime)
-        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-            vecPatches(ipatch)->finalizeSumField( fields[ipatch], iDim ); // finalize (waitall + sum)
+    n_space[0] = vecPatches(0)->EMfields->n_space[0];
+    n_space[1] = vecPatches(0)->EMfields->n_space[1];
+    
+    nx_ = fields[0]->dims_[0];
+    ny_ = 1;
+    if (fields[0]->dims_.size()>1)
+        ny_ = fields[0]->dims_[1];
+    
+    if ( vecPatches.aggregatedMPIbuff.enabled )
+        vecPatches.aggregatedMPIbuff.finalizeFields( fields, vecPatches, 0, itag, true );
+    else {
+        for (int iDim=0;iDim<1;iDim++) {
+            #pragma omp for schedule(runtime)
+            for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
+                vecPatches(ipatch)->finalizeSumField( fields[ipatch], iDim ); // finalize (waitall + sum)
+            }
         }
     }
 
@@ -150,10 +266,16 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
             }
         }
 
+        if ( vecPatches.aggregatedMPIbuff.enabled ) {
+            vecPatches.aggregatedMPIbuff.initFields    ( fields, vecPatches, 1, itag, true );
+            vecPatches.aggregatedMPIbuff.finalizeFields( fields, vecPatches, 1, itag, true );
+            return;
+        }
+
         for (int iDim=1;iDim<2;iDim++) {
             #pragma omp for schedule(runtime)
             for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
-                vecPatches(ipatch)->initSumField( fields[ipatch], iDim ); // initialize
+                vecPatches(ipatch)->initSumField( fields[ipatch], iDim, itag ); // initialize
             }
 
             #pragma omp for schedule(runtime)
@@ -167,7 +289,17 @@ void SyncVectorPatch::sum( std::vector<Field*> fields, VectorPatch& vecPatches )
 
 void SyncVectorPatch::exchange( std::vector<Field*> fields, VectorPatch& vecPatches )
 {
-    unsigned int nx_, ny_, h0, oversize[2], n_space[2],gsp[2];
+    SyncVectorPatch::initExchange( fields, vecPatches, 0 );
+    SyncVectorPatch::finalizeExchange( fields, vecPatches, 0 );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy the ghost cells along x between patches of the same MPI process and post the MPI exchanges along x
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initExchange( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
+{
+    unsigned int ny_, h0, oversize[2], n_space[2],gsp[2];
     double *pt1,*pt2;
     h0 = vecPatches(0)->hindex;
 
@@ -177,7 +309,6 @@ void SyncVectorPatch::exchange( std::vector<Field*> fields, VectorPatch& vecPatc
     n_space[0] = vecPatches(0)->EMfields->n_space[0];
     n_space[1] = vecPatches(0)->EMfields->n_space[1];
 
-    nx_ = fields[0]->dims_[0];
     ny_ = 1;
     if (fields[0]->dims_.size()>1)
       ny_ = fields[0]->dims_[1];
@@ -189,7 +320,7 @@ void SyncVectorPatch::exchange( std::vector<Field*> fields, VectorPatch& vecPatc
     gsp[0] = ( oversize[0] + 1 + fields[0]->isDual_[0] ); //Ghost size primal
         
 
-    #pragma omp for schedule(runtime) 
+    #pragma omp for schedule(runtime) private(pt1,pt2)
     for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
 
         if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[0][0]){
@@ -203,8 +334,52 @@ void SyncVectorPatch::exchange( std::vector<Field*> fields, VectorPatch& vecPatc
             memcpy( pt1+gsp[0]*ny_, pt2+gsp[0]*ny_, oversize[0]*ny_*sizeof(double)); 
         } // End if ( MPI_me_ == MPI_neighbor_[0][0] ) 
 
-        if (fields[0]->dims_.size()>1) {
-            gsp[1] = ( oversize[1] + 1 + fields[0]->isDual_[1] ); //Ghost size primal
+    } // End for( ipatch )
+
+    if ( vecPatches.aggregatedMPIbuff.enabled ) {
+        vecPatches.aggregatedMPIbuff.initFields( fields, vecPatches, 0, itag, false );
+        return;
+    }
+
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
+        vecPatches(ipatch)->initExchange( fields[ipatch], 0, itag );
+
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Complete the MPI exchanges along x, then exchange along y, corners included, as for the sums
+// (the copies along y used to be done with the copies along x, both threads writing the corners)
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::finalizeExchange( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
+{
+    unsigned int nx_, ny_, h0, oversize[2], n_space[2],gsp[2];
+    double *pt1,*pt2;
+    h0 = vecPatches(0)->hindex;
+
+    oversize[0] = vecPatches(0)->EMfields->oversize[0];
+    oversize[1] = vecPatches(0)->EMfields->oversize[1];
+
+    n_space[0] = vecPatches(0)->EMfields->n_space[0];
+    n_space[1] = vecPatches(0)->EMfields->n_space[1];
+
+    if ( vecPatches.aggregatedMPIbuff.enabled )
+        vecPatches.aggregatedMPIbuff.finalizeFields( fields, vecPatches, 0, itag, false );
+    else {
+        #pragma omp for schedule(runtime)
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
+            vecPatches(ipatch)->finalizeExchange( fields[ipatch], 0 );
+    }
+
+    if (fields[0]->dims_.size()>1) {
+        nx_ = fields[0]->dims_[0];
+        ny_ = fields[0]->dims_[1];
+        gsp[1] = ( oversize[1] + 1 + fields[0]->isDual_[1] ); //Ghost size primal
+
+        #pragma omp for schedule(runtime) private(pt1,pt2)
+        for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++) {
+
             if (vecPatches(ipatch)->MPI_me_ == vecPatches(ipatch)->MPI_neighbor_[1][0]){
                 pt1 = &(*fields[vecPatches(ipatch)->neighbor_[1][0]-h0])(n_space[1]);
                 pt2 = &(*fields[ipatch])(0);
@@ -219,22 +394,18 @@ void SyncVectorPatch::exchange( std::vector<Field*> fields, VectorPatch& vecPatc
                     }
                 } 
             } // End if ( MPI_me_ == MPI_neighbor_[1][0] ) 
-        }
 
-    } // End for( ipatch )
+        } // End for( ipatch )
 
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->initExchange( fields[ipatch], 0 );
-
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->finalizeExchange( fields[ipatch], 0 );
+        if ( vecPatches.aggregatedMPIbuff.enabled ) {
+            vecPatches.aggregatedMPIbuff.initFields    ( fields, vecPatches, 1, itag, false );
+            vecPatches.aggregatedMPIbuff.finalizeFields( fields, vecPatches, 1, itag, false );
+            return;
+        }
 
-    if (fields[0]->dims_.size()>1) {
         #pragma omp for schedule(runtime)
         for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-            vecPatches(ipatch)->initExchange( fields[ipatch], 1 );
+            vecPatches(ipatch)->initExchange( fields[ipatch], 1, itag );
 
         #pragma omp for schedule(runtime)
         for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
@@ -244,6 +415,16 @@ void SyncVectorPatch::exchange( std::vector<Field*> fields, VectorPatch& vecPatc
 }
 
 void SyncVectorPatch::exchange0( std::vector<Field*> fields, VectorPatch& vecPatches )
+{
+    SyncVectorPatch::initExchange0( fields, vecPatches, 0 );
+    SyncVectorPatch::finalizeExchange0( fields, vecPatches, 0 );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy the ghost cells along x between patches of the same MPI process and post the MPI exchanges along x
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initExchange0( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
 {
     unsigned int ny_, h0, oversize[2], n_space[2],gsp;
     double *pt1,*pt2;
@@ -279,18 +460,45 @@ void SyncVectorPatch::exchange0( std::vector<Field*> fields, VectorPatch& vecPat
 
     } // End for( ipatch )
 
+    if ( vecPatches.aggregatedMPIbuff.enabled ) {
+        vecPatches.aggregatedMPIbuff.initFields( fields, vecPatches, 0, itag, false );
+        return;
+    }
+
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->initExchange( fields[ipatch], 0 );
+        vecPatches(ipatch)->initExchange( fields[ipatch], 0, itag );
+
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Complete the MPI exchanges along x
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::finalizeExchange0( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
+{
+    if ( vecPatches.aggregatedMPIbuff.enabled ) {
+        vecPatches.aggregatedMPIbuff.finalizeFields( fields, vecPatches, 0, itag, false );
+        return;
+    }
 
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
         vecPatches(ipatch)->finalizeExchange( fields[ipatch], 0 );
 
-
 }
 
 void SyncVectorPatch::exchange1( std::vector<Field*> fields, VectorPatch& vecPatches )
+{
+    SyncVectorPatch::initExchange1( fields, vecPatches, 0 );
+    SyncVectorPatch::finalizeExchange1( fields, vecPatches, 0 );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy the ghost cells along y between patches of the same MPI process and post the MPI exchanges along y
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::initExchange1( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
 {
     unsigned int nx_, ny_, h0, oversize[2], n_space[2],gsp;
     double *pt1,*pt2;
@@ -328,14 +536,31 @@ void SyncVectorPatch::exchange1( std::vector<Field*> fields, VectorPatch& vecPat
 
     } // End for( ipatch )
 
+    if ( vecPatches.aggregatedMPIbuff.enabled ) {
+        vecPatches.aggregatedMPIbuff.initFields( fields, vecPatches, 1, itag, false );
+        return;
+    }
+
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
-        vecPatches(ipatch)->initExchange( fields[ipatch], 1 );
+        vecPatches(ipatch)->initExchange( fields[ipatch], 1, itag );
+
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Complete the MPI exchanges along y
+// ---------------------------------------------------------------------------------------------------------------------
+void SyncVectorPatch::finalizeExchange1( std::vector<Field*> fields, VectorPatch& vecPatches, int itag )
+{
+    if ( vecPatches.aggregatedMPIbuff.enabled ) {
+        vecPatches.aggregatedMPIbuff.finalizeFields( fields, vecPatches, 1, itag, false );
+        return;
+    }
 
     #pragma omp for schedule(runtime)
     for (unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++)
         vecPatches(ipatch)->finalizeExchange( fields[ipatch], 1 );
 
-
 }
 
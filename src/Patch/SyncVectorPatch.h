@@ -21,6 +21,27 @@ public :
     static void exchange ( std::vector<Field*> fields, VectorPatch& vecPatches );
     static void exchange0( std::vector<Field*> fields, VectorPatch& vecPatches );
     static void exchange1( std::vector<Field*> fields, VectorPatch& vecPatches );
+    
+    //! Split-phase versions of the above : init* does the intra-MPI process copies and posts the MPI requests,
+    //! finalize* waits for them (and completes the other directions). Work which does not read the ghost cells
+    //! of the fields can be done in between. All the finalize* must be called in the same order by all processes.
+    //!   - itag (0 to 4) must differ between the lists of fields whose communications are in progress at once
+    //!   - with Main.aggregate_mpi_messages, the MPI messages of all the patches are aggregated per neighbor process
+    //!     (see AggregatedMPIbuffers)
+    static void initSumRhoJ      ( VectorPatch& vecPatches, unsigned int diag_flag );
+    static void finalizeSumRhoJ  ( VectorPatch& vecPatches, unsigned int diag_flag );
+    static void initExchangeE    ( VectorPatch& vecPatches );
+    static void finalizeExchangeE( VectorPatch& vecPatches );
+    static void initExchangeB    ( VectorPatch& vecPatches );
+    static void finalizeExchangeB( VectorPatch& vecPatches );
+    static void initSum          ( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
+    static void finalizeSum      ( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
+    static void initExchange     ( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
+    static void finalizeExchange ( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
+    static void initExchange0    ( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
+    static void finalizeExchange0( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
+    static void initExchange1    ( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
+    static void finalizeExchange1( std::vector<Field*> fields, VectorPatch& vecPatches, int itag );
 
 };
 
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <algorithm>
 
 #include "Hilbert_functions.h"
 #include "PatchesFactory.h"
@@ -45,6 +46,8 @@ void VectorPatch::close(SmileiMPI * smpiData)
         delete patches_[ipatch];
     
     patches_.clear();
+    
+    aggregatedMPIbuff.release();
 }
 
 void VectorPatch::createDiags(Params& params, SmileiMPI* smpi)
@@ -61,6 +64,49 @@ void VectorPatch::createDiags(Params& params, SmileiMPI* smpi)
 // ---------------------------------------------------------------------------------------------------------------------
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Order the patches by decreasing cost : the number of particles, or the time measured since the last load balancing
+// (LoadBalancing.measured_cost), the patches not measured yet being estimated from their particles
+//   - the threads taking the next patch of the list as soon as they are free (dynamic schedule), the
+//     largest patches are started first and the small ones fill the end of the loop (LPT scheduling)
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::orderPatches(Params& params)
+{
+    unsigned int nPatches( size() );
+    vector<double> cost( nPatches, 0. );
+    double measured(0.), estimated(0.);
+    
+    for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
+        for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++)
+            cost[ipatch] += species(ipatch, ispec)->getNbrOfParticles();
+        if ( params.measured_cost && (*this)(ipatch)->load_steps>0 ) {
+            estimated += cost[ipatch];
+            measured  += (*this)(ipatch)->load_time / (*this)(ipatch)->load_steps;
+        }
+    }
+    if ( measured > 0. ) {
+        double scale = ( estimated > 0. ) ? measured / estimated : 0.;
+        for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++) {
+            if ( (*this)(ipatch)->load_steps>0 )
+                cost[ipatch] = (*this)(ipatch)->load_time / (*this)(ipatch)->load_steps;
+            else
+                cost[ipatch] *= scale;
+        }
+    }
+    
+    // Sorted by decreasing cost, then in the Hilbert order
+    vector< pair<double, unsigned int> > sorted( nPatches );
+    for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++)
+        sorted[ipatch] = make_pair( -cost[ipatch], ipatch );
+    sort( sorted.begin(), sorted.end() );
+    
+    patch_order_.resize( nPatches );
+    for (unsigned int ipatch=0 ; ipatch<nPatches ; ipatch++)
+        patch_order_[ipatch] = sorted[ipatch].second;
+    
+} // END orderPatches
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all patch, move particles (restartRhoJ(s), dynamics and exchangeParticles)
 // ---------------------------------------------------------------------------------------------------------------------
@@ -69,18 +115,18 @@ void VectorPatch::dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow
 {
     timer[1].restart();
     ostringstream t;
-    #pragma omp for schedule(runtime)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
-        (*this)(ipatch)->EMfields->restartRhoJ();
-        for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
-            if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || *diag_flag  ) {
-                species(ipatch, ispec)->dynamics(time_dual, ispec,
-                                                 emfields(ipatch), interp(ipatch), proj(ipatch),
-                                                 params, *diag_flag, partwalls(ipatch),
-                                                 (*this)(ipatch), smpi);
-            }
-        }
-    
+    if ( params.largest_patches_first ) {
+        #pragma omp single
+        orderPatches(params);
+        // The sorted patches are taken one by one by the free threads
+        #pragma omp for schedule(dynamic,1)
+        for (unsigned int iorder=0 ; iorder<(*this).size() ; iorder++)
+            dynamicsPatch( scheduled(iorder), params, smpi, simWindow, diag_flag, time_dual );
+    }
+    else {
+        #pragma omp for schedule(runtime)
+        for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
+            dynamicsPatch( ipatch, params, smpi, simWindow, diag_flag, time_dual );
     }
     timer[1].update();
     
@@ -95,6 +141,30 @@ void VectorPatch::dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow
 } // END dynamics
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Move particles of patch ipatch (restartRhoJ(s) and dynamics of all species), timed if measured_cost
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::dynamicsPatch(unsigned int ipatch, Params& params, SmileiMPI* smpi, SimWindow* simWindow,
+                                int* diag_flag, double time_dual)
+{
+    double t0 = ( params.measured_cost ? MPI_Wtime() : 0. );
+    (*this)(ipatch)->EMfields->restartRhoJ();
+    for (unsigned int ispec=0 ; ispec<(*this)(ipatch)->vecSpecies.size() ; ispec++) {
+        if ( (*this)(ipatch)->vecSpecies[ispec]->isProj(time_dual, simWindow) || *diag_flag  ) {
+            species(ipatch, ispec)->dynamics(time_dual, ispec,
+                                             emfields(ipatch), interp(ipatch), proj(ipatch),
+                                             params, *diag_flag, partwalls(ipatch),
+                                             (*this)(ipatch), smpi);
+        }
+    }
+    if ( params.measured_cost ) {
+        (*this)(ipatch)->load_time += MPI_Wtime() - t0;
+        (*this)(ipatch)->load_steps++;
+    }
+
+} // END dynamicsPatch
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all patch, sum densities on ghost cells (sum per species if needed, sync per patch and MPI sync)
 // ---------------------------------------------------------------------------------------------------------------------
@@ -111,8 +181,9 @@ void VectorPatch::sumDensities( int* diag_flag, vector<Timer>& timer )
     timer[4].update();
     
     timer[9].restart();
-    SyncVectorPatch::sumRhoJ( (*this), *diag_flag ); // MPI
+    SyncVectorPatch::initSumRhoJ( (*this), *diag_flag ); // MPI
     
+    // The densities of the species are summed while the sums of the total densities are in progress
     if(*diag_flag){
         for (unsigned int ispec=0 ; ispec<(*this)(0)->vecSpecies.size(); ispec++) {
             if( ! (*this)(0)->vecSpecies[ispec]->particles->isTest ) {
@@ -121,6 +192,8 @@ void VectorPatch::sumDensities( int* diag_flag, vector<Timer>& timer )
             }
         }
     }
+    
+    SyncVectorPatch::finalizeSumRhoJ( (*this), *diag_flag ); // MPI
     timer[9].update();
     
 } // End sumDensities
@@ -135,40 +208,78 @@ void VectorPatch::solveMaxwell(Params& params, SimWindow* simWindow, int itime,
     
     #pragma omp for schedule(static)
     for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
-        // Saving magnetic fields (to compute centered fields used in the particle pusher)
-        // Stores B at time n in B_m.
-        (*this)(ipatch)->EMfields->saveMagneticFields();
-        // Computes Ex_, Ey_, Ez_ on all points.
-        // E is already synchronized because J has been synchronized before.
-        (*this)(ipatch)->EMfields->solveMaxwellAmpere();
+        double t0 = ( params.measured_cost ? MPI_Wtime() : 0. );
+        if ( (*this)(ipatch)->EMfields->fusedMaxwell ) {
+            // Computes E at time n+1, B at time n+1 on interior points and B at time n+1/2 out of the
+            // oversize layers, in a single sweep. B at time n is kept in B_m in the oversize layers.
+            (*this)(ipatch)->EMfields->solveMaxwellFused();
+        }
+        else {
+            // Saving magnetic fields (to compute centered fields used in the particle pusher)
+            // Stores B at time n in B_m.
+            (*this)(ipatch)->EMfields->saveMagneticFields();
+            // Computes Ex_, Ey_, Ez_ on all points.
+            // E is already synchronized because J has been synchronized before.
+            (*this)(ipatch)->EMfields->solveMaxwellAmpere();
+        }
+        if ( params.measured_cost )
+            (*this)(ipatch)->load_time += MPI_Wtime() - t0;
     }
     //(*this).exchangeE();
     
     // Computes Bx_, By_, Bz_ at time n+1 on interior points.
     #pragma omp for schedule(static)
     for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
+        if ( (*this)(ipatch)->EMfields->fusedMaxwell ) continue;
+        double t0 = ( params.measured_cost ? MPI_Wtime() : 0. );
         // (*this)(ipatch)->EMfields->solveMaxwellFaraday();
         (*(*this)(ipatch)->EMfields->MaxwellFaradaySolver_)((*this)(ipatch)->EMfields);
+        if ( params.measured_cost )
+            (*this)(ipatch)->load_time += MPI_Wtime() - t0;
     }
     
-    // Applies boundary conditions on B
+    // Evaluates the laser profiles defined by python functions : python cannot be called by several threads
     #pragma omp single
     for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
+        (*this)(ipatch)->EMfields->prepareLasers(time_dual, (*this)(ipatch), params, simWindow);
+    }
+    
+    // Applies boundary conditions on B (only patches on the borders have some work : dynamic schedule)
+    #pragma omp for schedule(dynamic)
+    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++){
+        double t0 = ( params.measured_cost ? MPI_Wtime() : 0. );
         (*this)(ipatch)->EMfields->boundaryConditions(itime, time_dual, (*this)(ipatch), params, simWindow);
+        if ( params.measured_cost )
+            (*this)(ipatch)->load_time += MPI_Wtime() - t0;
     }
     
     //Synchronize B fields between patches.
     timer[2].update();
     
     timer[9].restart();
-    SyncVectorPatch::exchangeB( (*this) );
+    SyncVectorPatch::initExchangeB( (*this) );
+    timer[9].update();
+    
+    timer[2].restart();
+    // Computes B at time n+1/2 using B and B_m out of the oversize layers while B is exchanged.
+    // Already done by solveMaxwellFused.
+    #pragma omp for schedule(static)
+    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
+        if ( ! (*this)(ipatch)->EMfields->fusedMaxwell )
+            (*this)(ipatch)->EMfields->centerMagneticFieldsInterior();
+    }
+    timer[2].update();
+    
+    timer[9].restart();
+    SyncVectorPatch::finalizeExchangeB( (*this) );
     timer[9].update();
     
     timer[2].restart();
-    // Computes B at time n+1/2 using B and B_m.
+    // Computes B at time n+1/2 in the oversize layers, now that B is synchronized.
     #pragma omp for schedule(static)
-    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++)
-        (*this)(ipatch)->EMfields->centerMagneticFields();
+    for (unsigned int ipatch=0 ; ipatch<(*this).size() ; ipatch++) {
+        (*this)(ipatch)->EMfields->centerMagneticFieldsBorders();
+    }
     timer[2].update();
 
 } // END solveMaxwell
@@ -524,13 +635,22 @@ void VectorPatch::load_balance(Params& params, double time_dual, SmileiMPI* smpi
     //partperMPI = 0;
 
     // Compute new patch distribution
+    std::vector<int> current_patch_count( smpi->patch_count );
     smpi->recompute_patch_count( params, *this, time_dual );
-            
-    // Create empty patches according to this new distribution
-    this->createPatches(params, smpi, simWindow);
-
-    // Proceed to patch exchange, and delete patch which moved
-    this->exchangePatches(smpi, params);
+    
+    // Start measuring the loads of the next balancing window
+    for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++) {
+        (*this)(ipatch)->load_time  = 0.;
+        (*this)(ipatch)->load_steps = 0;
+    }
+    
+    // The new distribution is the end of the migration, which starts from the current one
+    // (the owners of the patches, updated by migratePatches, still match the current one)
+    migration_patch_count_ = smpi->patch_count;
+    smpi->patch_count = current_patch_count;
+    
+    // Create empty patches, proceed to patch exchange and delete patch which moved
+    this->migratePatches(params, smpi, simWindow);
 
     //for (unsigned int irank=0 ; irank<smpi->getSize() ; irank++){
     //    if(smpi->getRank() == irank){
@@ -551,6 +671,50 @@ void VectorPatch::load_balance(Params& params, double time_dual, SmileiMPI* smpi
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// One step of the migration toward migration_patch_count_
+//   - the boundary between 2 consecutive MPI processes (in the Hilbert order) moves toward its final position
+//     by at most max_migrating_patches (all the way if 0) : as the final distribution, the intermediate ones
+//     only exchange patches between neighbor processes and leave at least one patch to each process
+//   - patches are only exchanged between the processes concerned (no global synchronization)
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::migratePatches(Params& params, SmileiMPI* smpi, SimWindow* simWindow)
+{
+    if ( !isMigrating() ) return;
+    
+    int nRanks( smpi->getSize() );
+    int maxMove( params.max_migrating_patches );
+    std::vector<int> step_patch_count( nRanks );
+    int current(0), final(0), boundary(0), previous(0);
+    
+    for (int irk=0 ; irk<nRanks-1 ; irk++) {
+        current += smpi->patch_count[irk];
+        final   += migration_patch_count_[irk];
+        boundary = final;
+        if ( maxMove > 0 )
+            boundary = std::max( current-maxMove, std::min( current+maxMove, final ) );
+        step_patch_count[irk] = boundary - previous;
+        previous = boundary;
+    }
+    step_patch_count[nRanks-1] = params.tot_number_of_patches - previous;
+    
+    // Same decisions on all processes : patch_count is known by all of them
+    if ( step_patch_count == migration_patch_count_ )
+        migration_patch_count_.clear();
+    if ( step_patch_count == smpi->patch_count )
+        return;
+    smpi->patch_count = step_patch_count;
+    smpi->update_patch_owners();
+    
+    // Create empty patches according to this new distribution
+    this->createPatches(params, smpi, simWindow);
+    
+    // Proceed to patch exchange, and delete patch which moved
+    this->exchangePatches(smpi, params);
+    
+} // END migratePatches
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Explicits patch movement regarding new patch distribution stored in smpi->patch_count
 //   - compute send_patch_id_
@@ -621,6 +785,9 @@ void VectorPatch::createPatches(Params& params, SmileiMPI* smpi, SimWindow* simW
         // Species will be cleared when, nbr of particles will be known
         // Creation of a new patch, ready to receive its content from MPI neighbours.
         Patch* newPatch = PatchesFactory::clone(existing_patch, params, smpi, recv_patch_id_[ipatch], n_moved );
+        // The particles created by the clone are replaced by the received ones: they are not injected in the box
+        for (unsigned int ispec=0 ; ispec<newPatch->vecSpecies.size() ; ispec++)
+            newPatch->vecSpecies[ispec]->reinitDiags();
         //Store pointers to newly created patch in recv_patches_.
         recv_patches_.push_back( newPatch );
     }
@@ -668,11 +835,13 @@ void VectorPatch::exchangePatches(SmileiMPI* smpi, Params& params)
     }
 
     
-    smpi->barrier();
+    // Wait for the receivers of my patches only
+    smpi->waitPatchSends();
     //Delete sent patches
     int nPatchSend(send_patch_id_.size());
     for (int ipatch=nPatchSend-1 ; ipatch>=0 ; ipatch--) {
         //Ok while at least 1 old patch stay inon current CPU
+        remove_from_neighbor_cache( (*this)(send_patch_id_[ipatch]) );
         delete (*this)(send_patch_id_[ipatch]);
         patches_[ send_patch_id_[ipatch] ] = NULL;
         patches_.erase( patches_.begin() + send_patch_id_[ipatch] );
@@ -681,7 +850,9 @@ void VectorPatch::exchangePatches(SmileiMPI* smpi, Params& params)
 
 
     //Put received patches in the global vecPatches
+    //(their neighbors ranks were computed when they were created, with the new owners)
     for (unsigned int ipatch=0 ; ipatch<recv_patch_id_.size() ; ipatch++) {
+        add_to_neighbor_cache( recv_patches_[ipatch] );
         if ( recv_patch_id_[ipatch] > refHindex_ )
             patches_.push_back( recv_patches_[ipatch] );
         else
@@ -689,15 +860,50 @@ void VectorPatch::exchangePatches(SmileiMPI* smpi, Params& params)
     }
     recv_patches_.clear();
 
-    
-    for (unsigned int ipatch=0 ; ipatch<patches_.size() ; ipatch++ ) { 
-        (*this)(ipatch)->updateMPIenv(smpi);
+    // Only the patches neighboring a patch which changed owner have to update the ranks of their neighbors
+    const std::vector<int>& changed = smpi->changed_owners();
+    for (unsigned int i=0 ; i<changed.size() ; i++) {
+        std::map<int, std::vector<Patch*> >::iterator it = neighbor_cache_.find( changed[i] );
+        if ( it == neighbor_cache_.end() ) continue;
+        for (unsigned int ipatch=0 ; ipatch<it->second.size() ; ipatch++)
+            it->second[ipatch]->updateMPIenv(smpi);
     }
     (*this).set_refHindex() ;
     update_field_list() ;    
     
 } // END exchangePatches
 
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Table of the local patches having each patch as a neighbor, used by exchangePatches
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::init_neighbor_cache()
+{
+    neighbor_cache_.clear();
+    for (unsigned int ipatch=0 ; ipatch<patches_.size() ; ipatch++)
+        add_to_neighbor_cache( patches_[ipatch] );
+}
+
+void VectorPatch::add_to_neighbor_cache(Patch* patch)
+{
+    for (int iDim=0 ; iDim<patch->nDim_fields_ ; iDim++)
+        for (int iNeighbor=0 ; iNeighbor<patch->nbNeighbors_ ; iNeighbor++)
+            if ( patch->neighbor_[iDim][iNeighbor] != MPI_PROC_NULL )
+                neighbor_cache_[ patch->neighbor_[iDim][iNeighbor] ].push_back( patch );
+}
+
+void VectorPatch::remove_from_neighbor_cache(Patch* patch)
+{
+    for (int iDim=0 ; iDim<patch->nDim_fields_ ; iDim++)
+        for (int iNeighbor=0 ; iNeighbor<patch->nbNeighbors_ ; iNeighbor++) {
+            if ( patch->neighbor_[iDim][iNeighbor] == MPI_PROC_NULL ) continue;
+            std::map<int, std::vector<Patch*> >::iterator it = neighbor_cache_.find( patch->neighbor_[iDim][iNeighbor] );
+            if ( it == neighbor_cache_.end() ) continue;
+            it->second.erase( std::remove( it->second.begin(), it->second.end(), patch ), it->second.end() );
+            if ( it->second.empty() ) neighbor_cache_.erase( it );
+        }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write in a file patches communications
 //   - Send/Recv MPI rank
@@ -752,6 +958,9 @@ void VectorPatch::update_field_list()
         listBy_[ipatch] = patches_[ipatch]->EMfields->By_ ;
         listBz_[ipatch] = patches_[ipatch]->EMfields->Bz_ ;
     }
+    
+    // The patches or their neighbors changed
+    aggregatedMPIbuff.valid = false;
 }
 
 
@@ -807,9 +1016,13 @@ void VectorPatch::applyCollisions(Params& params, int itime, vector<Timer>& time
     unsigned int ncoll = patches_[0]->vecCollisions.size();
     
     #pragma omp for schedule(static)
-    for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++)
+    for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++) {
+        double t0 = ( params.measured_cost && ncoll>0 ? MPI_Wtime() : 0. );
         for (unsigned int icoll=0 ; icoll<ncoll; icoll++)
             patches_[ipatch]->vecCollisions[icoll]->collide(params,patches_[ipatch],itime);
+        if ( params.measured_cost && ncoll>0 )
+            patches_[ipatch]->load_time += MPI_Wtime() - t0;
+    }
     
     #pragma omp single
     for (unsigned int icoll=0 ; icoll<ncoll; icoll++)
@@ -818,3 +1031,23 @@ void VectorPatch::applyCollisions(Params& params, int itime, vector<Timer>& time
     
     timer[10].update();
 }
+
+
+// For all patches, merge the particles of the species whose merge_every matches itime
+void VectorPatch::mergeParticles(Params& params, int itime, vector<Timer>& timer)
+{
+    timer[1].restart();
+    
+    unsigned int nspec = patches_[0]->vecSpecies.size();
+    
+    #pragma omp for schedule(runtime)
+    for (unsigned int ipatch=0 ; ipatch<size() ; ipatch++) {
+        for (unsigned int ispec=0 ; ispec<nspec ; ispec++) {
+            Species* spec = patches_[ipatch]->vecSpecies[ispec];
+            if ( spec->merge_every > 0 && itime % spec->merge_every == 0 )
+                spec->mergeParticles(params);
+        }
+    }
+    
+    timer[1].update();
+}
@@ -2,6 +2,7 @@
 #define VECTORPATCH_H
 
 #include <vector>
+#include <map>
 #include <iostream>
 #include <cstdlib>
 #include <iomanip>
@@ -15,6 +16,7 @@
 #include "Params.h"
 #include "SmileiMPI.h"
 #include "SimWindow.h"
+#include "AggregatedMPIbuffers.h"
 
 class Field;
 class Timer;
@@ -51,6 +53,10 @@ public :
     inline Patch* operator()(int ipatch) {
         return patches_[ipatch];
     }
+    //! Index of the i-th patch handed to the threads in the particle loops (see orderPatches)
+    inline unsigned int scheduled(unsigned int i) {
+        return ( patch_order_.size() == patches_.size() ) ? patch_order_[i] : i;
+    }
     
     //! Set Id of the 1st patch stored on the current MPI process
     //!   used during balancing 
@@ -61,6 +67,9 @@ public :
     void update_field_list();
     void update_field_list(int ispec);
     
+    //! Rebuild neighbor_cache_ entirely (patches created, or their neighbors changed by the moving window)
+    void init_neighbor_cache();
+    
     void createDiags(Params& params, SmileiMPI* smpi);
     
     //! get a particular scalar
@@ -85,9 +94,15 @@ public :
     // Interfaces between main programs & main PIC operators
     // -----------------------------------------------------
     
+    //! Order the patches by decreasing cost for the particle loops (Main.largest_patches_first)
+    void orderPatches(Params& params);
+    
     //! For all patch, move particles (restartRhoJ(s), dynamics and exchangeParticles)
     void dynamics(Params& params, SmileiMPI* smpi, SimWindow* simWindow, int* diag_flag, double time_dual,
                   std::vector<Timer>& timer);
+    //! Move particles of patch ipatch (restartRhoJ(s) and dynamics of all species)
+    void dynamicsPatch(unsigned int ipatch, Params& params, SmileiMPI* smpi, SimWindow* simWindow, int* diag_flag,
+                       double time_dual);
     
     //! For all patch, sum densities on ghost cells (sum per species if needed, sync per patch and MPI sync)
     void sumDensities( int* diag_flag, std::vector<Timer>& timer );
@@ -117,12 +132,24 @@ public :
     //! For all patches, apply collisions
     void applyCollisions(Params &params, int itime, std::vector<Timer>& timer);
     
+    //! For all patches, merge the particles of the species which require it at this timestep
+    void mergeParticles(Params &params, int itime, std::vector<Timer>& timer);
+    
     //  Balancing methods
     // ------------------
     
     //! Wrapper of load balancing methods, including SmileiMPI::recompute_patch_count. Called from main program
     void load_balance(Params& params, double time_dual, SmileiMPI* smpi, SimWindow* simWindow);
     
+    //! Move the patches toward the distribution computed by the last load balancing, by at most
+    //! LoadBalancing.max_migrating_patches per MPI process boundary. Called from main program at each timestep
+    void migratePatches(Params& params, SmileiMPI* smpi, SimWindow* simWindow);
+    
+    //! True if the patches have not reached yet the distribution computed by the last load balancing
+    inline bool isMigrating() {
+        return !migration_patch_count_.empty();
+    }
+    
     //! Explicits patch movement regarding new patch distribution stored in smpi->patch_count
     void createPatches(Params& params, SmileiMPI* smpi, SimWindow* simWindow);
     
@@ -154,6 +181,15 @@ public :
     //! 1st patch index of patches_ (stored for balancing op)
     int refHindex_;
     
+    //! Local patches having each patch (hindex) as a neighbor : after an exchange of patches, only those
+    //! neighboring a patch whose owner changed look up the MPI ranks of their neighbors again
+    std::map<int, std::vector<Patch*> > neighbor_cache_;
+    void add_to_neighbor_cache(Patch* patch);
+    void remove_from_neighbor_cache(Patch* patch);
+    
+    //! Ghost cells and particles messages aggregated per neighbor MPI process (plan rebuilt by update_field_list)
+    AggregatedMPIbuffers aggregatedMPIbuff;
+    
     //! Copy of the fields time selection
     TimeSelection * fieldsTimeSelection;
     
@@ -206,6 +242,12 @@ public :
     std::vector<int> recv_patch_id_;
     std::vector<int> send_patch_id_;
     
+    //! Number of patches per MPI process at the end of the migration in progress (empty if none)
+    std::vector<int> migration_patch_count_;
+    
+    //! Patches by decreasing cost, computed at each timestep by orderPatches (empty if Hilbert order)
+    std::vector<unsigned int> patch_order_;
+    
     //! Current intensity of antennas
     double antenna_intensity;
     
@@ -11,7 +11,8 @@ using namespace std;
 // Default constructor.
 Profile::Profile(PyObject* py_profile, unsigned int nvariables, string name) :
     profileName(""),
-    nvariables(nvariables)
+    nvariables(nvariables),
+    table(new ProfileTable())
 {
     ostringstream info_("");
     info_ << nvariables << "D";
@@ -186,6 +187,8 @@ Profile::Profile(Profile *p)
     profileName = p->profileName;
     nvariables  = p->nvariables ;
     info        = p->info       ;
+    table       = p->table      ;
+    table->nprofiles++;
     if( profileName != "" ) {
         if( profileName == "constant" ) {
             if     ( nvariables == 1 )
@@ -241,6 +244,99 @@ Profile::Profile(Profile *p)
 Profile::~Profile()
 {
     delete function;
+    table->nprofiles--;
+    if( table->nprofiles==0 ) delete table;
+}
+
+
+// Get the values of the profile at many locations at once (spatial)
+void Profile::valuesAt(vector<vector<double> > &coordinates, vector<double> &values)
+{
+    if( table->values.size()==0 ) {
+        function->valuesAt(coordinates, values);
+        return;
+    }
+    
+    // Interpolate the table where possible, and list the other locations
+    unsigned int n = coordinates[0].size();
+    vector<double> x(coordinates.size());
+    vector<unsigned int> outside;
+    values.resize(n);
+    for (unsigned int i=0; i<n; i++) {
+        for (unsigned int idim=0; idim<x.size(); idim++) x[idim] = coordinates[idim][i];
+        if( !table->interpolate(x, values[i]) ) outside.push_back(i);
+    }
+    
+    // Evaluate the function at the locations outside the table
+    if( outside.size()>0 ) {
+        vector<vector<double> > x_outside(coordinates.size(), vector<double>(outside.size()));
+        vector<double> values_outside;
+        for (unsigned int idim=0; idim<x.size(); idim++)
+            for (unsigned int i=0; i<outside.size(); i++) x_outside[idim][i] = coordinates[idim][outside[i]];
+        function->valuesAt(x_outside, values_outside);
+        for (unsigned int i=0; i<outside.size(); i++) values[outside[i]] = values_outside[i];
+    }
+}
+
+
+// Tabulate the profile on a regular grid of nodes
+void Profile::tabulate(vector<double> xmin, vector<double> step, vector<unsigned int> n)
+{
+    unsigned int nnodes = 1;
+    for (unsigned int idim=0; idim<n.size(); idim++) {
+        if( n[idim]<2 ) ERROR("A profile table needs at least 2 nodes in each dimension");
+        nnodes *= n[idim];
+    }
+    
+    // Coordinates of all the nodes (last dimension varying fastest)
+    vector<vector<double> > x_nodes(n.size(), vector<double>(nnodes));
+    for (unsigned int inode=0; inode<nnodes; inode++) {
+        unsigned int k = inode;
+        for (int idim=n.size()-1; idim>=0; idim--) {
+            x_nodes[idim][inode] = xmin[idim] + (k%n[idim])*step[idim];
+            k /= n[idim];
+        }
+    }
+    
+    function->valuesAt(x_nodes, table->values);
+    table->xmin = xmin;
+    table->step = step;
+    table->n    = n;
+}
+
+
+// Linear interpolation of the table
+//   locations closer than 1e-9 step to a node (rounding errors) are taken on the node,
+//   where the tabulated value is returned exactly
+bool ProfileTable::interpolate(vector<double> &coordinates, double &value)
+{
+    unsigned int ndim = n.size();
+    vector<unsigned int> index(ndim);
+    vector<double> w(ndim);
+    for (unsigned int idim=0; idim<ndim; idim++) {
+        double u = (coordinates[idim]-xmin[idim])/step[idim];
+        double node = floor(u+0.5);
+        if( abs(u-node)<1.e-9 ) u = node;
+        if( u<0. || u>(double)(n[idim]-1) ) return false;
+        index[idim] = (unsigned int)u;
+        if( index[idim]>n[idim]-2 ) index[idim] = n[idim]-2;
+        w[idim] = u - (double)index[idim];
+    }
+    
+    // Sum over the corners of the surrounding cell
+    value = 0.;
+    for (unsigned int corner=0; corner<(1u<<ndim); corner++) {
+        double weight = 1.;
+        unsigned int inode = 0;
+        for (unsigned int idim=0; idim<ndim; idim++) {
+            unsigned int shift = (corner>>idim) & 1;
+            weight *= shift ? w[idim] : 1.-w[idim];
+            inode = inode*n[idim] + index[idim] + shift;
+        }
+        if( weight==0. ) continue;
+        value += weight * values[inode];
+    }
+    return true;
 }
 
 
@@ -271,6 +367,38 @@ double Function_Python4D::valueAt(vector<double> x_cell, double time) {
     return PyTools::runPyFunction(py_profile, x_cell[0], x_cell[1], x_cell[2], time);
 }
 
+// Functions to evaluate a python function at many points at once.
+// The coordinates are passed as numpy arrays in a single call. If the function
+// does not accept arrays, it is called point by point from then on.
+inline bool valuesAtOnce(PyObject *py_profile, bool &vectorized, vector<vector<double> > &x_cells, unsigned int nx,
+                         vector<double> &values, bool withTime=false, double time=0.) {
+    if( !vectorized || x_cells[0].size()<2 ) return false;
+    vectorized = PyTools::runPyFunctionOnArrays(py_profile, x_cells, nx, values, withTime, time);
+    return vectorized;
+}
+// 1D
+void Function_Python1D::valuesAt(vector<vector<double> > &x_cells, vector<double> &values) {
+    if( !valuesAtOnce(py_profile, vectorized, x_cells, 1, values) ) Function::valuesAt(x_cells, values);
+}
+// 2D
+void Function_Python2D::valuesAt(vector<vector<double> > &x_cells, double time, vector<double> &values) {
+    if( !valuesAtOnce(py_profile, vectorized, x_cells, 1, values, true, time) ) Function::valuesAt(x_cells, time, values);
+}
+void Function_Python2D::valuesAt(vector<vector<double> > &x_cells, vector<double> &values) {
+    if( !valuesAtOnce(py_profile, vectorized, x_cells, 2, values) ) Function::valuesAt(x_cells, values);
+}
+// 3D
+void Function_Python3D::valuesAt(vector<vector<double> > &x_cells, double time, vector<double> &values) {
+    if( !valuesAtOnce(py_profile, vectorized, x_cells, 2, values, true, time) ) Function::valuesAt(x_cells, time, values);
+}
+void Function_Python3D::valuesAt(vector<vector<double> > &x_cells, vector<double> &values) {
+    if( !valuesAtOnce(py_profile, vectorized, x_cells, 3, values) ) Function::valuesAt(x_cells, values);
+}
+// 4D
+void Function_Python4D::valuesAt(vector<vector<double> > &x_cells, double time, vector<double> &values) {
+    if( !valuesAtOnce(py_profile, vectorized, x_cells, 3, values, true, time) ) Function::valuesAt(x_cells, time, values);
+}
+
 // Constant profiles
 double Function_Constant1D::valueAt(vector<double> x_cell) {
     return (x_cell[0]>xvacuum) ? value : 0.;
@@ -29,6 +29,50 @@ public:
     virtual double valueAt(std::vector<double>, double ) {
         return 0.;
     };
+    // spatial, at many points at once (coordinates[idim][ipoint])
+    virtual void valuesAt(std::vector<std::vector<double> > &coordinates, std::vector<double> &values) {
+        unsigned int n = coordinates[0].size();
+        std::vector<double> x(coordinates.size());
+        values.resize(n);
+        for (unsigned int i=0; i<n; i++) {
+            for (unsigned int idim=0; idim<x.size(); idim++) x[idim] = coordinates[idim][i];
+            values[i] = valueAt(x);
+        }
+    };
+    // spatio-temporal, at many points at once (coordinates[idim][ipoint])
+    virtual void valuesAt(std::vector<std::vector<double> > &coordinates, double time, std::vector<double> &values) {
+        unsigned int n = coordinates[0].size();
+        std::vector<double> x(coordinates.size());
+        values.resize(n);
+        for (unsigned int i=0; i<n; i++) {
+            for (unsigned int idim=0; idim<x.size(); idim++) x[idim] = coordinates[idim][i];
+            values[i] = valueAt(x, time);
+        }
+    };
+};
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class ProfileTable: values of a spatial profile on the regular grid of nodes xmin + k*step,
+//! shared by a profile and all its clones on one MPI process
+//  --------------------------------------------------------------------------------------------------------------------
+class ProfileTable
+{
+public:
+    ProfileTable() : nprofiles(1) {};
+    
+    //! Linear interpolation of the table at some location. Returns false if the location is outside the table
+    bool interpolate(std::vector<double> &coordinates, double &value);
+    
+    //! Number of profiles sharing this table
+    unsigned int nprofiles;
+    
+    //! First node, distance between nodes and number of nodes in each dimension
+    std::vector<double> xmin, step;
+    std::vector<unsigned int> n;
+    
+    //! Values at the nodes (empty when the profile is not tabulated)
+    std::vector<double> values;
 };
 
 
@@ -47,6 +91,8 @@ public:
     
     //! Get the value of the profile at some location (spatial)
     inline double valueAt(std::vector<double> coordinates) {
+        double value;
+        if( table->values.size()>0 && table->interpolate(coordinates, value) ) return value;
         return function->valueAt(coordinates);
     };
     //! Get the value of the profile at some location (temporal)
@@ -58,9 +104,24 @@ public:
         return function->valueAt(coordinates, time);
     };
     
+    //! Get the values of the profile at many locations at once (spatial), coordinates[idim][ipoint].
+    //! Python functions are called only once, with numpy arrays, when they support it
+    void valuesAt(std::vector<std::vector<double> > &coordinates, std::vector<double> &values);
+    //! Get the values of the profile at many locations at once (spatio-temporal)
+    inline void valuesAt(std::vector<std::vector<double> > &coordinates, double time, std::vector<double> &values) {
+        function->valuesAt(coordinates, time, values);
+    };
+    
+    //! Tabulate the profile (spatial) on the nodes xmin + k*step, k<n, in a single evaluation.
+    //! Then this profile and all its clones interpolate the table at the locations inside it
+    void tabulate(std::vector<double> xmin, std::vector<double> step, std::vector<unsigned int> n);
+    
     //! Get info on the loaded profile, to be printed later
     inline std::string getInfo() { return info; };
     
+    //! True if the profile calls a python function (which cannot be done by several threads at once)
+    inline bool usesPython() { return profileName==""; };
+    
     //! Name of the profile, in the case of a built-in profile
     std::string profileName;
     
@@ -74,6 +135,9 @@ private:
     //! Number of variables for the profile function
     int nvariables;
     
+    //! Table of values, shared with the clones of this profile
+    ProfileTable * table;
+    
 };//END class Profile
 
 
@@ -83,47 +147,61 @@ private:
 class Function_Python1D : public Function
 {
 public:
-    Function_Python1D(PyObject *pp) : py_profile(pp) {};
-    Function_Python1D(Function_Python1D *f) : py_profile(f->py_profile) {};
+    Function_Python1D(PyObject *pp) : py_profile(pp), vectorized(true) {};
+    Function_Python1D(Function_Python1D *f) : py_profile(f->py_profile), vectorized(f->vectorized) {};
     double valueAt(double); // time
     double valueAt(std::vector<double>); // space
+    void valuesAt(std::vector<std::vector<double> >&, std::vector<double>&); // space
 private:
     PyObject *py_profile;
+    //! False once the function failed to evaluate numpy arrays
+    bool vectorized;
 };
 
 
 class Function_Python2D : public Function
 {
 public:
-    Function_Python2D(PyObject *pp) : py_profile(pp) {};
-    Function_Python2D(Function_Python2D *f) : py_profile(f->py_profile) {};
+    Function_Python2D(PyObject *pp) : py_profile(pp), vectorized(true) {};
+    Function_Python2D(Function_Python2D *f) : py_profile(f->py_profile), vectorized(f->vectorized) {};
     double valueAt(std::vector<double>, double); // space + time
     double valueAt(std::vector<double>); // space
+    void valuesAt(std::vector<std::vector<double> >&, double, std::vector<double>&); // space + time
+    void valuesAt(std::vector<std::vector<double> >&, std::vector<double>&); // space
 private:
     PyObject *py_profile;
+    //! False once the function failed to evaluate numpy arrays
+    bool vectorized;
 };
 
 
 class Function_Python3D : public Function
 {
 public:
-    Function_Python3D(PyObject *pp) : py_profile(pp) {};
-    Function_Python3D(Function_Python3D *f) : py_profile(f->py_profile) {};
+    Function_Python3D(PyObject *pp) : py_profile(pp), vectorized(true) {};
+    Function_Python3D(Function_Python3D *f) : py_profile(f->py_profile), vectorized(f->vectorized) {};
     double valueAt(std::vector<double>, double); // space + time
     double valueAt(std::vector<double>); // space
+    void valuesAt(std::vector<std::vector<double> >&, double, std::vector<double>&); // space + time
+    void valuesAt(std::vector<std::vector<double> >&, std::vector<double>&); // space
 private:
     PyObject *py_profile;
+    //! False once the function failed to evaluate numpy arrays
+    bool vectorized;
 };
 
 
 class Function_Python4D : public Function
 {
 public:
-    Function_Python4D(PyObject *pp) : py_profile(pp) {};
-    Function_Python4D(Function_Python4D *f) : py_profile(f->py_profile) {};
+    Function_Python4D(PyObject *pp) : py_profile(pp), vectorized(true) {};
+    Function_Python4D(Function_Python4D *f) : py_profile(f->py_profile), vectorized(f->vectorized) {};
     double valueAt(std::vector<double>, double); // space + time
+    void valuesAt(std::vector<std::vector<double> >&, double, std::vector<double>&); // space + time
 private:
     PyObject *py_profile;
+    //! False once the function failed to evaluate numpy arrays
+    bool vectorized;
 };
 
 
@@ -31,7 +31,13 @@ public:
     virtual void operator() (Field* Jx, Field* Jy, Field* Jz, Particles &particles, int ipart, LocalFields Jion) = 0;
 
    //!Wrapper
-    virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec) = 0;
+   //!  gf, iold and deltaold of particle ipart are read at index ipart-ipart_ref of the thread buffers
+    virtual void operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec, int ipart_ref = 0) = 0;
+
+protected:
+    //! Number of particles whose shape factors and local currents are computed at once by the vectorized projections
+    static const int vecsize = 32;
+
 private:
 
 };
@@ -114,6 +114,74 @@ void Projector1D2Order::operator() (double* Jx, double* Jy, double* Jz, Particle
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project current densities of particles istart to iend-1 : vectorized main projector
+//!   gf, iold and delta point to the buffered values of particle istart.
+//!   Shape factors and local currents of vecsize particles are computed at once in SoA arrays, then added particle
+//!   by particle to the window of the bin in the current densities (same values, same order as the scalar projector).
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector1D2Order::projectCurrentsBlock(double* Jx, double* Jy, double* Jz, Particles &particles, int istart, int iend, double* gf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* delta)
+{
+    double* position_x = particles.position(0).data();
+    particle_real* momentum_y = particles.momentum(1).data();
+    particle_real* momentum_z = particles.momentum(2).data();
+    particle_real* weight     = particles.weight().data();
+    short*  charge     = particles.charge().data();
+    
+    // Local currents, stored as [particle][stencil point]
+    double Jx_p[5*vecsize], Jy_p[5*vecsize], Jz_p[5*vecsize];
+    
+    for (int ivect=istart ; ivect<iend ; ivect+=vecsize) {
+        int np = min( vecsize, iend-ivect );
+        int*    iold_v  = iold  + (ivect-istart);
+        double* delta_v = delta + (ivect-istart);
+        double* gf_v    = gf    + (ivect-istart);
+        
+        #pragma omp simd
+        for (int ip=0 ; ip<np ; ip++) {
+            int ipart = ivect+ip;
+            double charge_weight = (double)(charge[ipart])*weight[ipart];
+            double crx_p = charge_weight*dx_ov_dt;
+            double cry_p = charge_weight*momentum_y[ipart]/gf_v[ip];
+            double crz_p = charge_weight*momentum_z[ipart]/gf_v[ip];
+            
+            // Locate particle old position on the primal grid
+            double xj_m_xipo  = delta_v[ip];
+            double xj_m_xipo2 = xj_m_xipo*xj_m_xipo;
+            
+            // Locate particle new position on the primal grid
+            double xjn       = position_x[ipart] * dx_inv_;
+            int    ipn       = round(xjn);
+            double xj_m_xip  = xjn - (double)ipn;
+            double xj_m_xip2 = xj_m_xip*xj_m_xip;
+            int    ip_m_ipo  = ipn-iold_v[ip]-index_domain_begin;
+            
+            double S0, S1, Jx_cumul(0.), Wl_prev(0.);
+            for (int i=0 ; i<5 ; i++) {
+                S0 = (i==1) ? 0.5 * (xj_m_xipo2-xj_m_xipo+0.25) : ( (i==2) ? (0.75-xj_m_xipo2) : ( (i==3) ? 0.5 * (xj_m_xipo2+xj_m_xipo+0.25) : 0. ) );
+                S1 = (i==ip_m_ipo+1) ? 0.5 * (xj_m_xip2-xj_m_xip+0.25) : ( (i==ip_m_ipo+2) ? (0.75-xj_m_xip2) : ( (i==ip_m_ipo+3) ? 0.5 * (xj_m_xip2+xj_m_xip+0.25) : 0. ) );
+                // Esirkepov : longitudinal current from the charge conservation equation
+                if (i>0) Jx_cumul = Jx_cumul + crx_p * Wl_prev;
+                Wl_prev = S0 - S1;
+                Jx_p[5*ip+i] = Jx_cumul;
+                Jy_p[5*ip+i] = cry_p * (0.5 * (S0 + S1));
+                Jz_p[5*ip+i] = crz_p * (0.5 * (S0 + S1));
+            }
+        }
+        
+        // 2nd order projection for the total currents
+        for (int ip=0 ; ip<np ; ip++) {
+            int ipo = iold_v[ip] - (bin + 2);
+            for (int i=0 ; i<5 ; i++) {
+                Jx[i + ipo]  += Jx_p[5*ip+i];
+                Jy[i + ipo]  += Jy_p[5*ip+i];
+                Jz[i + ipo]  += Jz_p[5*ip+i];
+            }
+        }
+    }
+} // END Project local current densities (vectorized)
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
@@ -321,7 +389,7 @@ void Projector1D2Order::operator() (Field* Jx, Field* Jy, Field* Jz, Particles &
 
 } // END Project global current densities (ionize)
 
-void Projector1D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec)
+void Projector1D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec, int ipart_ref)
 {
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
@@ -331,15 +399,14 @@ void Projector1D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
         double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw);
         double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw);
         double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw);
-        for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+        projectCurrentsBlock(b_Jx , b_Jy , b_Jz , particles, istart, iend, gf->data()+(istart-ipart_ref), ibin*clrw, b_dim, iold->data()+(istart-ipart_ref), delta->data()+(istart-ipart_ref));
     } else {
         double* b_Jx =  &(*EMfields->Jx_s[ispec] )(ibin*clrw);
         double* b_Jy =  &(*EMfields->Jy_s[ispec] )(ibin*clrw);
         double* b_Jz =  &(*EMfields->Jz_s[ispec] )(ibin*clrw);
         double* b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw);
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart-ipart_ref], ibin*clrw, b_dim, &(*iold)[ipart-ipart_ref], &(*delta)[ipart-ipart_ref]);
     }
 }
 
@@ -288,7 +288,7 @@ void Projector1D4Order::operator() (Field* Jx, Field* Jy, Field* Jz, Particles &
 } // END Project global current densities (ionize)
 
 
-void Projector1D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec)
+void Projector1D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec, int ipart_ref)
 {
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
@@ -299,14 +299,14 @@ void Projector1D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
         double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw);
         double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw);
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart-ipart_ref], ibin*clrw, b_dim, &(*iold)[ipart-ipart_ref], &(*delta)[ipart-ipart_ref]);
     } else {
         double* b_Jx =  &(*EMfields->Jx_s[ispec] )(ibin*clrw);
         double* b_Jy =  &(*EMfields->Jy_s[ispec] )(ibin*clrw);
         double* b_Jz =  &(*EMfields->Jz_s[ispec] )(ibin*clrw);
         double* b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw);
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[ipart], &(*delta)[ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart-ipart_ref], ibin*clrw, b_dim, &(*iold)[ipart-ipart_ref], &(*delta)[ipart-ipart_ref]);
     }
 
 }
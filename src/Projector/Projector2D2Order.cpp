@@ -168,6 +168,131 @@ void Projector2D2Order::operator() (double* Jx, double* Jy, double* Jz, Particle
 } // END Project local current densities (sort)
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Project current densities of particles istart to iend-1 : vectorized main projector
+//!   gf, iold and deltaold point to the buffered values of particle istart.
+//!   Shape factors and local currents of vecsize particles are computed at once in SoA arrays, without any dependency
+//!   between particles. They are then added particle by particle to the window of the bin in the current densities,
+//!   which avoids scatter conflicts and adds the same values in the same order as the scalar projector.
+// ---------------------------------------------------------------------------------------------------------------------
+void Projector2D2Order::projectCurrentsBlock(double* Jx, double* Jy, double* Jz, Particles &particles, int istart, int iend, double* gf, unsigned int bin, std::vector<unsigned int> &b_dim, int* iold, double* deltaold)
+{
+    double* position_x = particles.position(0).data();
+    double* position_y = particles.position(1).data();
+    particle_real* momentum_z = particles.momentum(2).data();
+    particle_real* weight     = particles.weight().data();
+    short*  charge     = particles.charge().data();
+    
+    // Esirkepov coefficients of the block, stored as [particle][stencil point]
+    double Sx0[5*vecsize], Sx1[5*vecsize], Sy0[5*vecsize], Sy1[5*vecsize], DSx[5*vecsize], DSy[5*vecsize];
+    double crx_p[vecsize], cry_p[vecsize], crz_p[vecsize];
+    
+    int dim1 = b_dim[1];
+    
+    for (int ivect=istart ; ivect<iend ; ivect+=vecsize) {
+        int np = min( vecsize, iend-ivect );
+        int*    iold_v  = iold     + 2*(ivect-istart);
+        double* delta_v = deltaold + 2*(ivect-istart);
+        double* gf_v    = gf       +   (ivect-istart);
+        
+        // --------------------------------------------------------
+        // Locate particles & Calculate Esirkepov coef. S, DS
+        // --------------------------------------------------------
+        #pragma omp simd
+        for (int ip=0 ; ip<np ; ip++) {
+            int ipart = ivect+ip;
+            double charge_weight = (double)(charge[ipart])*weight[ipart];
+            crx_p[ip] = charge_weight*dx_ov_dt;
+            cry_p[ip] = charge_weight*dy_ov_dt;
+            crz_p[ip] = charge_weight*momentum_z[ipart]/gf_v[ip];
+            
+            double delta, delta2, s0, s1, s2;
+            int ipn, ip_m_ipo;
+            
+            // former time-step
+            delta  = delta_v[2*ip];
+            delta2 = delta*delta;
+            Sx0[5*ip  ] = 0.;
+            Sx0[5*ip+1] = 0.5 * (delta2-delta+0.25);
+            Sx0[5*ip+2] = 0.75-delta2;
+            Sx0[5*ip+3] = 0.5 * (delta2+delta+0.25);
+            Sx0[5*ip+4] = 0.;
+            
+            delta  = delta_v[2*ip+1];
+            delta2 = delta*delta;
+            Sy0[5*ip  ] = 0.;
+            Sy0[5*ip+1] = 0.5 * (delta2-delta+0.25);
+            Sy0[5*ip+2] = 0.75-delta2;
+            Sy0[5*ip+3] = 0.5 * (delta2+delta+0.25);
+            Sy0[5*ip+4] = 0.;
+            
+            // current time-step, shifted by -1, 0 or +1 node from the former one
+            double xpn = position_x[ipart] * dx_inv_;
+            ipn      = round(xpn);
+            ip_m_ipo = ipn-iold_v[2*ip]-i_domain_begin;
+            delta    = xpn - (double)ipn;
+            delta2   = delta*delta;
+            s0 = 0.5 * (delta2-delta+0.25);
+            s1 = 0.75-delta2;
+            s2 = 0.5 * (delta2+delta+0.25);
+            for (int i=0 ; i<5 ; i++) {
+                Sx1[5*ip+i] = (i==ip_m_ipo+1) ? s0 : ( (i==ip_m_ipo+2) ? s1 : ( (i==ip_m_ipo+3) ? s2 : 0. ) );
+                DSx[5*ip+i] = Sx1[5*ip+i] - Sx0[5*ip+i];
+            }
+            
+            double ypn = position_y[ipart] * dy_inv_;
+            ipn      = round(ypn);
+            ip_m_ipo = ipn-iold_v[2*ip+1]-j_domain_begin;
+            delta    = ypn - (double)ipn;
+            delta2   = delta*delta;
+            s0 = 0.5 * (delta2-delta+0.25);
+            s1 = 0.75-delta2;
+            s2 = 0.5 * (delta2+delta+0.25);
+            for (int j=0 ; j<5 ; j++) {
+                Sy1[5*ip+j] = (j==ip_m_ipo+1) ? s0 : ( (j==ip_m_ipo+2) ? s1 : ( (j==ip_m_ipo+3) ? s2 : 0. ) );
+                DSy[5*ip+j] = Sy1[5*ip+j] - Sy0[5*ip+j];
+            }
+        }
+        
+        // ------------------------------------------------
+        // Local current created by the particles
+        // calculate using the charge conservation equation
+        // ------------------------------------------------
+        for (int ip=0 ; ip<np ; ip++) {
+            double *sx0 = &Sx0[5*ip], *sx1 = &Sx1[5*ip], *dsx = &DSx[5*ip];
+            double *sy0 = &Sy0[5*ip], *sy1 = &Sy1[5*ip], *dsy = &DSy[5*ip];
+            double crx = crx_p[ip], cry = cry_p[ip], crz = crz_p[ip]*one_third;
+            int ipo = iold_v[2*ip]   - (bin+2); //This minus 2 come from the order 2 scheme, based on a 5 points stencil from -2 to +2.
+            int jpo = iold_v[2*ip+1] - 2;
+            
+            // Jx accumulates along x, Jy along y
+            double tmpJx[5] = {0., 0., 0., 0., 0.};
+            double tmpJy[5];
+            for (int i=0 ; i<5 ; i++) {
+                int iloc  = (i+ipo)*dim1     + jpo;
+                int ilocy = (i+ipo)*(dim1+1) + jpo; //Because size of Jy in Y is b_dim[1]+1.
+                double tmp2 = 0.5*sx1[i] + sx0[i];
+                double tmp3 = 0.5*sx0[i] + sx1[i];
+                double tmpY = sx0[i] + 0.5*dsx[i];
+                for (int j=0 ; j<5 ; j++)
+                    Jz[iloc+j] += crz * ( sy0[j]*tmp2 + sy1[j]*tmp3 );
+                if (i>0) {
+                    for (int j=0 ; j<5 ; j++) {
+                        tmpJx[j] -= crx * dsx[i-1] * (sy0[j] + 0.5*dsy[j]);
+                        Jx[iloc+j] += tmpJx[j];
+                    }
+                }
+                tmpJy[0] = 0.;
+                for (int j=1 ; j<5 ; j++) {
+                    tmpJy[j] = tmpJy[j-1] - cry * dsy[j-1] * tmpY;
+                    Jy[ilocy+j] += tmpJy[j];
+                }
+            }
+        }
+    }
+} // END Project local current densities (vectorized)
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 //!  Project current densities & charge : diagFields timstep
 // ---------------------------------------------------------------------------------------------------------------------
@@ -376,7 +501,7 @@ void Projector2D2Order::operator() (Field* Jx, Field* Jy, Field* Jz, Particles &
 // ---------------------------------------------------------------------------------------------------------------------
 //! Wrapper for projection
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec)
+void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec, int ipart_ref)
 {
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
@@ -388,14 +513,13 @@ void Projector2D2Order::operator() (ElectroMagn* EMfields, Particles &particles,
         double* b_Jx =  &(*EMfields->Jx_ )(ibin*clrw*dim1);
         double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1));
         double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw*dim1);
-        for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[2*ipart], &(*delta)[2*ipart]);
+        projectCurrentsBlock(b_Jx , b_Jy , b_Jz , particles, istart, iend, gf->data()+(istart-ipart_ref), ibin*clrw, b_dim, iold->data()+2*(istart-ipart_ref), delta->data()+2*(istart-ipart_ref));
     } else {
         double* b_Jx =  &(*EMfields->Jx_s[ispec] )(ibin*clrw*dim1);
         double* b_Jy =  &(*EMfields->Jy_s[ispec] )(ibin*clrw*(dim1+1));
         double* b_Jz =  &(*EMfields->Jz_s[ispec] )(ibin*clrw*dim1);
         double* b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw*dim1);
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[2*ipart], &(*delta)[2*ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart-ipart_ref], ibin*clrw, b_dim, &(*iold)[2*(ipart-ipart_ref)], &(*delta)[2*(ipart-ipart_ref)]);
     }
 }
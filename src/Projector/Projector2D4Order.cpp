@@ -79,7 +79,7 @@ void  Projector2D4Order::operator() (Field* Jx, Field* Jy, Field* Jz, Particles
 // ---------------------------------------------------------------------------------------------------------------------
 //! Wrapper for projection
 // ---------------------------------------------------------------------------------------------------------------------
-void Projector2D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec)
+void Projector2D4Order::operator() (ElectroMagn* EMfields, Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ibin, int clrw, int diag_flag, std::vector<unsigned int> &b_dim, int ispec, int ipart_ref)
 {
     std::vector<int> *iold = &(smpi->dynamics_iold[ithread]);
     std::vector<double> *delta = &(smpi->dynamics_deltaold[ithread]);
@@ -92,13 +92,13 @@ void Projector2D4Order::operator() (ElectroMagn* EMfields, Particles &particles,
         double* b_Jy =  &(*EMfields->Jy_ )(ibin*clrw*(dim1+1));
         double* b_Jz =  &(*EMfields->Jz_ )(ibin*clrw*dim1);
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[2*ipart], &(*delta)[2*ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz , particles,  ipart, (*gf)[ipart-ipart_ref], ibin*clrw, b_dim, &(*iold)[2*(ipart-ipart_ref)], &(*delta)[2*(ipart-ipart_ref)]);
     } else {
         double* b_Jx =  &(*EMfields->Jx_s[ispec] )(ibin*clrw*dim1);
         double* b_Jy =  &(*EMfields->Jy_s[ispec] )(ibin*clrw*(dim1+1));
         double* b_Jz =  &(*EMfields->Jz_s[ispec] )(ibin*clrw*dim1);
         double* b_rho = &(*EMfields->rho_s[ispec])(ibin*clrw*dim1);
         for (int ipart=istart ; ipart<iend; ipart++ )
-            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart], ibin*clrw, b_dim, &(*iold)[2*ipart], &(*delta)[2*ipart]);
+            (*this)(b_Jx , b_Jy , b_Jz ,b_rho, particles,  ipart, (*gf)[ipart-ipart_ref], ibin*clrw, b_dim, &(*iold)[2*(ipart-ipart_ref)], &(*delta)[2*(ipart-ipart_ref)]);
     }
 }
@@ -12,6 +12,8 @@
 
 #include "Tools.h"
 
+//! Each projector class is written for one (dimension, order) : the class selected here, once per patch, is
+//! only called through one virtual call per bin (the pushers are templated on the dimension instead, see PusherBoris)
 class ProjectorFactory {
 public:
   static Projector* create(Params& params, Patch* patch) {
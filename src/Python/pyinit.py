@@ -123,7 +123,11 @@ class Main(SmileiSingleton):
     number_of_timesteps = None
     interpolation_order = 2
     number_of_patches = None
+    aggregate_mpi_messages = False
+    mpi_shared_memory = False
+    largest_patches_first = False
     clrw = 1
+    dynamics_block_size = 0
     timestep = None
     timestep_over_CFL = None
     
@@ -180,6 +184,10 @@ class LoadBalancing(SmileiSingleton):
     every = None
     coef_cell = 1.0
     coef_frozen = 0.1
+    measured_cost = False
+    max_migrating_patches = 0
+    node_aware = False
+    internode_tolerance = 0.05
 
 
 class MovingWindow(SmileiSingleton):
@@ -187,6 +195,7 @@ class MovingWindow(SmileiSingleton):
     
     time_start = 0.
     velocity_x = 1.
+    profile_sampling = 0
 
 
 class DumpRestart(SmileiSingleton):
@@ -207,6 +216,12 @@ class Species(SmileiComponent):
     initMomentum_type = ""
     n_part_per_cell = None
     c_part_max = 1.0
+    sort_mode = "bin"
+    merge_every = 0
+    merge_min_particles_per_cell = 8
+    merge_min_packet_size = 4
+    merge_max_packet_size = 4
+    merge_momentum_cell_size = [16, 16, 16]
     mass = None
     charge = None
     charge_density = None
@@ -239,6 +254,7 @@ class Laser(SmileiComponent):
     space_envelope = [1., 0.]
     phase = [0., 0.]
     space_time_profile = None
+    time_envelope_sampling = 0.
 
 class Collisions(SmileiComponent):
     """Collisions parameters"""
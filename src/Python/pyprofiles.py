@@ -386,7 +386,7 @@ def transformPolarization(polarizationPhi, ellipticity):
 
 
 def LaserPlanar1D( boxSide="west", a0=1., omega=1.,
-        polarizationPhi=0., ellipticity=0., time_envelope=tconstant()):
+        polarizationPhi=0., ellipticity=0., time_envelope=tconstant(), time_envelope_sampling=0.):
     import math
     # Polarization and amplitude
     [dephasing, amplitudeY, amplitudeZ] = transformPolarization(polarizationPhi, ellipticity)
@@ -398,6 +398,7 @@ def LaserPlanar1D( boxSide="west", a0=1., omega=1.,
         omega          = omega,
         chirp_profile  = tconstant(),
         time_envelope  = time_envelope,
+        time_envelope_sampling = time_envelope_sampling,
         space_envelope = [ amplitudeZ, amplitudeY ],
         phase          = [ dephasing, 0. ],
     )
@@ -405,7 +406,7 @@ def LaserPlanar1D( boxSide="west", a0=1., omega=1.,
 
 
 def LaserGaussian2D( boxSide="west", a0=1., omega=1., focus=None, waist=3., incidence_angle=0.,
-        polarizationPhi=0., ellipticity=0., time_envelope=tconstant()):
+        polarizationPhi=0., ellipticity=0., time_envelope=tconstant(), time_envelope_sampling=0.):
     import math
     # Polarization and amplitude
     [dephasing, amplitudeY, amplitudeZ] = transformPolarization(polarizationPhi, ellipticity)
@@ -444,6 +445,7 @@ def LaserGaussian2D( boxSide="west", a0=1., omega=1., focus=None, waist=3., inci
         omega          = omega,
         chirp_profile  = tconstant(),
         time_envelope  = time_envelope,
+        time_envelope_sampling = time_envelope_sampling,
         space_envelope = [ lambda y:amplitudeZ*spatial(y), lambda y:amplitudeY*spatial(y) ],
         phase          = [ lambda y:phase(y)-phaseZero+dephasing, lambda y:phase(y)-phaseZero ],
     )
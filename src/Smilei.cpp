@@ -226,6 +226,9 @@ int main (int argc, char* argv[])
             // apply collisions if requested
             vecPatches.applyCollisions(params, itime, timer);
             
+            // merge macro-particles if requested
+            vecPatches.mergeParticles(params, itime, timer);
+            
             // (1) interpolate the fields at the particle position
             // (2) move the particle
             // (3) calculate the currents (charge conserving method)
@@ -273,6 +276,10 @@ int main (int argc, char* argv[])
             timer[7].restart();
             vecPatches.load_balance( params, time_dual, smpi, simWindow );
             timer[7].update();
+        } else if ( vecPatches.isMigrating() ) {
+            timer[7].restart();
+            vecPatches.migratePatches( params, smpi, simWindow );
+            timer[7].update();
         }
         
         latestTimeStep = itime;
@@ -341,6 +348,10 @@ void print_parallelism_params(Params& params, SmileiMPI* smpi)
         MESSAGE(2, "dimension " << iDim << " - n_space : " << params.n_space[iDim] << " cells.");        
 
     MESSAGE(1, "Dynamic load balancing frequency: every " << params.balancing_every << " iterations." );
+    if (params.aggregate_mpi_messages)
+        MESSAGE(1, "Ghost cells and particles aggregated in one message per neighbor process and direction." );
+    if (params.mpi_shared_memory)
+        MESSAGE(1, "Messages to the processes of the same node copied through MPI shared memory." );
 
     // setup OpenMP
     TITLE("OpenMP");
@@ -352,6 +363,8 @@ void print_parallelism_params(Params& params, SmileiMPI* smpi)
 //    }
     if (smpi->isMaster())
         MESSAGE(1,"Number of thread per MPI process : " << omp_get_max_threads() );
+    if (params.largest_patches_first)
+        MESSAGE(1,"Patches handed to the threads by decreasing cost" );
 #else
     if (smpi->isMaster()) MESSAGE("Disabled");
 #endif
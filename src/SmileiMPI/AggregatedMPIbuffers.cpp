@@ -0,0 +1,554 @@
+#include "AggregatedMPIbuffers.h"
+
+#include <map>
+#include <cstring>
+
+#include "VectorPatch.h"
+#include "Patch.h"
+#include "Field.h"
+
+using namespace std;
+
+AggregatedMPIbuffers::AggregatedMPIbuffers() :
+    enabled(false),
+    valid(false),
+    sharedMemory(false),
+    nodeComm_(MPI_COMM_NULL),
+    nodeSize_(0),
+    worldRank_(0)
+{
+}
+
+
+AggregatedMPIbuffers::~AggregatedMPIbuffers()
+{
+}
+
+
+void AggregatedMPIbuffers::allocate(int ndims)
+{
+    sendRank_ .resize(ndims);
+    recvRank_ .resize(ndims);
+    sendFirst_.resize(ndims);
+    recvFirst_.resize(ndims);
+    sendPatch_.resize(ndims);
+    recvPatch_.resize(ndims);
+
+    // 5 lists of fields at once (see SyncVectorPatch) + the particles
+    sendBuffer_.resize(6);
+    recvBuffer_.resize(6);
+    srequest_  .resize(6);
+    rrequest_  .resize(6);
+    for (unsigned int itag=0 ; itag<srequest_.size() ; itag++) {
+        sendBuffer_[itag].resize(ndims);
+        recvBuffer_[itag].resize(ndims);
+        srequest_  [itag].resize(ndims);
+        rrequest_  [itag].resize(ndims);
+    }
+
+    sendCount_    .resize(ndims);
+    recvCount_    .resize(ndims);
+    sendOffset_   .resize(ndims);
+    recvOffset_   .resize(ndims);
+    sendParticles_.resize(ndims);
+    recvParticles_.resize(ndims);
+
+    if (sharedMemory) {
+        // Processes sharing memory with this one, identified by their rank in MPI_COMM_WORLD
+        MPI_Comm_rank( MPI_COMM_WORLD, &worldRank_ );
+        int worldSize;
+        MPI_Comm_size( MPI_COMM_WORLD, &worldSize );
+        MPI_Comm_split_type( MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, worldRank_, MPI_INFO_NULL, &nodeComm_ );
+        MPI_Comm_size( nodeComm_, &nodeSize_ );
+        vector<int> worldRanks( nodeSize_ );
+        MPI_Allgather( &worldRank_, 1, MPI_INT, &(worldRanks[0]), 1, MPI_INT, nodeComm_ );
+        nodeRank_.resize( worldSize, -1 );
+        for (int irk=0 ; irk<nodeSize_ ; irk++)
+            nodeRank_[ worldRanks[irk] ] = irk;
+
+        window_     .resize( 6, MPI_WIN_NULL );
+        regionSize_ .resize( 6, 0 );
+        segment_    .resize( 6 );
+        sharedCopy_ .resize( 6 );
+        for (unsigned int itag=0 ; itag<sharedCopy_.size() ; itag++)
+            sharedCopy_[itag].resize(ndims);
+    }
+
+    valid = false;
+}
+
+
+void AggregatedMPIbuffers::release()
+{
+    for (unsigned int itag=0 ; itag<window_.size() ; itag++) {
+        if (window_[itag]==MPI_WIN_NULL) continue;
+        MPI_Win_unlock_all( window_[itag] );
+        MPI_Win_free( &(window_[itag]) );
+        regionSize_[itag] = 0;
+    }
+    if (nodeComm_!=MPI_COMM_NULL)
+        MPI_Comm_free( &nodeComm_ );
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Group the patches which have a neighbor owned by another process per neighbor process
+//   - the sender lists its patches by increasing hindex
+//   - the receiver lists its patches by increasing hindex of their neighbor (the sending patch)
+//   so that both sides agree on the position of the data of each patch in the messages, without communication
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::build( VectorPatch& vecPatches )
+{
+    for (unsigned int iDim=0 ; iDim<sendRank_.size() ; iDim++) {
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+
+            map< int, vector<unsigned int> > sendPatches;
+            map< int, map<unsigned int, unsigned int> > recvPatches;
+            for (unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++) {
+                Patch* patch = vecPatches(ipatch);
+                if ( patch->is_a_MPI_neighbor( iDim, iNeighbor ) ) {
+                    sendPatches[ patch->MPI_neighbor_[iDim][iNeighbor] ].push_back( ipatch );
+                    recvPatches[ patch->MPI_neighbor_[iDim][iNeighbor] ][ patch->neighbor_[iDim][iNeighbor] ] = ipatch;
+                }
+            }
+
+            sendRank_ [iDim][iNeighbor].resize(0);
+            sendFirst_[iDim][iNeighbor].resize(1, 0);
+            sendPatch_[iDim][iNeighbor].resize(0);
+            for (map< int, vector<unsigned int> >::iterator it=sendPatches.begin() ; it!=sendPatches.end() ; it++) {
+                sendRank_[iDim][iNeighbor].push_back( it->first );
+                for (unsigned int i=0 ; i<it->second.size() ; i++)
+                    sendPatch_[iDim][iNeighbor].push_back( it->second[i] );
+                sendFirst_[iDim][iNeighbor].push_back( sendPatch_[iDim][iNeighbor].size() );
+            }
+
+            recvRank_ [iDim][iNeighbor].resize(0);
+            recvFirst_[iDim][iNeighbor].resize(1, 0);
+            recvPatch_[iDim][iNeighbor].resize(0);
+            for (map< int, map<unsigned int, unsigned int> >::iterator it=recvPatches.begin() ; it!=recvPatches.end() ; it++) {
+                recvRank_[iDim][iNeighbor].push_back( it->first );
+                for (map<unsigned int, unsigned int>::iterator ip=it->second.begin() ; ip!=it->second.end() ; ip++)
+                    recvPatch_[iDim][iNeighbor].push_back( ip->second );
+                recvFirst_[iDim][iNeighbor].push_back( recvPatch_[iDim][iNeighbor].size() );
+            }
+
+            for (unsigned int itag=0 ; itag<srequest_.size() ; itag++) {
+                srequest_[itag][iDim][iNeighbor].resize( sendRank_[iDim][iNeighbor].size(), MPI_REQUEST_NULL );
+                rrequest_[itag][iDim][iNeighbor].resize( recvRank_[iDim][iNeighbor].size(), MPI_REQUEST_NULL );
+            }
+        }
+    }
+
+    valid = true;
+
+} // END build
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Pack the ghost cells along iDim of all the patches and post one message per neighbor process and direction
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::initFields( vector<Field*>& fields, VectorPatch& vecPatches, int iDim, int itag, bool sum )
+{
+    unsigned int width, sendStart[2], recvStart[2];
+    fieldLayers( fields[0], vecPatches, iDim, sum, width, sendStart, recvStart );
+    unsigned int size = layersSize( fields[0], iDim, width );
+
+    #pragma omp single
+    {
+        if (!valid) build( vecPatches );
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            sendBuffer_[itag][iDim][iNeighbor].resize( sendPatch_[iDim][iNeighbor].size()*size );
+            recvBuffer_[itag][iDim][iNeighbor].resize( recvPatch_[iDim][iNeighbor].size()*size );
+        }
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        vector<unsigned int>& patches = sendPatch_[iDim][iNeighbor];
+        double* buf = sendBuffer_[itag][iDim][iNeighbor].data();
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<patches.size() ; i++)
+            packLayers( fields[patches[i]], iDim, sendStart[iNeighbor], width, &(buf[i*size]) );
+    }
+
+    #pragma omp single
+    {
+        char* sendBuf[2], *recvBuf[2];
+        vector<size_t>* noOffset[2] = { NULL, NULL };
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            sendBuf[iNeighbor] = (char*)( sendBuffer_[itag][iDim][iNeighbor].data() );
+            recvBuf[iNeighbor] = (char*)( recvBuffer_[itag][iDim][iNeighbor].data() );
+        }
+        post( iDim, itag, MPI_DOUBLE, size*sizeof(double), sendBuf, recvBuf, noOffset, noOffset );
+    }
+
+} // END initFields
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Wait for the messages of initFields and unpack them in the ghost cells
+//   - the data received from the neighbor 1 first, as in Patch::finalizeSumField
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::finalizeFields( vector<Field*>& fields, VectorPatch& vecPatches, int iDim, int itag, bool sum )
+{
+    unsigned int width, sendStart[2], recvStart[2];
+    fieldLayers( fields[0], vecPatches, iDim, sum, width, sendStart, recvStart );
+    unsigned int size = layersSize( fields[0], iDim, width );
+
+    #pragma omp single
+    wait( iDim, itag );
+
+    for (int iNeighbor=1 ; iNeighbor>=0 ; iNeighbor--) {
+        vector<unsigned int>& patches = recvPatch_[iDim][iNeighbor];
+        double* buf = recvBuffer_[itag][iDim][iNeighbor].data();
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<patches.size() ; i++)
+            unpackLayers( fields[patches[i]], iDim, recvStart[iNeighbor], width, &(buf[i*size]), sum );
+    }
+
+} // END finalizeFields
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Exchange the numbers of particles to send (Patch::initCommParticles only sets them for the MPI neighbors)
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::exchangeParticleCounts( VectorPatch& vecPatches, int ispec, int iDim )
+{
+    #pragma omp single
+    {
+        if (!valid) build( vecPatches );
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            sendCount_[iDim][iNeighbor].resize( sendPatch_[iDim][iNeighbor].size() );
+            recvCount_[iDim][iNeighbor].resize( recvPatch_[iDim][iNeighbor].size() );
+        }
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        vector<unsigned int>& patches = sendPatch_[iDim][iNeighbor];
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<patches.size() ; i++)
+            sendCount_[iDim][iNeighbor][i] = vecPatches(patches[i])->vecSpecies[ispec]->MPIbuff.part_index_send_sz[iDim][iNeighbor];
+    }
+
+    #pragma omp single
+    {
+        char* sendBuf[2], *recvBuf[2];
+        vector<size_t>* noOffset[2] = { NULL, NULL };
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            sendBuf[iNeighbor] = (char*)( sendCount_[iDim][iNeighbor].data() );
+            recvBuf[iNeighbor] = (char*)( recvCount_[iDim][iNeighbor].data() );
+        }
+        post( iDim, 5, MPI_INT, sizeof(int), sendBuf, recvBuf, noOffset, noOffset );
+        wait( iDim, 5 );
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        vector<unsigned int>& patches = recvPatch_[iDim][iNeighbor];
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<patches.size() ; i++)
+            vecPatches(patches[i])->vecSpecies[ispec]->MPIbuff.part_index_recv_sz[iDim][iNeighbor] = recvCount_[iDim][iNeighbor][i];
+    }
+
+} // END exchangeParticleCounts
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Exchange the particles, packed one patch after the other (see Particles::pack)
+//   - the receive buffers of the species have been initialized to the numbers of exchangeParticleCounts
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::exchangeParticles( VectorPatch& vecPatches, int ispec, int iDim )
+{
+    #pragma omp single
+    {
+        size_t size = vecPatches(0)->vecSpecies[ispec]->particles->packedSize();
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            sendOffset_[iDim][iNeighbor].resize( sendCount_[iDim][iNeighbor].size()+1 );
+            sendOffset_[iDim][iNeighbor][0] = 0;
+            for (unsigned int i=0 ; i<sendCount_[iDim][iNeighbor].size() ; i++)
+                sendOffset_[iDim][iNeighbor][i+1] = sendOffset_[iDim][iNeighbor][i] + sendCount_[iDim][iNeighbor][i]*size;
+            sendParticles_[iDim][iNeighbor].resize( sendOffset_[iDim][iNeighbor].back() );
+
+            recvOffset_[iDim][iNeighbor].resize( recvCount_[iDim][iNeighbor].size()+1 );
+            recvOffset_[iDim][iNeighbor][0] = 0;
+            for (unsigned int i=0 ; i<recvCount_[iDim][iNeighbor].size() ; i++)
+                recvOffset_[iDim][iNeighbor][i+1] = recvOffset_[iDim][iNeighbor][i] + recvCount_[iDim][iNeighbor][i]*size;
+            recvParticles_[iDim][iNeighbor].resize( recvOffset_[iDim][iNeighbor].back() );
+        }
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        vector<unsigned int>& patches = sendPatch_[iDim][iNeighbor];
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<patches.size() ; i++)
+            vecPatches(patches[i])->vecSpecies[ispec]->MPIbuff.partSend[iDim][iNeighbor].pack( sendParticles_[iDim][iNeighbor].data() + sendOffset_[iDim][iNeighbor][i] );
+    }
+
+    #pragma omp single
+    {
+        char* sendBuf[2], *recvBuf[2];
+        vector<size_t>* sendOffset[2], *recvOffset[2];
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            sendBuf[iNeighbor] = sendParticles_[iDim][iNeighbor].data();
+            recvBuf[iNeighbor] = recvParticles_[iDim][iNeighbor].data();
+            sendOffset[iNeighbor] = &(sendOffset_[iDim][iNeighbor]);
+            recvOffset[iNeighbor] = &(recvOffset_[iDim][iNeighbor]);
+        }
+        post( iDim, 5, MPI_BYTE, 0, sendBuf, recvBuf, sendOffset, recvOffset );
+        wait( iDim, 5 );
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        vector<unsigned int>& patches = recvPatch_[iDim][iNeighbor];
+        #pragma omp for schedule(runtime)
+        for (unsigned int i=0 ; i<patches.size() ; i++)
+            vecPatches(patches[i])->vecSpecies[ispec]->MPIbuff.partRecv[iDim][iNeighbor].unpack( recvParticles_[iDim][iNeighbor].data() + recvOffset_[iDim][iNeighbor][i] );
+    }
+
+} // END exchangeParticles
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Layers exchanged along iDim, as in Patch::initSumField (sum) and Patch::initExchange
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::fieldLayers( Field* field, VectorPatch& vecPatches, int iDim, bool sum, unsigned int& width,
+                                        unsigned int* sendStart, unsigned int* recvStart )
+{
+    unsigned int oversize = vecPatches(0)->EMfields->oversize[iDim];
+    unsigned int n        = field->dims_[iDim];
+    unsigned int isDual   = field->isDual_[iDim];
+
+    if (sum) {
+        // 2 oversize (1 inside & 1 outside of the current subdomain)
+        width = 2*oversize + 1 + isDual;
+        sendStart[0] = 0;
+        sendStart[1] = n - width;
+        recvStart[0] = 0;
+        recvStart[1] = n - width;
+    }
+    else {
+        width = oversize;
+        sendStart[0] = oversize + 1 + isDual;
+        sendStart[1] = n - (2*oversize+1+isDual);
+        recvStart[0] = 0;
+        recvStart[1] = n - oversize;
+    }
+}
+
+
+unsigned int AggregatedMPIbuffers::layersSize( Field* field, int iDim, unsigned int width )
+{
+    unsigned int nx = field->dims_[0];
+    unsigned int ny = ( field->dims_.size()>1 ? field->dims_[1] : 1 );
+    return ( iDim==0 ? width*ny : nx*width );
+}
+
+
+void AggregatedMPIbuffers::packLayers( Field* field, int iDim, unsigned int istart, unsigned int width, double* buf )
+{
+    unsigned int nx = field->dims_[0];
+    unsigned int ny = ( field->dims_.size()>1 ? field->dims_[1] : 1 );
+    double* data = field->data();
+
+    if (iDim==0)
+        memcpy( buf, &(data[istart*ny]), width*ny*sizeof(double) );
+    else {
+        for (unsigned int ix=0 ; ix<nx ; ix++)
+            for (unsigned int iy=0 ; iy<width ; iy++)
+                buf[ix*width+iy] = data[ix*ny+istart+iy];
+    }
+}
+
+
+void AggregatedMPIbuffers::unpackLayers( Field* field, int iDim, unsigned int istart, unsigned int width, double* buf, bool sum )
+{
+    unsigned int nx = field->dims_[0];
+    unsigned int ny = ( field->dims_.size()>1 ? field->dims_[1] : 1 );
+    double* data = field->data();
+
+    if (iDim==0) {
+        double* layers = &(data[istart*ny]);
+        if (sum) {
+            for (unsigned int i=0 ; i<width*ny ; i++)
+                layers[i] += buf[i];
+        }
+        else
+            memcpy( layers, buf, width*ny*sizeof(double) );
+    }
+    else {
+        for (unsigned int ix=0 ; ix<nx ; ix++) {
+            if (sum) {
+                for (unsigned int iy=0 ; iy<width ; iy++)
+                    data[ix*ny+istart+iy] += buf[ix*width+iy];
+            }
+            else {
+                for (unsigned int iy=0 ; iy<width ; iy++)
+                    data[ix*ny+istart+iy]  = buf[ix*width+iy];
+            }
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// One message per neighbor process in each direction
+//   - the data sent to the neighbors iNeighbor are received from the neighbors (iNeighbor+1)%2 : the tag is built as
+//     in Patch::initExchange with the direction of the sender, the hindex being replaced by 0 (no message of the
+//     patches is in flight when the messages are aggregated)
+//   - empty messages (no particles) are not sent, both sides know it
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::post( int iDim, int itag, MPI_Datatype type, size_t size, char* sendBuf[2], char* recvBuf[2],
+                                 vector<size_t>* sendOffset[2], vector<size_t>* recvOffset[2] )
+{
+    int typeSize;
+    MPI_Type_size( type, &typeSize );
+
+    // Grow the window of itag if a process of the node sends more than a region
+    //   - the reduction also ensures that the processes have read the data of the previous use of the window
+    if (sharedMemory) {
+        unsigned long need(0), maxNeed(0);
+        for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+            vector<unsigned int>& first = sendFirst_[iDim][iNeighbor];
+            size_t bytes(0);
+            for (unsigned int m=0 ; m<sendRank_[iDim][iNeighbor].size() ; m++) {
+                if ( nodeRank_[ sendRank_[iDim][iNeighbor][m] ] < 0 ) continue;
+                if (sendOffset[iNeighbor])
+                    bytes += (*sendOffset[iNeighbor])[first[m+1]] - (*sendOffset[iNeighbor])[first[m]];
+                else
+                    bytes += (first[m+1]-first[m])*size;
+            }
+            if (bytes>need) need = bytes;
+        }
+        MPI_Allreduce( &need, &maxNeed, 1, MPI_UNSIGNED_LONG, MPI_MAX, nodeComm_ );
+        if ( maxNeed > regionSize_[itag] || window_[itag]==MPI_WIN_NULL )
+            allocateWindow( itag, maxNeed + maxNeed/4 );
+        sharedCopy_[itag][iDim].resize(0);
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+
+        vector<unsigned int>& first = recvFirst_[iDim][iNeighbor];
+        for (unsigned int m=0 ; m<recvRank_[iDim][iNeighbor].size() ; m++) {
+            size_t start = ( recvOffset[iNeighbor] ? (*recvOffset[iNeighbor])[first[m]]   : first[m]*size   );
+            size_t end   = ( recvOffset[iNeighbor] ? (*recvOffset[iNeighbor])[first[m+1]] : first[m+1]*size );
+            rrequest_[itag][iDim][iNeighbor][m] = MPI_REQUEST_NULL;
+            if (end==start) continue;
+            if ( sharedMemory && nodeRank_[ recvRank_[iDim][iNeighbor][m] ] >= 0 ) {
+                SharedCopy copy = { recvBuf[iNeighbor]+start, nodeRank_[ recvRank_[iDim][iNeighbor][m] ], (iNeighbor+1)%2, end-start };
+                sharedCopy_[itag][iDim].push_back( copy );
+                continue;
+            }
+            int tag = buildtag( 0, iDim+2*itag, (iNeighbor+1)%2 );
+            MPI_Irecv( recvBuf[iNeighbor]+start, (end-start)/typeSize, type, recvRank_[iDim][iNeighbor][m], tag, MPI_COMM_WORLD, &(rrequest_[itag][iDim][iNeighbor][m]) );
+        }
+
+    }
+
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+
+        size_t* head = NULL;
+        char* data = NULL;
+        size_t offset = 0;
+        if (sharedMemory) {
+            head = header( segment_[itag][ nodeRank_[worldRank_] ], iDim, iNeighbor );
+            data = region( segment_[itag][ nodeRank_[worldRank_] ], itag, iDim, iNeighbor );
+            head[0] = 0;
+        }
+
+        vector<unsigned int>& first = sendFirst_[iDim][iNeighbor];
+        for (unsigned int m=0 ; m<sendRank_[iDim][iNeighbor].size() ; m++) {
+            size_t start = ( sendOffset[iNeighbor] ? (*sendOffset[iNeighbor])[first[m]]   : first[m]*size   );
+            size_t end   = ( sendOffset[iNeighbor] ? (*sendOffset[iNeighbor])[first[m+1]] : first[m+1]*size );
+            srequest_[itag][iDim][iNeighbor][m] = MPI_REQUEST_NULL;
+            if (end==start) continue;
+            if ( sharedMemory && nodeRank_[ sendRank_[iDim][iNeighbor][m] ] >= 0 ) {
+                memcpy( data+offset, sendBuf[iNeighbor]+start, end-start );
+                size_t* entry = &(head[1+3*head[0]]);
+                entry[0] = sendRank_[iDim][iNeighbor][m];
+                entry[1] = offset;
+                entry[2] = end-start;
+                head[0]++;
+                offset += end-start;
+                continue;
+            }
+            int tag = buildtag( 0, iDim+2*itag, iNeighbor );
+            MPI_Isend( sendBuf[iNeighbor]+start, (end-start)/typeSize, type, sendRank_[iDim][iNeighbor][m], tag, MPI_COMM_WORLD, &(srequest_[itag][iDim][iNeighbor][m]) );
+        }
+
+    }
+
+    // The data written in the segments are visible to the processes of the node
+    if (sharedMemory) {
+        MPI_Win_sync( window_[itag] );
+        MPI_Barrier( nodeComm_ );
+        MPI_Win_sync( window_[itag] );
+    }
+
+} // END post
+
+
+void AggregatedMPIbuffers::wait( int iDim, int itag )
+{
+    for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
+        if (rrequest_[itag][iDim][iNeighbor].size()>0)
+            MPI_Waitall( rrequest_[itag][iDim][iNeighbor].size(), &(rrequest_[itag][iDim][iNeighbor][0]), MPI_STATUSES_IGNORE );
+        if (srequest_[itag][iDim][iNeighbor].size()>0)
+            MPI_Waitall( srequest_[itag][iDim][iNeighbor].size(), &(srequest_[itag][iDim][iNeighbor][0]), MPI_STATUSES_IGNORE );
+    }
+
+    // Copy the messages of the processes of the node from their segment (see post)
+    if (sharedMemory) {
+        vector<SharedCopy>& copies = sharedCopy_[itag][iDim];
+        for (unsigned int icopy=0 ; icopy<copies.size() ; icopy++) {
+            char* segment = segment_[itag][ copies[icopy].source ];
+            size_t* head = header( segment, iDim, copies[icopy].side );
+            for (size_t m=0 ; m<head[0] ; m++) {
+                size_t* entry = &(head[1+3*m]);
+                if ( (int)entry[0] != worldRank_ ) continue;
+                if ( entry[2] != copies[icopy].bytes )
+                    ERROR( "Shared memory message of " << entry[2] << " bytes instead of " << copies[icopy].bytes );
+                memcpy( copies[icopy].dest, region( segment, itag, iDim, copies[icopy].side ) + entry[1], entry[2] );
+            }
+        }
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Shared memory window of itag : collective over the processes of the node
+//   - each segment holds, for each direction and side, a header of 1+3*nodeSize values then a region of regionSize bytes
+// ---------------------------------------------------------------------------------------------------------------------
+void AggregatedMPIbuffers::allocateWindow( int itag, size_t regionSize )
+{
+    if (window_[itag]!=MPI_WIN_NULL) {
+        MPI_Win_unlock_all( window_[itag] );
+        MPI_Win_free( &(window_[itag]) );
+    }
+
+    // Regions aligned on doubles
+    regionSize_[itag] = ( (regionSize+sizeof(double)-1)/sizeof(double) + 1 ) * sizeof(double);
+
+    unsigned int nregions = 2*sendRank_.size();
+    MPI_Aint segmentSize = nregions * ( (1+3*nodeSize_)*sizeof(size_t) + regionSize_[itag] );
+    char* base;
+    MPI_Win_allocate_shared( segmentSize, 1, MPI_INFO_NULL, nodeComm_, &base, &(window_[itag]) );
+    MPI_Win_lock_all( MPI_MODE_NOCHECK, window_[itag] );
+
+    segment_[itag].resize( nodeSize_ );
+    for (int irk=0 ; irk<nodeSize_ ; irk++) {
+        MPI_Aint size;
+        int dispUnit;
+        MPI_Win_shared_query( window_[itag], irk, &size, &dispUnit, &(segment_[itag][irk]) );
+    }
+}
+
+
+size_t* AggregatedMPIbuffers::header( char* segment, int iDim, int iNeighbor )
+{
+    return (size_t*)( segment ) + (2*iDim+iNeighbor) * (1+3*nodeSize_);
+}
+
+
+char* AggregatedMPIbuffers::region( char* segment, int itag, int iDim, int iNeighbor )
+{
+    unsigned int nregions = 2*sendRank_.size();
+    return segment + nregions*(1+3*nodeSize_)*sizeof(size_t) + (2*iDim+iNeighbor)*regionSize_[itag];
+}
@@ -0,0 +1,116 @@
+#ifndef AGGREGATEDMPIBUFFERS_H
+#define AGGREGATEDMPIBUFFERS_H
+
+#include <mpi.h>
+#include <vector>
+#include <array>
+#include <cstddef>
+
+class VectorPatch;
+class Field;
+
+//! Ghost cells and particles exchanged with the neighbor MPI processes, aggregated per process
+//!   - the data sent by all the patches of the process to the patches of a same neighbor process, in a given
+//!     direction, are packed in a single message instead of one message per patch (and per field)
+//!   - the plan (which patches exchange data with which process) only depends on the distribution of the
+//!     patches : it is rebuilt after load balancing or a move of the window (see VectorPatch::update_field_list)
+//!   - with Main.mpi_shared_memory, the messages to the processes of the same node are copied through MPI-3 shared
+//!     memory windows (one per itag) instead of being sent : only a node-local synchronization remains
+//!   - all methods must be called by all the threads of the parallel region (or outside of it), and by all the
+//!     processes in the same order (the shared memory windows are managed collectively by the processes of a node)
+class AggregatedMPIbuffers {
+public:
+    AggregatedMPIbuffers();
+    ~AggregatedMPIbuffers();
+
+    //! Allocate the plan, the buffers and the requests for nDim_field dimensions
+    //! (and the node communicator if sharedMemory)
+    void allocate(int nDim_field);
+    //! Free the shared memory windows (collective over the processes of the node)
+    void release();
+
+    //! Compute the plan from the neighbors of the patches of vecPatches
+    void build( VectorPatch& vecPatches );
+
+    //! Pack the ghost cells of the fields along iDim in the buffers and post the messages
+    //!   - sum : layers summed by SyncVectorPatch::sum, else layers copied by SyncVectorPatch::exchange
+    //!   - itag (0 to 4) must differ between the lists of fields whose communications are in progress at once
+    void initFields    ( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim, int itag, bool sum );
+    //! Wait for the messages posted by initFields and copy (or add) the received layers in the fields
+    void finalizeFields( std::vector<Field*>& fields, VectorPatch& vecPatches, int iDim, int itag, bool sum );
+
+    //! Exchange the numbers of particles of species ispec sent along iDim (set by Patch::initCommParticles)
+    void exchangeParticleCounts( VectorPatch& vecPatches, int ispec, int iDim );
+    //! Exchange the particles of species ispec sent along iDim (copied in partSend by Patch::CommParticles)
+    void exchangeParticles     ( VectorPatch& vecPatches, int ispec, int iDim );
+
+    //! True if the messages are aggregated (Main.aggregate_mpi_messages)
+    bool enabled;
+    //! False if the plan must be rebuilt before the next exchange
+    bool valid;
+    //! True if the messages to the processes of the node go through shared memory (Main.mpi_shared_memory)
+    bool sharedMemory;
+
+private:
+    //! Number of layers of the fields exchanged along iDim, and first layer sent or received on side iNeighbor
+    void fieldLayers( Field* field, VectorPatch& vecPatches, int iDim, bool sum, unsigned int& width,
+                      unsigned int* sendStart, unsigned int* recvStart );
+    //! Number of values in width layers of field along iDim
+    unsigned int layersSize( Field* field, int iDim, unsigned int width );
+    //! Copy the layers [istart, istart+width[ of field along iDim in buf
+    void packLayers  ( Field* field, int iDim, unsigned int istart, unsigned int width, double* buf );
+    //! Copy (or add if sum) buf in the layers [istart, istart+width[ of field along iDim
+    void unpackLayers( Field* field, int iDim, unsigned int istart, unsigned int width, double* buf, bool sum );
+    //! Post the messages of the plan [iDim][*] with itag : the data of the e-th patch of a list start at e*size
+    //! bytes in the buffers, or at the given offsets (bytes, one more than patches)
+    void post( int iDim, int itag, MPI_Datatype type, size_t size, char* sendBuf[2], char* recvBuf[2],
+               std::vector<size_t>* sendOffset[2], std::vector<size_t>* recvOffset[2] );
+    //! Wait for the messages posted in the plan [iDim][*] with itag
+    void wait( int iDim, int itag );
+    //! (Re)allocate the shared memory window of itag, with regions of regionSize bytes for each direction and side
+    void allocateWindow( int itag, size_t regionSize );
+
+    //! Plan, [iDim][iNeighbor] for the data sent to the neighbors iNeighbor (received from the neighbors iNeighbor)
+    //!   - rank of the neighbor process of each message
+    std::vector< std::array< std::vector<int>, 2> > sendRank_, recvRank_;
+    //!   - the patches of message m are sendPatch_[ sendFirst_[m] ] to sendPatch_[ sendFirst_[m+1]-1 ],
+    //!     ordered by hindex of the sending patch on both sides
+    std::vector< std::array< std::vector<unsigned int>, 2> > sendFirst_, recvFirst_;
+    std::vector< std::array< std::vector<unsigned int>, 2> > sendPatch_, recvPatch_;
+
+    //! Fields buffers [itag][iDim][iNeighbor], all the patches of a list of fields send the same number of values
+    std::vector< std::vector< std::array< std::vector<double>, 2> > > sendBuffer_, recvBuffer_;
+    //! Requests [itag][iDim][iNeighbor][message], itag 5 is used by the particles
+    std::vector< std::vector< std::array< std::vector<MPI_Request>, 2> > > srequest_, rrequest_;
+
+    //! Particles [iDim][iNeighbor] : number of particles of each patch, their offset (bytes) in the buffers
+    std::vector< std::array< std::vector<int>, 2> > sendCount_, recvCount_;
+    std::vector< std::array< std::vector<size_t>, 2> > sendOffset_, recvOffset_;
+    std::vector< std::array< std::vector<char>, 2> > sendParticles_, recvParticles_;
+
+    //! Processes of the node : communicator, rank in nodeComm_ of each process of MPI_COMM_WORLD (-1 if on another node)
+    MPI_Comm nodeComm_;
+    int nodeSize_, worldRank_;
+    std::vector<int> nodeRank_;
+    //! Shared memory windows [itag] : the segment of each process starts with a header per direction and side
+    //! (number of messages, then destination rank, offset and size of each message) followed by the data regions
+    std::vector<MPI_Win> window_;
+    //! Size (bytes) of each data region of the windows [itag], the same on all the processes of the node
+    std::vector<size_t> regionSize_;
+    //! Address of the segment of each process of the node [itag][node rank]
+    std::vector< std::vector<char*> > segment_;
+    //! Messages received through shared memory, copied by wait [itag][iDim]
+    struct SharedCopy {
+        char*  dest;
+        int    source;
+        int    side;
+        size_t bytes;
+    };
+    std::vector< std::vector< std::vector<SharedCopy> > > sharedCopy_;
+    //! Header of the region iDim, iNeighbor in a segment
+    size_t* header( char* segment, int iDim, int iNeighbor );
+    //! Data region iDim, iNeighbor in a segment of itag
+    char* region( char* segment, int itag, int iDim, int iNeighbor );
+};
+
+#endif
@@ -15,6 +15,7 @@ void AsyncMPIbuffers::allocate(int ndims)
 {
     srequest.resize(ndims);
     rrequest.resize(ndims);
+    sumBuffer.resize(ndims);
 }
 
 SpeciesMPIbuffers::SpeciesMPIbuffers()
@@ -34,6 +35,8 @@ void SpeciesMPIbuffers::allocate(int ndims)
 
     partRecv.resize(ndims);
     partSend.resize(ndims);
+    packedSend.resize(ndims);
+    packedRecv.resize(ndims);
 
     part_index_send.resize(ndims);
     part_index_send_sz.resize(ndims);
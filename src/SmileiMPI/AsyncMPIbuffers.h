@@ -19,6 +19,9 @@ public:
     std::vector< std::array<MPI_Request, 2> > srequest;
     //! ndim vectors of 2 received requests (1 per direction) 
     std::vector< std::array<MPI_Request, 2> > rrequest;
+    //! ndim vectors of 2 received buffers (1 per direction) used to sum fields
+    //!   - owned by the field so that the sums of several fields can be in progress at once
+    std::vector< std::array< std::vector<double>, 2> > sumBuffer;
 };
 
 class SpeciesMPIbuffers : public AsyncMPIbuffers {
@@ -33,6 +36,12 @@ public:
     //! ndim vectors of 2 received packets of particles (1 per direction) 
     std::vector< std::array<Particles, 2> > partSend;
 
+    //! ndim vectors of 2 buffers of packed particles sent (1 per direction), see Particles::pack
+    //!   - kept from one exchange to the next so that they are only reallocated when they grow
+    std::vector< std::array< std::vector<char>, 2> > packedSend;
+    //! ndim vectors of 2 buffers of packed particles received (1 per direction)
+    std::vector< std::array< std::vector<char>, 2> > packedRecv;
+
     //! ndim vectors of 2 vectors of index particles to send (1 per direction) 
     //!   - not sent
     //    - used to sort Species::indexes_of_particles_to_exchange built in Species::dynamics
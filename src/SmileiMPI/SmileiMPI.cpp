@@ -7,6 +7,7 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <algorithm>
 
 #include "Params.h"
 #include "Tools.h"
@@ -97,6 +98,22 @@ void SmileiMPI::init( Params& params )
     capabilities.resize(smilei_sz, 1);
     Tcapabilities = smilei_sz;
 
+    // Processes sharing the memory of a node, grouped when consecutive (node-aware load balancing)
+    node_first_rank_.resize(0);
+    if (params.node_aware) {
+        MPI_Comm nodeComm;
+        MPI_Comm_split_type( SMILEI_COMM_WORLD, MPI_COMM_TYPE_SHARED, smilei_rk, MPI_INFO_NULL, &nodeComm );
+        int leader( smilei_rk );
+        MPI_Bcast( &leader, 1, MPI_INT, 0, nodeComm );
+        MPI_Comm_free( &nodeComm );
+        std::vector<int> leaders( smilei_sz );
+        MPI_Allgather( &leader, 1, MPI_INT, &leaders[0], 1, MPI_INT, SMILEI_COMM_WORLD );
+        for (int irk=0 ; irk<smilei_sz ; irk++)
+            if ( irk==0 || leaders[irk]!=leaders[irk-1] )
+                node_first_rank_.push_back( irk );
+        node_first_rank_.push_back( smilei_sz );
+    }
+
     // Initialize patch distribution
     init_patch_count(params);
 
@@ -135,6 +152,54 @@ void SmileiMPI::init( Params& params )
 } // END init
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//  Number of particles of a species in a block of cells starting at x_min, used to estimate the load.
+//  The profiles are evaluated on a whole slab of cells (constant i) at once.
+// ---------------------------------------------------------------------------------------------------------------------
+static double particlesInCells( Profile* ppcProfile, Profile* chargeProfile, Profile* densityProfile, const string& densityProfileType,
+                                const vector<double>& x_min, const vector<double>& cell_length, unsigned int n0, unsigned int n1, unsigned int n2 )
+{
+    double load = 0.;
+    vector<vector<double> > x_cells(3, vector<double>(n1*n2));
+    vector<double> nppc, charge, density;
+    vector<unsigned int> cells;
+    for (unsigned int i=0; i<n0; i++) {
+        x_cells[0].resize(n1*n2);
+        x_cells[1].resize(n1*n2);
+        x_cells[2].resize(n1*n2);
+        for (unsigned int j=0; j<n1; j++) {
+            for (unsigned int k=0; k<n2; k++) {
+                x_cells[0][j*n2+k] = x_min[0] + (i+0.5)*cell_length[0];
+                x_cells[1][j*n2+k] = x_min[1] + (j+0.5)*cell_length[1];
+                x_cells[2][j*n2+k] = x_min[2] + (k+0.5)*cell_length[2];
+            }
+        }
+        ppcProfile->valuesAt(x_cells, nppc);
+        
+        // Keep only the cells which contain particles
+        cells.resize(0);
+        for (unsigned int c=0; c<n1*n2; c++) {
+            if( (int)floor(nppc[c]) > 0 ) {
+                for (unsigned int idim=0; idim<3; idim++) x_cells[idim][cells.size()] = x_cells[idim][c];
+                cells.push_back(c);
+            }
+        }
+        for (unsigned int idim=0; idim<3; idim++) x_cells[idim].resize(cells.size());
+        chargeProfile ->valuesAt(x_cells, charge);
+        densityProfile->valuesAt(x_cells, density);
+        
+        for (unsigned int c=0; c<cells.size(); c++) {
+            if(density[c]!=0. && densityProfileType=="charge") {
+                density[c] /= charge[c];
+            }
+            if (abs(density[c])!=0.0)
+                load += (int)floor(nppc[cells[c]]);
+        }
+    }
+    return load;
+}
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 //  Initialize patch distribution
 // ---------------------------------------------------------------------------------------------------------------------
@@ -194,7 +259,7 @@ void SmileiMPI::init_patch_count( Params& params)
         std::string species_type("");
         PyTools::extract("species_type",species_type,"Species",ispecies);
 
-        PyObject *profile1;
+        PyObject *profile1(NULL);
         std::string densityProfileType("");
         bool ok1 = PyTools::extract_pyProfile("nb_density"    , profile1, "Species", ispecies);
         bool ok2 = PyTools::extract_pyProfile("charge_density", profile1, "Species", ispecies);
@@ -207,37 +272,10 @@ void SmileiMPI::init_patch_count( Params& params)
         Profile *chargeProfile = new Profile(profile1, params.nDim_particle, "charge "+species_type);
 
 
-        local_load = 0;
-        // Count global number of particles, 
-        for (unsigned int i=0; i<params.n_space_global[0]; i++) {
-            for (unsigned int j=0; j<params.n_space_global[1]; j++) {
-                for (unsigned int k=0; k<params.n_space_global[2]; k++) {
-                    vector<double> x_cell(3,0);
-                    x_cell[0] = (i+0.5)*params.cell_length[0];
-                    x_cell[1] = (j+0.5)*params.cell_length[1];
-                    x_cell[2] = (k+0.5)*params.cell_length[2];
-
-                    int n_part_in_cell = floor(ppcProfile->valueAt(x_cell));
-                    // If zero or less, zero particles
-                    if( n_part_in_cell<=0. ) {
-                        n_part_in_cell = 0.;
-                        continue;
-                    }
-                    // assign charge its correct value in the cell
-                    double charge = chargeProfile->valueAt(x_cell);
-                    // assign density its correct value in the cell
-                    double density = densityProfile->valueAt(x_cell);
-                    if(density!=0. && densityProfileType=="charge") {
-                        density /= charge;
-                    }
-                    density = abs(density);
-
-                    if (density!=0.0) 
-                        local_load += n_part_in_cell;
-
-                }
-            }
-        }
+        // Count global number of particles
+        local_load = particlesInCells( ppcProfile, chargeProfile, densityProfile, densityProfileType,
+                                       vector<double>(3,0.), params.cell_length,
+                                       params.n_space_global[0], params.n_space_global[1], params.n_space_global[2] );
 
         double time_frozen(0.);
         PyTools::extract("time_frozen",time_frozen ,"Species",ispecies);
@@ -272,7 +310,7 @@ void SmileiMPI::init_patch_count( Params& params)
             std::string species_type("");
             PyTools::extract("species_type",species_type,"Species",ispecies);
 
-            PyObject *profile1;
+            PyObject *profile1(NULL);
             std::string densityProfileType("");
             bool ok1 = PyTools::extract_pyProfile("nb_density"    , profile1, "Species", ispecies);
             bool ok2 = PyTools::extract_pyProfile("charge_density", profile1, "Species", ispecies);
@@ -289,37 +327,10 @@ void SmileiMPI::init_patch_count( Params& params)
                 if (params.cell_length[i]!=0)
                     cell_index[i] = Pcoordinates[i]*params.cell_length[i];
             }
-            local_load_temp = 0; 
-            // Count global number of particles, 
-            for (unsigned int i=0; i<params.n_space[0]; i++) {
-                for (unsigned int j=0; j<params.n_space[1]; j++) {
-                    for (unsigned int k=0; k<params.n_space[2]; k++) {
-                        vector<double> x_cell(3,0);
-                        x_cell[0] = cell_index[0] + (i+0.5)*params.cell_length[0];
-                        x_cell[1] = cell_index[1] + (j+0.5)*params.cell_length[1];
-                        x_cell[2] = cell_index[2] + (k+0.5)*params.cell_length[2];
-
-                        int n_part_in_cell = floor(ppcProfile->valueAt(x_cell));
-                        // If zero or less, zero particles
-                        if( n_part_in_cell<=0. ) {
-                            n_part_in_cell = 0.;
-                            continue;
-                        }
-                        // assign charge its correct value in the cell
-                        double charge = chargeProfile->valueAt(x_cell);
-                        // assign density its correct value in the cell
-                        double density = densityProfile->valueAt(x_cell);
-                        if(density!=0. && densityProfileType=="charge") {
-                            density /= charge;
-                        }
-                        density = abs(density);
-
-                        if (density!=0.0) 
-                            local_load_temp += n_part_in_cell;
-
-                    }
-                }
-            }
+            // Count number of particles in the patch
+            local_load_temp = particlesInCells( ppcProfile, chargeProfile, densityProfile, densityProfileType,
+                                                cell_index, params.cell_length,
+                                                params.n_space[0], params.n_space[1], params.n_space[2] );
             delete chargeProfile;
             delete ppcProfile;
             delete densityProfile;
@@ -364,6 +375,8 @@ void SmileiMPI::init_patch_count( Params& params)
         fout.close();
     }
     
+    update_patch_owners();
+    
 } // END init_patch_count
 
 
@@ -410,6 +423,28 @@ void SmileiMPI::recompute_patch_count( Params& params, VectorPatch& vecpatches,
         }
     }
 
+    //Replace the estimated loads by the measured ones (mean time per timestep since the last load balancing)
+    //  - the estimates of the patches not measured yet (created by the moving window) are scaled to the measures
+    //  - the estimates are kept unchanged as long as nothing has been measured
+    if (params.measured_cost) {
+        double sums[2] = {0., 0.}, global_sums[2];
+        for(unsigned int ipatch=0; ipatch < (unsigned int)patch_count[smilei_rk]; ipatch++){
+            if (vecpatches(ipatch)->load_steps==0) continue;
+            sums[0] += vecpatches(ipatch)->load_time / vecpatches(ipatch)->load_steps;
+            sums[1] += Lp[ipatch];
+        }
+        MPI_Allreduce(sums, global_sums, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        if (global_sums[0] > 0. && global_sums[1] > 0.) {
+            double scale = global_sums[0] / global_sums[1];
+            for(unsigned int ipatch=0; ipatch < (unsigned int)patch_count[smilei_rk]; ipatch++){
+                if (vecpatches(ipatch)->load_steps==0)
+                    Lp[ipatch] *= scale;
+                else
+                    Lp[ipatch] = vecpatches(ipatch)->load_time / vecpatches(ipatch)->load_steps;
+            }
+        }
+    }
+
     //Allgatherv loads of all patches in Lp_global
   
     recv_counts[0] = 0;
@@ -449,6 +484,53 @@ void SmileiMPI::recompute_patch_count( Params& params, VectorPatch& vecpatches,
         }
     }// End loop on patches.
 
+    //Node-aware : replace target_patch_count by a distribution between the nodes, then between the processes of each node
+    if (node_first_rank_.size() > 2) {
+        unsigned int nNodes = node_first_rank_.size()-1;
+        std::vector<double> Lcum(Npatches+1, 0.); //Load of the patches before each hindex
+        for(unsigned int ipatch=0; ipatch < Npatches; ipatch++) Lcum[ipatch+1] = Lcum[ipatch] + Lp_global[ipatch];
+
+        //Boundaries between nodes : only moved if the imbalance is above the tolerance (patches sent over the network)
+        std::vector<int> node_first_patch(nNodes+1, 0);
+        node_first_patch[nNodes] = Npatches;
+        Tcur = 0.;
+        for(unsigned int inode=1; inode < nNodes; inode++){
+            double Tnode = 0.;
+            for(int irk=node_first_rank_[inode-1]; irk < node_first_rank_[inode]; irk++) Tnode += Tload * capabilities[irk];
+            Tcur += Tnode;
+            int h = first_patch_[ node_first_rank_[inode] ];
+            if ( std::abs( Lcum[h] - Tcur ) > params.internode_tolerance * Tnode ) {
+                h = std::lower_bound( Lcum.begin(), Lcum.end()-1, Tcur ) - Lcum.begin();
+                if ( h > 0 && Tcur - Lcum[h-1] < Lcum[h] - Tcur ) h--;
+            }
+            //At least one patch per process
+            h = std::max( h, node_first_patch[inode-1] + node_first_rank_[inode] - node_first_rank_[inode-1] );
+            h = std::min( h, (int)Npatches - (smilei_sz - node_first_rank_[inode]) );
+            node_first_patch[inode] = h;
+        }
+
+        //Inside each node, the load actually given to the node is shared according to the capabilities
+        for(unsigned int inode=0; inode < nNodes; inode++){
+            int rfirst = node_first_rank_[inode], rlast = node_first_rank_[inode+1];
+            int hfirst = node_first_patch[inode], hlast = node_first_patch[inode+1];
+            int capnode = 0;
+            for(int irk=rfirst; irk < rlast; irk++) capnode += capabilities[irk];
+            double Lnode = (Lcum[hlast] - Lcum[hfirst]) / capnode;
+            int h = hfirst;
+            Tcur = Lcum[hfirst];
+            for(int irk=rfirst; irk < rlast-1; irk++){
+                Tcur += Lnode * capabilities[irk];
+                int hnext = std::lower_bound( Lcum.begin()+h, Lcum.begin()+hlast, Tcur ) - Lcum.begin();
+                if ( hnext > h && Tcur - Lcum[hnext-1] < Lcum[hnext] - Tcur ) hnext--;
+                hnext = std::max( hnext, h+1 );
+                hnext = std::min( hnext, hlast - (rlast-1-irk) );
+                target_patch_count[irk] = hnext - h;
+                h = hnext;
+            }
+            target_patch_count[rlast-1] = hlast - h;
+        }
+    }
+
 
     //Make sure the new patch_count is not too different from the previous one.
     // First patch
@@ -495,6 +577,45 @@ void SmileiMPI::recompute_patch_count( Params& params, VectorPatch& vecpatches,
 } // END recompute_patch_count
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Update patch_owner_ after a change of patch_count
+//   - only the patches between the former and the new first patch of each MPI process change owner
+//   - rebuilt entirely the first time (or if the total number of patches changed)
+// ---------------------------------------------------------------------------------------------------------------------
+void SmileiMPI::update_patch_owners()
+{
+    std::vector<int> previous_first_patch( first_patch_ );
+    
+    first_patch_.resize( smilei_sz+1 );
+    first_patch_[0] = 0;
+    for (int irk=0 ; irk<smilei_sz ; irk++)
+        first_patch_[irk+1] = first_patch_[irk] + patch_count[irk];
+    
+    changed_owners_.clear();
+    if ( previous_first_patch.size() != first_patch_.size() || (int)patch_owner_.size() != first_patch_.back() ) {
+        patch_owner_.resize( first_patch_.back() );
+        for (int irk=0 ; irk<smilei_sz ; irk++)
+            for (int h=first_patch_[irk] ; h<first_patch_[irk+1] ; h++)
+                patch_owner_[h] = irk;
+        return;
+    }
+    
+    for (int irk=1 ; irk<smilei_sz ; irk++) {
+        int hmin = std::min( previous_first_patch[irk], first_patch_[irk] );
+        int hmax = std::max( previous_first_patch[irk], first_patch_[irk] );
+        for (int h=hmin ; h<hmax ; h++) {
+            // Last process whose first patch is <= h (empty processes are skipped)
+            int owner = std::upper_bound( first_patch_.begin(), first_patch_.end(), h ) - first_patch_.begin() - 1;
+            if ( owner != patch_owner_[h] ) {
+                patch_owner_[h] = owner;
+                changed_owners_.push_back( h );
+            }
+        }
+    }
+
+} // END update_patch_owners
+
+
 // ----------------------------------------------------------------------
 // Returns the rank of the MPI process currently owning patch h.
 // ----------------------------------------------------------------------
@@ -502,14 +623,7 @@ int SmileiMPI::hrank(int h)
 {
     if (h == MPI_PROC_NULL) return MPI_PROC_NULL;
 
-    int patch_counter,rank;
-    rank=0;
-    patch_counter = patch_count[0];
-    while (h >= patch_counter) {
-        rank++;
-        patch_counter += patch_count[rank];
-    }
-    return rank;
+    return patch_owner_[h];
 } // END hrank
 
 
@@ -518,15 +632,21 @@ int SmileiMPI::hrank(int h)
 // ----------------------------------------------------------------------
 MPI_Datatype SmileiMPI::createMPIparticles( Particles* particles )
 {
-    int nbrOfProp = particles->double_prop.size() + particles->short_prop.size() + particles->uint_prop.size();
+    int nbrOfProp = particles->double_prop.size() + particles->real_prop.size() + particles->short_prop.size() + particles->uint_prop.size();
+    // offsets of the first property of each type in the list
+    int offset_real  = particles->double_prop.size();
+    int offset_short = offset_real  + particles->real_prop.size();
+    int offset_uint  = offset_short + particles->short_prop.size();
 
     MPI_Aint address[nbrOfProp];
     for ( unsigned int iprop=0 ; iprop<particles->double_prop.size() ; iprop++ )
         MPI_Get_address( &( (*(particles->double_prop[iprop]))[0] ), &(address[iprop]) );
+    for ( unsigned int iprop=0 ; iprop<particles->real_prop.size() ; iprop++ )
+        MPI_Get_address( &( (*(particles->real_prop[iprop]))[0] ), &(address[offset_real+iprop]) );
     for ( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->short_prop[iprop]))[0] ), &(address[particles->double_prop.size()+iprop]) );
+        MPI_Get_address( &( (*(particles->short_prop[iprop]))[0] ), &(address[offset_short+iprop]) );
     for ( unsigned int iprop=0 ; iprop<particles->uint_prop.size() ; iprop++ )
-        MPI_Get_address( &( (*(particles->uint_prop[iprop]))[0] ), &(address[particles->double_prop.size()+particles->short_prop.size()+iprop]) );
+        MPI_Get_address( &( (*(particles->uint_prop[iprop]))[0] ), &(address[offset_uint+iprop]) );
 
     int nbr_parts[nbrOfProp];
     // number of elements per property
@@ -543,10 +663,13 @@ MPI_Datatype SmileiMPI::createMPIparticles( Particles* particles )
     // define MPI type of each property, default is DOUBLE
     for ( unsigned int i=0 ; i<particles->double_prop.size() ; i++)
         partDataType[i] = MPI_DOUBLE;
+    // momenta, weight and chi are stored in single precision if compiled with config=float_particles
+    for ( unsigned int iprop=0 ; iprop<particles->real_prop.size() ; iprop++ )
+        partDataType[ offset_real+iprop] = ( sizeof(particle_real)==sizeof(float) ? MPI_FLOAT : MPI_DOUBLE );
     for ( unsigned int iprop=0 ; iprop<particles->short_prop.size() ; iprop++ )
-        partDataType[ particles->double_prop.size()+iprop] = MPI_SHORT;
+        partDataType[ offset_short+iprop] = MPI_SHORT;
     for ( unsigned int iprop=0 ; iprop<particles->uint_prop.size() ; iprop++ )
-        partDataType[ particles->double_prop.size()+particles->short_prop.size()+iprop] = MPI_UNSIGNED;
+        partDataType[ offset_uint+iprop] = MPI_UNSIGNED;
 
     MPI_Datatype typeParticlesMPI;
     MPI_Type_create_struct( nbrOfProp, &(nbr_parts[0]), &(disp[0]), &(partDataType[0]), &typeParticlesMPI);
@@ -629,6 +752,7 @@ void SmileiMPI::isend(Particles* particles, int to, int tag, MPI_Datatype typePa
 {
     MPI_Request request ;
     MPI_Isend( &(particles->position(0,0)), 1, typePartSend, to, tag, MPI_COMM_WORLD, &request );
+    patch_send_requests_.push_back( request );
 
 } // END isend( Particles )
 
@@ -646,6 +770,7 @@ void SmileiMPI::isend(std::vector<int>* vec, int to, int tag)
 {
     MPI_Request request; 
     MPI_Isend( &((*vec)[0]), (*vec).size(), MPI_INT, to, tag, MPI_COMM_WORLD, &request );
+    patch_send_requests_.push_back( request );
 
 } // End isend ( bmax )
 
@@ -741,6 +866,7 @@ void SmileiMPI::isend(Field* field, int to, int hindex)
 {
     MPI_Request request;
     MPI_Isend( &((*field)(0)),field->globalDims_, MPI_DOUBLE, to, hindex, MPI_COMM_WORLD, &request );
+    patch_send_requests_.push_back( request );
 
 } // End isend ( Field )
 
@@ -758,13 +884,17 @@ void SmileiMPI::isend( ProbeParticles* probe, int to, int tag, unsigned int nDim
     MPI_Request request; 
     // send offset
     MPI_Isend( &(probe->offset_in_file), 1, MPI_INT, to, tag, MPI_COMM_WORLD, &request );
+    patch_send_requests_.push_back( request );
     // send number of particles
     int nPart = probe->particles.size();
     MPI_Isend( &nPart, 1, MPI_INT, to, tag+1, MPI_COMM_WORLD, &request );
+    patch_send_requests_.push_back( request );
     // send particles
     if( nPart>0 )
-        for( unsigned int i=0; i<nDim_particles; i++)
+        for( unsigned int i=0; i<nDim_particles; i++) {
             MPI_Isend( &(probe->particles.Position[i][0]), nPart, MPI_DOUBLE, to, tag+1+i, MPI_COMM_WORLD, &request );
+            patch_send_requests_.push_back( request );
+        }
 
 } // End isend ( probes )
 
@@ -787,6 +917,16 @@ void SmileiMPI::recv( ProbeParticles* probe, int from, int tag, unsigned int nDi
 } // End recv ( probes )
 
 
+// Wait for the messages posted by the isend methods above : the sent patches can then be deleted
+void SmileiMPI::waitPatchSends()
+{
+    if ( patch_send_requests_.empty() ) return;
+    MPI_Waitall( patch_send_requests_.size(), &patch_send_requests_[0], MPI_STATUSES_IGNORE );
+    patch_send_requests_.clear();
+
+} // End waitPatchSends
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------      DIAGS MPI SYNC     --------------------------------------------------
@@ -56,6 +56,13 @@ public:
     void recompute_patch_count( Params& params, VectorPatch& vecpatches, double time_dual );
      // Returns the rank of the MPI process currently owning patch h.
     int hrank(int h);
+    //! Update the table of the owners of the patches (hrank) after a change of patch_count
+    //! (not done by recompute_patch_count : the patches only move in VectorPatch::migratePatches)
+    void update_patch_owners();
+    //! Patches whose owner changed at the last update_patch_owners (empty after a complete rebuild of the table)
+    inline const std::vector<int>& changed_owners() const {
+        return changed_owners_;
+    }
     
     // Create MPI type to exchange all particles properties of particles
     MPI_Datatype createMPIparticles( Particles* particles );
@@ -79,6 +86,9 @@ public:
     void recv (Field* field, int from, int hindex);
     void isend( ProbeParticles* probe, int to  , int hindex, unsigned int );
     void recv ( ProbeParticles* probe, int from, int hindex, unsigned int );
+    //! Wait for the completion of all the messages posted by the isend methods
+    //! (only the processes exchanging patches wait for each other)
+    void waitPatchSends();
     
     
     // DIAGS MPI SYNC 
@@ -116,10 +126,10 @@ public:
     // Global buffers for vectorization of Species::dynamics
     // -----------------------------------------------------
     
-    //! value of the Efield 
-    std::vector<std::vector<LocalFields>> dynamics_Epart;
-    //! value of the Bfield
-    std::vector<std::vector<LocalFields>> dynamics_Bpart;
+    //! value of the Efield, one aligned array per component : dynamics_Epart[ithread][icomp][ipart]
+    std::vector<std::vector<AlignedVector<double>>> dynamics_Epart;
+    //! value of the Bfield, one aligned array per component : dynamics_Bpart[ithread][icomp][ipart]
+    std::vector<std::vector<AlignedVector<double>>> dynamics_Bpart;
     //! gamma factor
     std::vector<std::vector<double>> dynamics_gf;
     //! iold_pos
@@ -129,8 +139,12 @@ public:
     
     // Resize buffers for a given number of particles
     inline void dynamics_resize(int ithread, int ndim_part, int npart ){
-        dynamics_Epart[ithread].resize(npart);
-        dynamics_Bpart[ithread].resize(npart);
+        dynamics_Epart[ithread].resize(3);
+        dynamics_Bpart[ithread].resize(3);
+        for (unsigned int icomp=0 ; icomp<3 ; icomp++) {
+            dynamics_Epart[ithread][icomp].resize(npart);
+            dynamics_Bpart[ithread][icomp].resize(npart);
+        }
         dynamics_gf[ithread].resize(npart);
         dynamics_iold[ithread].resize(ndim_part*npart);
         dynamics_deltaold[ithread].resize(ndim_part*npart);
@@ -164,6 +178,17 @@ protected:
     //Number of patches owned by each mpi process.
     std::vector<int>  patch_count, target_patch_count, capabilities;
     int Tcapabilities; //Default = smilei_sz (1 per MPI rank)
+    //! Hindex of the first patch of each MPI process (smilei_sz+1 values, the last one is the number of patches)
+    std::vector<int> first_patch_;
+    //! MPI process owning each patch : Patch::updateMPIenv looks up the ranks of the neighbors in this table
+    std::vector<int> patch_owner_;
+    //! Patches whose owner changed at the last update of patch_owner_
+    std::vector<int> changed_owners_;
+    //! With LoadBalancing.node_aware, first rank of each node (the last value is the number of processes)
+    std::vector<int> node_first_rank_;
+    
+    //! Requests of the patch messages posted by the isend methods, completed by waitPatchSends
+    std::vector<MPI_Request> patch_send_requests_;
 
 
 };
@@ -30,9 +30,9 @@ PartWall::PartWall(double pos, unsigned short dir, string kind) :
     }
 }
 
-int PartWall::apply( Particles &particles, int ipart, Species * species, double &nrj_iPart) {
-    if( (position-particles.position_old(direction, ipart))
-       *(position-particles.position    (direction, ipart))<0.) {
+int PartWall::apply( Particles &particles, int ipart, double* position_old, Species * species, double &nrj_iPart) {
+    if( (position-position_old[direction])*(position-particles.position(direction, ipart))<0.) {
+        position_old[direction] = position;
         return (*wall)( particles, ipart, direction, 2.*position, species, nrj_iPart );
     } else {
         return 1;
@@ -28,7 +28,10 @@ public:
     int (*wall) ( Particles &particles, int ipart, int direction, double limit_pos, Species *species, double &nrj_iPart);
     
     //! Method which applies particles wall
-    int apply (Particles &particles, int ipart, Species *species, double &nrj_iPart);
+    //! position_old = position of the particle before the push (no former position is stored in Particles).
+    //! When the particle is reflected, position_old is moved to the wall, where the rest of its displacement starts,
+    //! so that the following walls test the reflected path
+    int apply (Particles &particles, int ipart, double* position_old, Species *species, double &nrj_iPart);
     
 private:
     //! position of a wall in its direction
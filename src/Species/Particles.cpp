@@ -20,12 +20,12 @@ Particles::Particles():
 tracked(false)
 {
     Position.resize(0);
-    Position_old.resize(0);
     Momentum.resize(0);
     isTest = false;
     isRadReaction = false;
 
     double_prop.resize(0);
+    real_prop.resize(0);
     short_prop.resize(0);
     uint_prop.resize(0);
 }
@@ -47,10 +47,8 @@ void Particles::initialize(unsigned int nParticles, unsigned int nDim)
     
     Position.resize(nDim);
     
-    Position_old.resize(Position.size());
     for (unsigned int i=0 ; i< Position.size() ; i++) {
         Position[i].resize(nParticles, 0.);
-        Position_old[i].resize(nParticles, 0.);
     }
     Momentum.resize(3);
     for (unsigned int i=0 ; i< 3 ; i++) {
@@ -71,15 +69,15 @@ void Particles::initialize(unsigned int nParticles, unsigned int nDim)
         for (unsigned int i=0 ; i< Position.size() ; i++)
             double_prop.push_back( &(Position[i]) );
         for (unsigned int i=0 ; i< 3 ; i++)
-            double_prop.push_back( &(Momentum[i]) );
-        double_prop.push_back( &Weight );
+            real_prop.push_back( &(Momentum[i]) );
+        real_prop.push_back( &Weight );
         short_prop.push_back( &Charge );
         if (tracked) {
             uint_prop.push_back( &Id );
         }
         
         if (isRadReaction) {
-            double_prop.push_back( &Chi );
+            real_prop.push_back( &Chi );
         }
         
     }
@@ -105,11 +103,12 @@ void Particles::initialize(unsigned int nParticles, Particles &part)
 // ---------------------------------------------------------------------------------------------------------------------
 void Particles::reserve( unsigned int n_part_max, unsigned int nDim )
 {
+    // Round the capacity to whole cache lines so that every lane can be processed by full vectors
+    n_part_max = AlignedAllocator<double>::padded_size( n_part_max );
+    
     Position.resize(nDim);
-    Position_old.resize(nDim);
     for (unsigned int i=0 ; i< nDim ; i++) {
         Position[i].reserve(n_part_max);
-        Position_old[i].reserve(n_part_max);
     }
     Momentum.resize(3);
     for (unsigned int i=0 ; i< 3 ; i++) {
@@ -133,7 +132,6 @@ void Particles::clear()
 {
     for (unsigned int i=0 ; i< Position.size() ; i++) {
         Position[i].clear();
-        Position_old[i].clear();
     }
     for (unsigned int i=0 ; i< 3 ; i++) {
         Momentum[i].clear();
@@ -155,7 +153,6 @@ void Particles::cp_particle(unsigned int ipart, Particles &dest_parts )
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         dest_parts.Position[i].push_back(Position[i][ipart]);
-        dest_parts.Position_old[i].push_back(Position_old[i][ipart]);
     }
     
     for (unsigned int i=0; i<3; i++) {
@@ -178,7 +175,6 @@ void Particles::cp_particle(unsigned int ipart, Particles &dest_parts, int dest_
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         dest_parts.Position[i].insert( dest_parts.Position[i].begin() + dest_id, Position[i][ipart] );
-        dest_parts.Position_old[i].insert( dest_parts.Position_old[i].begin() + dest_id, Position_old[i][ipart] );
     }
     
     for (unsigned int i=0; i<3; i++) {
@@ -202,7 +198,6 @@ void Particles::cp_particles(unsigned int iPart, unsigned int nPart, Particles &
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         dest_parts.Position[i].insert( dest_parts.Position[i].begin() + dest_id, Position[i].begin()+iPart, Position[i].begin()+iPart+nPart );
-        dest_parts.Position_old[i].insert( dest_parts.Position_old[i].begin() + dest_id, Position_old[i].begin()+iPart, Position_old[i].begin()+iPart+nPart );
     }
     
     for (unsigned int i=0; i<3; i++) {
@@ -226,7 +221,6 @@ void Particles::erase_particle(unsigned int ipart )
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         Position[i].erase(Position[i].begin()+ipart);
-        Position_old[i].erase(Position_old[i].begin()+ipart);
     }
     
     for (unsigned int i=0; i<3; i++) {
@@ -250,7 +244,6 @@ void Particles::erase_particle_trail(unsigned int ipart)
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         Position[i].erase(Position[i].begin()+ipart,Position[i].end() );
-        Position_old[i].erase(Position_old[i].begin()+ipart,Position_old[i].end() );
     }
     
     for (unsigned int i=0; i<3; i++) {
@@ -273,7 +266,6 @@ void Particles::erase_particle(unsigned int ipart, unsigned int npart)
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         Position[i].erase(Position[i].begin()+ipart,Position[i].begin()+ipart+npart );
-        Position_old[i].erase(Position_old[i].begin()+ipart,Position_old[i].begin()+ipart+npart );
     }
 
     for (unsigned int i=0; i<3; i++) {
@@ -292,7 +284,6 @@ void Particles::erase_particle(unsigned int ipart, unsigned int npart)
 void Particles::print(unsigned int iPart) {
     for (unsigned int i=0; i<Position.size(); i++) {
         cout << Position[i][iPart] << " ";
-        cout << Position_old[i][iPart] << " ";
     }
     for (unsigned int i=0; i<3; i++)
         cout << Momentum[i][iPart] << " ";
@@ -315,7 +306,6 @@ ostream& operator << (ostream& out, const Particles& particles) {
         
         for (unsigned int i=0; i<particles.Position.size(); i++) {
             out << particles.Position[i][iPart] << " ";
-            out << particles.Position_old[i][iPart] << " ";
         }
         for (unsigned int i=0; i<3; i++)
             out << particles.Momentum[i][iPart] << " ";
@@ -340,7 +330,6 @@ void Particles::swap_part(unsigned int part1, unsigned int part2)
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         std::swap( Position[i][part1], Position[i][part2] );
-        std::swap( Position_old[i][part1], Position_old[i][part2] );
     }
     for (unsigned int i=0; i<3; i++)
         std::swap( Momentum[i][part1], Momentum[i][part2] );
@@ -361,7 +350,6 @@ void Particles::overwrite_part(unsigned int part1, unsigned int part2)
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         Position[i][part2]     = Position[i][part1];
-        Position_old[i][part2] = Position_old[i][part1];
     }
     Momentum[0][part2] = Momentum[0][part1];
     Momentum[1][part2] = Momentum[1][part1];
@@ -383,17 +371,17 @@ void Particles::overwrite_part(unsigned int part1, unsigned int part2)
 void Particles::overwrite_part(unsigned int part1, unsigned int part2, unsigned int N)
 {
     unsigned int sizepart = N*sizeof(Position[0][0]);
+    unsigned int sizereal = N*sizeof(Weight[0]);
     unsigned int sizecharge = N*sizeof(Charge[0]);
 
     for (unsigned int i=0; i<Position.size(); i++) {
         memcpy(&Position[i][part2]     ,  &Position[i][part1]     , sizepart)    ;
-        memcpy(&Position_old[i][part2] ,  &Position_old[i][part1] , sizepart)    ;
     }
-    memcpy(&Momentum[0][part2]     ,  &Momentum[0][part1]     , sizepart)    ;
-    memcpy(&Momentum[1][part2]     ,  &Momentum[1][part1]     , sizepart)    ;
-    memcpy(&Momentum[2][part2]     ,  &Momentum[2][part1]     , sizepart)    ;
+    memcpy(&Momentum[0][part2]     ,  &Momentum[0][part1]     , sizereal)    ;
+    memcpy(&Momentum[1][part2]     ,  &Momentum[1][part1]     , sizereal)    ;
+    memcpy(&Momentum[2][part2]     ,  &Momentum[2][part1]     , sizereal)    ;
     memcpy(&Charge[part2]          ,  &Charge[part1]          , sizecharge)    ;
-    memcpy(&Weight[part2]          ,  &Weight[part1]          , sizepart)    ;      
+    memcpy(&Weight[part2]          ,  &Weight[part1]          , sizereal)    ;      
 
     if (tracked) {
         unsigned int sizeid = N*sizeof(Id[0]);
@@ -401,7 +389,7 @@ void Particles::overwrite_part(unsigned int part1, unsigned int part2, unsigned
     }
     
     if (isRadReaction)
-        memcpy(&Chi[part2]          ,  &Chi[part1]              , sizepart);
+        memcpy(&Chi[part2]          ,  &Chi[part1]              , sizereal);
 }
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -411,7 +399,6 @@ void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsign
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         dest_parts.Position[i][part2]     = Position[i][part1];
-        dest_parts.Position_old[i][part2] = Position_old[i][part1];
     }
     dest_parts.Momentum[0][part2] = Momentum[0][part1];
     dest_parts.Momentum[1][part2] = Momentum[1][part1];
@@ -432,18 +419,18 @@ void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsign
 void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsigned int part2, unsigned int N)
 {
     unsigned int sizepart = N*sizeof(Position[0][0]);
+    unsigned int sizereal = N*sizeof(Weight[0]);
     unsigned int sizecharge = N*sizeof(Charge[0]);
     
     for (unsigned int i=0; i<Position.size(); i++) {
         memcpy(&dest_parts.Position[i][part2]     ,  &Position[i][part1]     , sizepart)    ;
-        memcpy(&dest_parts.Position_old[i][part2] ,  &Position_old[i][part1] , sizepart)    ;
     }
 
-    memcpy(&dest_parts.Momentum[0][part2]     ,  &Momentum[0][part1]     , sizepart)    ;
-    memcpy(&dest_parts.Momentum[1][part2]     ,  &Momentum[1][part1]     , sizepart)    ;
-    memcpy(&dest_parts.Momentum[2][part2]     ,  &Momentum[2][part1]     , sizepart)    ;
+    memcpy(&dest_parts.Momentum[0][part2]     ,  &Momentum[0][part1]     , sizereal)    ;
+    memcpy(&dest_parts.Momentum[1][part2]     ,  &Momentum[1][part1]     , sizereal)    ;
+    memcpy(&dest_parts.Momentum[2][part2]     ,  &Momentum[2][part1]     , sizereal)    ;
     memcpy(&dest_parts.Charge[part2]          ,  &Charge[part1]         , sizecharge)    ;
-    memcpy(&dest_parts.Weight[part2]          ,  &Weight[part1]         , sizepart)    ;      
+    memcpy(&dest_parts.Weight[part2]          ,  &Weight[part1]         , sizereal)    ;      
 
    if (tracked) {
         unsigned int sizeid = N*sizeof(Id[0]);
@@ -451,7 +438,7 @@ void Particles::overwrite_part(unsigned int part1, Particles &dest_parts, unsign
     }
     
     if (isRadReaction)
-        memcpy(&dest_parts.Chi[part2],  &Chi[part1], sizepart);
+        memcpy(&dest_parts.Chi[part2],  &Chi[part1], sizereal);
 
 }
 
@@ -464,29 +451,26 @@ void Particles::swap_part(unsigned int part1, unsigned int part2, unsigned int N
     double* buffer[N];
     
     unsigned int sizepart = N*sizeof(Position[0][0]);
+    unsigned int sizereal = N*sizeof(Weight[0]);
     unsigned int sizecharge = N*sizeof(Charge[0]);
     
     for (unsigned int i=0; i<Position.size(); i++) {
         memcpy(buffer,&Position[i][part1], sizepart);
         memcpy(&Position[i][part1],&Position[i][part2], sizepart);
         memcpy(&Position[i][part2],buffer, sizepart);
-        
-        memcpy(buffer,&Position_old[i][part1], sizepart);
-        memcpy(&Position_old[i][part1],&Position_old[i][part2], sizepart);
-        memcpy(&Position_old[i][part2],buffer, sizepart);
     }
     for (unsigned int i=0; i<3; i++){
-        memcpy(buffer,&Momentum[i][part1], sizepart);
-        memcpy(&Momentum[i][part1],&Momentum[i][part2], sizepart);
-        memcpy(&Momentum[i][part2],buffer, sizepart);
+        memcpy(buffer,&Momentum[i][part1], sizereal);
+        memcpy(&Momentum[i][part1],&Momentum[i][part2], sizereal);
+        memcpy(&Momentum[i][part2],buffer, sizereal);
     }
     memcpy(buffer,&Charge[part1], sizecharge);
     memcpy(&Charge[part1],&Charge[part2], sizecharge);
     memcpy(&Charge[part2],buffer, sizecharge);
     
-    memcpy(buffer,&Weight[part1], sizepart);
-    memcpy(&Weight[part1],&Weight[part2], sizepart);
-    memcpy(&Weight[part2],buffer, sizepart);
+    memcpy(buffer,&Weight[part1], sizereal);
+    memcpy(&Weight[part1],&Weight[part2], sizereal);
+    memcpy(&Weight[part2],buffer, sizereal);
     
     if (tracked) {
         unsigned int sizeid = N*sizeof(Id[0]);
@@ -496,9 +480,9 @@ void Particles::swap_part(unsigned int part1, unsigned int part2, unsigned int N
     }
     
     if (isRadReaction) {
-        memcpy(buffer,&Chi[part1], sizepart);
-        memcpy(&Chi[part1],&Chi[part2], sizepart);
-        memcpy(&Chi[part2],buffer, sizepart);
+        memcpy(buffer,&Chi[part1], sizereal);
+        memcpy(&Chi[part1],&Chi[part2], sizereal);
+        memcpy(&Chi[part2],buffer, sizereal);
     }
 }
 
@@ -517,7 +501,6 @@ void Particles::create_particle()
 {
     for (unsigned int i=0; i<Position.size(); i++) {
         Position[i].push_back(0.);
-        Position_old[i].push_back(0.);
     }
     
     for (unsigned int i=0; i<3; i++) {
@@ -537,27 +520,26 @@ void Particles::create_particle()
 // ---------------------------------------------------------------------------------------------------------------------
 // Create nParticles new particles at the end of vectors
 // ---------------------------------------------------------------------------------------------------------------------
-//void Particles::create_particles(int nAdditionalParticles )
-//{
-//    int nParticles = size();
-//    for (unsigned int i=0; i<Position.size(); i++) {
-//        Position[i].resize(nParticles+nAdditionalParticles,0.);
-//        Position_old[i].resize(nParticles+nAdditionalParticles,0.);
-//    }
-//    
-//    for (unsigned int i=0; i<3; i++) {
-//        Momentum[i].resize(nParticles+nAdditionalParticles,0.);
-//    }
-//    Weight.resize(nParticles+nAdditionalParticles,0.);
-//    Charge.resize(nParticles+nAdditionalParticles,0);
-//    
-//    if (tracked)
-//        Id.resize(nParticles+nAdditionalParticles,0);
-//    
-//    if (isRadReaction)
-//        Chi.resize(nParticles+nAdditionalParticles,0.);
-//
-//}
+void Particles::create_particles(unsigned int nAdditionalParticles )
+{
+    unsigned int nParticles = size();
+    for (unsigned int i=0; i<Position.size(); i++) {
+        Position[i].resize(nParticles+nAdditionalParticles,0.);
+    }
+    
+    for (unsigned int i=0; i<3; i++) {
+        Momentum[i].resize(nParticles+nAdditionalParticles,0.);
+    }
+    Weight.resize(nParticles+nAdditionalParticles,0.);
+    Charge.resize(nParticles+nAdditionalParticles,0);
+    
+    if (tracked)
+        Id.resize(nParticles+nAdditionalParticles,0);
+    
+    if (isRadReaction)
+        Chi.resize(nParticles+nAdditionalParticles,0.);
+
+}
 
 // ---------------------------------------------------------------------------------------------------------------------
 // Test if ipart is in the local patch
@@ -572,6 +554,70 @@ bool Particles::is_part_in_domain(unsigned int ipart, Patch* patch)
 }
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Number of bytes per particle in the buffers of the MPI exchanges
+// ---------------------------------------------------------------------------------------------------------------------
+unsigned int Particles::packedSize()
+{
+    return double_prop.size()*sizeof(double) + real_prop.size()*sizeof(particle_real)
+         + short_prop.size()*sizeof(short)   + uint_prop.size()*sizeof(unsigned int);
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy the particles in a contiguous buffer of bytes, one property after the other
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::pack( char* buf )
+{
+    unsigned int n = size();
+    if (n==0) return;
+    
+    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+        memcpy( buf, &((*double_prop[iprop])[0]), n*sizeof(double) );
+        buf += n*sizeof(double);
+    }
+    for ( unsigned int iprop=0 ; iprop<real_prop.size() ; iprop++ ) {
+        memcpy( buf, &((*real_prop[iprop])[0]), n*sizeof(particle_real) );
+        buf += n*sizeof(particle_real);
+    }
+    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+        memcpy( buf, &((*short_prop[iprop])[0]), n*sizeof(short) );
+        buf += n*sizeof(short);
+    }
+    for ( unsigned int iprop=0 ; iprop<uint_prop.size() ; iprop++ ) {
+        memcpy( buf, &((*uint_prop[iprop])[0]), n*sizeof(unsigned int) );
+        buf += n*sizeof(unsigned int);
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Copy the properties packed by Particles::pack in the particles, which must have been created beforehand
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::unpack( const char* buf )
+{
+    unsigned int n = size();
+    if (n==0) return;
+    
+    for ( unsigned int iprop=0 ; iprop<double_prop.size() ; iprop++ ) {
+        memcpy( &((*double_prop[iprop])[0]), buf, n*sizeof(double) );
+        buf += n*sizeof(double);
+    }
+    for ( unsigned int iprop=0 ; iprop<real_prop.size() ; iprop++ ) {
+        memcpy( &((*real_prop[iprop])[0]), buf, n*sizeof(particle_real) );
+        buf += n*sizeof(particle_real);
+    }
+    for ( unsigned int iprop=0 ; iprop<short_prop.size() ; iprop++ ) {
+        memcpy( &((*short_prop[iprop])[0]), buf, n*sizeof(short) );
+        buf += n*sizeof(short);
+    }
+    for ( unsigned int iprop=0 ; iprop<uint_prop.size() ; iprop++ ) {
+        memcpy( &((*uint_prop[iprop])[0]), buf, n*sizeof(unsigned int) );
+        buf += n*sizeof(unsigned int);
+    }
+}
+
+
 void Particles::sortById() {
     if (!tracked) {
         ERROR("Impossible");
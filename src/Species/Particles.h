@@ -8,10 +8,20 @@
 #include <vector>
 
 #include "Tools.h"
+#include "AlignedVector.h"
 #include "TimeSelection.h"
 
 class Particle;
 
+//! Floating point type used to store the particle momenta, weights and quantum parameters.
+//!   Compiling with config=float_particles stores them in single precision (positions stay in double precision),
+//!   all computations are still done in double precision.
+#ifdef __FLOAT_PARTICLES
+typedef float  particle_real;
+#else
+typedef double particle_real;
+#endif
+
 class Params;
 class Patch;
 
@@ -108,6 +118,15 @@ public:
     //! Test if ipart is in the local patch
     bool is_part_in_domain(unsigned int ipart, Patch* patch);
     
+    //! Number of bytes per particle in the buffers of the MPI exchanges (see pack)
+    unsigned int packedSize();
+    
+    //! Copy all the particles in buf, property after property (packedSize()*size() bytes)
+    void pack( char* buf );
+    
+    //! Copy in all the particles (already created) the properties packed in buf
+    void unpack( const char* buf );
+    
     //! Method used to get the Particle position
     inline double  position( unsigned int idim, unsigned int ipart ) const {
         return Position[idim][ipart];
@@ -117,18 +136,13 @@ public:
         return Position[idim][ipart];
     }
     
-    //! Method used to get the Particle position
-    inline double  position_old( unsigned int idim, unsigned int ipart ) const {
-        return Position_old[idim][ipart];
+    //! Method used to get a read-only view on the list of Particle position
+    inline ArrayView<const double> position(unsigned int idim) const {
+        return ArrayView<const double>( Position[idim] );
     }
-    //! Method used to set a new value to the Particle former position
-    inline double& position_old( unsigned int idim, unsigned int ipart )       {
-        return Position_old[idim][ipart];
-    }
-    
-    //! Method used to get the list of Particle position
-    inline std::vector<double>  position(unsigned int idim) const {
-        return Position[idim];
+    //! Method used to get a view on the list of Particle position
+    inline ArrayView<double> position(unsigned int idim) {
+        return ArrayView<double>( Position[idim] );
     }
     
     //! Method used to get the Particle momentum
@@ -136,12 +150,16 @@ public:
         return Momentum[idim][ipart];
     }
     //! Method used to set a new value to the Particle momentum
-    inline double& momentum( unsigned int idim, unsigned int ipart )       {
+    inline particle_real& momentum( unsigned int idim, unsigned int ipart )       {
         return Momentum[idim][ipart];
     }
-      //! Method used to get the Particle momentum
-    inline std::vector<double>  momentum( unsigned int idim ) const {
-        return Momentum[idim];
+    //! Method used to get a read-only view on the list of Particle momentum
+    inline ArrayView<const particle_real> momentum( unsigned int idim ) const {
+        return ArrayView<const particle_real>( Momentum[idim] );
+    }
+    //! Method used to get a view on the list of Particle momentum
+    inline ArrayView<particle_real> momentum( unsigned int idim ) {
+        return ArrayView<particle_real>( Momentum[idim] );
     }
     
     //! Method used to get the Particle weight
@@ -149,12 +167,16 @@ public:
         return Weight[ipart];
     }
     //! Method used to set a new value to the Particle weight
-    inline double& weight(unsigned int ipart)       {
+    inline particle_real& weight(unsigned int ipart)       {
         return Weight[ipart];
     }
-    //! Method used to get the Particle weight
-    inline std::vector<double>  weight() const {
-        return Weight;
+    //! Method used to get a read-only view on the list of Particle weight
+    inline ArrayView<const particle_real> weight() const {
+        return ArrayView<const particle_real>( Weight );
+    }
+    //! Method used to get a view on the list of Particle weight
+    inline ArrayView<particle_real> weight() {
+        return ArrayView<particle_real>( Weight );
     }
     
     //! Method used to get the Particle charge
@@ -165,9 +187,13 @@ public:
     inline short& charge(unsigned int ipart)       {
         return Charge[ipart];
     }
-    //! Method used to get the list of Particle charges
-    inline std::vector<short>  charge() const {
-        return Charge;
+    //! Method used to get a read-only view on the list of Particle charges
+    inline ArrayView<const short> charge() const {
+        return ArrayView<const short>( Charge );
+    }
+    //! Method used to get a view on the list of Particle charges
+    inline ArrayView<short> charge() {
+        return ArrayView<short>( Charge );
     }
     
     
@@ -176,29 +202,30 @@ public:
         return sqrt(1.+pow(momentum(0,ipart),2)+pow(momentum(1,ipart),2)+pow(momentum(2,ipart),2));
     }
     
-    //! Partiles properties, respect type order : all double, all short, all unsigned int
+    //! Partiles properties, respect type order : all double, all particle_real, all short, all unsigned int
+    //! Each property is a separate lane aligned on SMILEI_ALIGNMENT bytes (see AlignedVector.h)
     
     //! array containing the particle position
-    std::vector< std::vector<double> > Position;
+    std::vector< AlignedVector<double> > Position;
     
-    //! array containing the particle former (old) positions
-    std::vector< std::vector<double> >Position_old;
+    //! Former positions are not stored : the projectors and the particle walls get them from the thread buffers of
+    //! the dynamics (dynamics_iold, dynamics_deltaold, dynamics_gf in SmileiMPI) while the block is processed
     
     //! array containing the particle moments
-    std::vector< std::vector<double> >  Momentum;
+    std::vector< AlignedVector<particle_real> > Momentum;
     
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Weight;
+    AlignedVector<particle_real> Weight;
     
     //! containing the particle weight: equivalent to a charge density
-    std::vector<double> Chi;
+    AlignedVector<particle_real> Chi;
     
     
     //! charge state of the particle (multiples of e>0)
-    std::vector<short> Charge;
+    AlignedVector<short> Charge;
     
     //! Id of the particle
-    std::vector<unsigned int> Id;
+    AlignedVector<unsigned int> Id;
     
     // TEST PARTICLE PARAMETERS
     bool isTest;
@@ -225,9 +252,13 @@ public:
     inline unsigned int& id(unsigned int ipart) {
         return Id[ipart];
     }
-    //! Method used to get the Particle Ids
-    inline std::vector<unsigned int> id() const {
-        return Id;
+    //! Method used to get a read-only view on the Particle Ids
+    inline ArrayView<const unsigned int> id() const {
+        return ArrayView<const unsigned int>( Id );
+    }
+    //! Method used to get a view on the Particle Ids
+    inline ArrayView<unsigned int> id() {
+        return ArrayView<unsigned int>( Id );
     }
     void sortById();
     
@@ -242,34 +273,26 @@ public:
         return Chi[ipart];
     }
     //! Method used to set a new value to the Particle chi factor
-    inline double& chi(unsigned int ipart)       {
+    inline particle_real& chi(unsigned int ipart)       {
         return Chi[ipart];
     }
-    //! Method used to get the Particle chi factor
-    inline std::vector<double>  chi() const {
-        return Chi;
+    //! Method used to get a read-only view on the Particle chi factor
+    inline ArrayView<const particle_real> chi() const {
+        return ArrayView<const particle_real>( Chi );
+    }
+    //! Method used to get a view on the Particle chi factor
+    inline ArrayView<particle_real> chi() {
+        return ArrayView<particle_real>( Chi );
     }
     
-    std::vector< std::vector<double>* >       double_prop;
-    std::vector< std::vector<short>* >        short_prop;
-    std::vector< std::vector<unsigned int>* > uint_prop;
+    std::vector< AlignedVector<double>* >       double_prop;
+    std::vector< AlignedVector<particle_real>* > real_prop;
+    std::vector< AlignedVector<short>* >        short_prop;
+    std::vector< AlignedVector<unsigned int>* > uint_prop;
     
     
     //bool test_move( int iPartStart, int iPartEnd, Params& params );
     
-    inline double dist2( unsigned int iPart ) {
-        double dist(0.);
-        for ( unsigned int iDim = 0 ; iDim < Position.size() ; iDim++ ) {
-            double delta = position(iDim,iPart)-position_old(iDim,iPart);
-            dist += delta*delta;
-        }
-        return dist;
-    }
-    inline double dist( unsigned int iPart, unsigned int iDim ) {
-        double delta = abs( position(iDim,iPart)-position_old(iDim,iPart) );
-        return delta;
-    }
-    
     Particle operator()(unsigned int iPart);
 
 
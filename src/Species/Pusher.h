@@ -19,7 +19,8 @@ public:
     virtual ~Pusher();
 
     //! Overloading of () operator
-    virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread) = 0;
+    //!   fields of particle ipart are read at index ipart-ipart_ref of the thread buffers of smpi
+    virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref = 0) = 0;
 
 protected:
     double dt, dts2;
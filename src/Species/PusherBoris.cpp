@@ -12,6 +12,9 @@ using namespace std;
 PusherBoris::PusherBoris(Params& params, Species *species)
     : Pusher(params, species)
 {
+    if      (nDim_==1) push_ = &PusherBoris::push<1>;
+    else if (nDim_==2) push_ = &PusherBoris::push<2>;
+    else               push_ = &PusherBoris::push<3>;
 }
 
 PusherBoris::~PusherBoris()
@@ -22,70 +25,78 @@ PusherBoris::~PusherBoris()
     Lorentz Force -- leap-frog (Boris) scheme
 ***********************************************************************/
 
-void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+void PusherBoris::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
-    std::vector<double> *gf = &(smpi->dynamics_gf[ithread]);
-
-    double charge_over_mass_dts2;
-    double umx, umy, umz, upx, upy, upz;
-    double alpha, inv_det_T, Tx, Ty, Tz, Tx2, Ty2, Tz2;
-    double TxTy, TyTz, TzTx;
-    double pxsm, pysm, pzsm;
-
-    double* momentum[3];
-    for ( int i = 0 ; i<3 ; i++ )
-        momentum[i] =  &( particles.momentum(i,0) );
-    double* position[3];
-    for ( int i = 0 ; i<nDim_ ; i++ )
-        position[i] =  &( particles.position(i,0) );
-    short* charge = &( particles.charge(0) );
-
-    #pragma simd
+    (this->*push_)(particles, smpi, istart, iend, ithread, ipart_ref);
+}
+
+template<int Ndim>
+void PusherBoris::push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
+{
+    // Thread buffers : the fields and gamma of particle ipart are stored at index ipart-ipart_ref
+    double* __restrict__ Ex = smpi->dynamics_Epart[ithread][0].data();
+    double* __restrict__ Ey = smpi->dynamics_Epart[ithread][1].data();
+    double* __restrict__ Ez = smpi->dynamics_Epart[ithread][2].data();
+    double* __restrict__ Bx = smpi->dynamics_Bpart[ithread][0].data();
+    double* __restrict__ By = smpi->dynamics_Bpart[ithread][1].data();
+    double* __restrict__ Bz = smpi->dynamics_Bpart[ithread][2].data();
+    double* __restrict__ gf = smpi->dynamics_gf[ithread].data();
+
+    particle_real* __restrict__ momentum_x = particles.momentum(0).data();
+    particle_real* __restrict__ momentum_y = particles.momentum(1).data();
+    particle_real* __restrict__ momentum_z = particles.momentum(2).data();
+    double* __restrict__ position_x =          particles.position(0).data();
+    double* __restrict__ position_y = Ndim>1 ? particles.position(1).data() : NULL;
+    double* __restrict__ position_z = Ndim>2 ? particles.position(2).data() : NULL;
+    short* __restrict__ charge = particles.charge().data();
+
+    const double one_over_mass = one_over_mass_, half_dt = dts2, step = dt;
+
+    #pragma omp simd
     for (int ipart=istart ; ipart<iend; ipart++ ) {
-        charge_over_mass_dts2 = (double)(charge[ipart])*one_over_mass_*dts2;
+        double charge_over_mass_dts2 = (double)(charge[ipart])*one_over_mass*half_dt;
 
         // init Half-acceleration in the electric field
-        pxsm = charge_over_mass_dts2*(*Epart)[ipart].x;
-        pysm = charge_over_mass_dts2*(*Epart)[ipart].y;
-        pzsm = charge_over_mass_dts2*(*Epart)[ipart].z;
+        double pxsm = charge_over_mass_dts2*Ex[ipart-ipart_ref];
+        double pysm = charge_over_mass_dts2*Ey[ipart-ipart_ref];
+        double pzsm = charge_over_mass_dts2*Ez[ipart-ipart_ref];
 
-        //(*this)(particles, ipart, (*Epart)[ipart], (*Bpart)[ipart] , (*gf)[ipart]);
-        umx = momentum[0][ipart] + pxsm;
-        umy = momentum[1][ipart] + pysm;
-        umz = momentum[2][ipart] + pzsm;
-        (*gf)[ipart]  = sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
+        double umx = momentum_x[ipart] + pxsm;
+        double umy = momentum_y[ipart] + pysm;
+        double umz = momentum_z[ipart] + pzsm;
+        double gfm = sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
 
         // Rotation in the magnetic field
-        alpha = charge_over_mass_dts2/(*gf)[ipart];
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
-        Tx2   = Tx*Tx;
-        Ty2   = Ty*Ty;
-        Tz2   = Tz*Tz;
-        TxTy  = Tx*Ty;
-        TyTz  = Ty*Tz;
-        TzTx  = Tz*Tx;
-        inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
-
-        upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
-        upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
-        upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
+        double alpha = charge_over_mass_dts2/gfm;
+        double Tx    = alpha * Bx[ipart-ipart_ref];
+        double Ty    = alpha * By[ipart-ipart_ref];
+        double Tz    = alpha * Bz[ipart-ipart_ref];
+        double Tx2   = Tx*Tx;
+        double Ty2   = Ty*Ty;
+        double Tz2   = Tz*Tz;
+        double TxTy  = Tx*Ty;
+        double TyTz  = Ty*Tz;
+        double TzTx  = Tz*Tx;
+        double inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
+
+        double upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
+        double upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
+        double upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
 
         // finalize Half-acceleration in the electric field
         pxsm += upx;
         pysm += upy;
         pzsm += upz;
-        (*gf)[ipart] = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        double gfp = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        gf[ipart-ipart_ref] = gfp;
 
-        momentum[0][ipart] = pxsm;
-        momentum[1][ipart] = pysm;
-        momentum[2][ipart] = pzsm;
+        momentum_x[ipart] = pxsm;
+        momentum_y[ipart] = pysm;
+        momentum_z[ipart] = pzsm;
 
         // Move the particle
-        for ( int i = 0 ; i<nDim_ ; i++ ) 
-            position[i][ipart]     += dt*momentum[i][ipart]/(*gf)[ipart];
+                     position_x[ipart] += step*pxsm/gfp;
+        if (Ndim>1)  position_y[ipart] += step*pysm/gfp;
+        if (Ndim>2)  position_z[ipart] += step*pzsm/gfp;
     }
 }
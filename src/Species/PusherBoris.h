@@ -19,7 +19,14 @@ public:
     PusherBoris(Params& params, Species *species);
     ~PusherBoris();
     //! Overloading of () operator
-    virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread);
+    virtual void operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref);
+
+private:
+    //! Push of particles istart to iend-1, specialized on the number of dimensions of the particles
+    template<int Ndim>
+    void push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref);
+    //! Specialization of push selected at construction, according to nDim_
+    void (PusherBoris::*push_)(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref);
 
 };
 
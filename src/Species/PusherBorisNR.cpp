@@ -10,6 +10,9 @@ using namespace std;
 PusherBorisNR::PusherBorisNR(Params& params, Species *species)
     : Pusher(params, species)
 {
+    if      (nDim_==1) push_ = &PusherBorisNR::push<1>;
+    else if (nDim_==2) push_ = &PusherBorisNR::push<2>;
+    else               push_ = &PusherBorisNR::push<3>;
 }
 
 PusherBorisNR::~PusherBorisNR()
@@ -20,55 +23,70 @@ PusherBorisNR::~PusherBorisNR()
     Lorentz Force -- leap-frog (Boris) scheme
 ***********************************************************************/
 
-void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+void PusherBorisNR::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
-    std::vector<double> *gf = &(smpi->dynamics_gf[ithread]);
-
-    double charge_over_mass_ ;
-    double umx, umy, umz;
-    double upx, upy, upz;
-    double alpha;
-    double Tx, Ty, Tz;
-    double T2;
-    double Sx, Sy, Sz;
+    (this->*push_)(particles, smpi, istart, iend, ithread, ipart_ref);
+}
 
+template<int Ndim>
+void PusherBorisNR::push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
+{
+    // Thread buffers : the fields and gamma of particle ipart are stored at index ipart-ipart_ref
+    double* __restrict__ Ex = smpi->dynamics_Epart[ithread][0].data();
+    double* __restrict__ Ey = smpi->dynamics_Epart[ithread][1].data();
+    double* __restrict__ Ez = smpi->dynamics_Epart[ithread][2].data();
+    double* __restrict__ Bx = smpi->dynamics_Bpart[ithread][0].data();
+    double* __restrict__ By = smpi->dynamics_Bpart[ithread][1].data();
+    double* __restrict__ Bz = smpi->dynamics_Bpart[ithread][2].data();
+    double* __restrict__ gf = smpi->dynamics_gf[ithread].data();
+
+    particle_real* __restrict__ momentum_x = particles.momentum(0).data();
+    particle_real* __restrict__ momentum_y = particles.momentum(1).data();
+    particle_real* __restrict__ momentum_z = particles.momentum(2).data();
+    double* __restrict__ position_x =          particles.position(0).data();
+    double* __restrict__ position_y = Ndim>1 ? particles.position(1).data() : NULL;
+    double* __restrict__ position_z = Ndim>2 ? particles.position(2).data() : NULL;
+    short* __restrict__ charge = particles.charge().data();
+
+    const double one_over_mass = one_over_mass_, mass = mass_, half_dt = dts2, step = dt;
+
+    #pragma omp simd
     for (int ipart=istart ; ipart<iend; ipart++ ) {
 
-        charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
-        alpha = charge_over_mass_*dts2;
+        double charge_over_mass_ = static_cast<double>(charge[ipart])*one_over_mass;
+        double alpha = charge_over_mass_*half_dt;
 
         // uminus = v + q/m * dt/2 * E
-        umx = particles.momentum(0, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].x;
-        umy = particles.momentum(1, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].y;
-        umz = particles.momentum(2, ipart) * one_over_mass_ + alpha * (*Epart)[ipart].z;
+        double umx = momentum_x[ipart] * one_over_mass + alpha * Ex[ipart-ipart_ref];
+        double umy = momentum_y[ipart] * one_over_mass + alpha * Ey[ipart-ipart_ref];
+        double umz = momentum_z[ipart] * one_over_mass + alpha * Ez[ipart-ipart_ref];
 
 
         // Rotation in the magnetic field
 
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
+        double Tx    = alpha * Bx[ipart-ipart_ref];
+        double Ty    = alpha * By[ipart-ipart_ref];
+        double Tz    = alpha * Bz[ipart-ipart_ref];
 
-        T2 = Tx*Tx + Ty*Ty + Tz*Tz;
+        double T2 = Tx*Tx + Ty*Ty + Tz*Tz;
 
-        Sx = 2*Tx/(1.+T2);
-        Sy = 2*Ty/(1.+T2);
-        Sz = 2*Tz/(1.+T2);
+        double Sx = 2*Tx/(1.+T2);
+        double Sy = 2*Ty/(1.+T2);
+        double Sz = 2*Tz/(1.+T2);
 
         // uplus = uminus + uprims x S
-        upx = umx + umy*Sz - umz*Sy;
-        upy = umy + umz*Sx - umx*Sz;
-        upz = umz + umx*Sy - umy*Sx;
+        double upx = umx + umy*Sz - umz*Sy;
+        double upy = umy + umz*Sx - umx*Sz;
+        double upz = umz + umx*Sy - umy*Sx;
 
 
-        particles.momentum(0, ipart) = mass_ * (upx + alpha*(*Epart)[ipart].x);
-        particles.momentum(1, ipart) = mass_ * (upy + alpha*(*Epart)[ipart].y);
-        particles.momentum(2, ipart) = mass_ * (upz + alpha*(*Epart)[ipart].z);
+        momentum_x[ipart] = mass * (upx + alpha*Ex[ipart-ipart_ref]);
+        momentum_y[ipart] = mass * (upy + alpha*Ey[ipart-ipart_ref]);
+        momentum_z[ipart] = mass * (upz + alpha*Ez[ipart-ipart_ref]);
 
         // Move the particle
-        for ( int i = 0 ; i<nDim_ ; i++ )
-            particles.position(i, ipart)     += dt*particles.momentum(i, ipart)/(*gf)[ipart];
+                     position_x[ipart] += step*momentum_x[ipart]/gf[ipart-ipart_ref];
+        if (Ndim>1)  position_y[ipart] += step*momentum_y[ipart]/gf[ipart-ipart_ref];
+        if (Ndim>2)  position_z[ipart] += step*momentum_z[ipart]/gf[ipart-ipart_ref];
     }
 }
@@ -11,6 +11,9 @@ using namespace std;
 PusherRRLL::PusherRRLL(Params& params, Species *species)
     : Pusher(params, species)
 {
+    if      (nDim_==1) push_ = &PusherRRLL::push<1>;
+    else if (nDim_==2) push_ = &PusherRRLL::push<2>;
+    else               push_ = &PusherRRLL::push<3>;
 }
 
 PusherRRLL::~PusherRRLL()
@@ -81,59 +84,77 @@ void PusherRRLL::operator() (Particles &particles, int ipart, LocalFields Epart,
     //DEBUG(5, "\t END "<< particles.position(0, ipart) );
 
 }
-void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread)
+void PusherRRLL::operator() (Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
 {
-    std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
-    std::vector<LocalFields> *Bpart = &(smpi->dynamics_Bpart[ithread]);
-    std::vector<double> *gf = &(smpi->dynamics_gf[ithread]);
-    double charge_over_mass_ ;
-    double umx, umy, umz, upx, upy, upz;
-    double alpha, inv_det_T, Tx, Ty, Tz, Tx2, Ty2, Tz2;
-    double TxTy, TyTz, TzTx;
-    double pxsm, pysm, pzsm;
+    (this->*push_)(particles, smpi, istart, iend, ithread, ipart_ref);
+}
 
+template<int Ndim>
+void PusherRRLL::push(Particles &particles, SmileiMPI* smpi, int istart, int iend, int ithread, int ipart_ref)
+{
+    // Thread buffers : the fields and gamma of particle ipart are stored at index ipart-ipart_ref
+    double* __restrict__ Ex = smpi->dynamics_Epart[ithread][0].data();
+    double* __restrict__ Ey = smpi->dynamics_Epart[ithread][1].data();
+    double* __restrict__ Ez = smpi->dynamics_Epart[ithread][2].data();
+    double* __restrict__ Bx = smpi->dynamics_Bpart[ithread][0].data();
+    double* __restrict__ By = smpi->dynamics_Bpart[ithread][1].data();
+    double* __restrict__ Bz = smpi->dynamics_Bpart[ithread][2].data();
+    double* __restrict__ gf = smpi->dynamics_gf[ithread].data();
+
+    particle_real* __restrict__ momentum_x = particles.momentum(0).data();
+    particle_real* __restrict__ momentum_y = particles.momentum(1).data();
+    particle_real* __restrict__ momentum_z = particles.momentum(2).data();
+    double* __restrict__ position_x =          particles.position(0).data();
+    double* __restrict__ position_y = Ndim>1 ? particles.position(1).data() : NULL;
+    double* __restrict__ position_z = Ndim>2 ? particles.position(2).data() : NULL;
+    particle_real* __restrict__ chi = particles.chi().data();
+    short* __restrict__ charge = particles.charge().data();
+
+    const double one_over_mass = one_over_mass_, half_dt = dts2, step = dt;
+
+    #pragma omp simd
     for (int ipart=istart ; ipart<iend; ipart++ ) {
-        //(*this)(particles, iPart, (*Epart)[iPart], (*Bpart)[iPart] , (*gf)[iPart]);
-        charge_over_mass_ = static_cast<double>(particles.charge(ipart))*one_over_mass_;
+        double charge_over_mass_ = static_cast<double>(charge[ipart])*one_over_mass;
         // Half-acceleration in the electric field
-        umx = particles.momentum(0, ipart) + charge_over_mass_*(*Epart)[ipart].x*dts2;
-        umy = particles.momentum(1, ipart) + charge_over_mass_*(*Epart)[ipart].y*dts2;
-        umz = particles.momentum(2, ipart) + charge_over_mass_*(*Epart)[ipart].z*dts2;
-        (*gf)[ipart]  = sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
+        double umx = momentum_x[ipart] + charge_over_mass_*Ex[ipart-ipart_ref]*half_dt;
+        double umy = momentum_y[ipart] + charge_over_mass_*Ey[ipart-ipart_ref]*half_dt;
+        double umz = momentum_z[ipart] + charge_over_mass_*Ez[ipart-ipart_ref]*half_dt;
+        double gfm = sqrt( 1.0 + umx*umx + umy*umy + umz*umz );
 
         // Rotation in the magnetic field
-        alpha = charge_over_mass_*dts2/(*gf)[ipart];
-        Tx    = alpha * (*Bpart)[ipart].x;
-        Ty    = alpha * (*Bpart)[ipart].y;
-        Tz    = alpha * (*Bpart)[ipart].z;
-        Tx2   = Tx*Tx;
-        Ty2   = Ty*Ty;
-        Tz2   = Tz*Tz;
-        TxTy  = Tx*Ty;
-        TyTz  = Ty*Tz;
-        TzTx  = Tz*Tx;
-        inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
-
-        upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
-        upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
-        upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
+        double alpha = charge_over_mass_*half_dt/gfm;
+        double Tx    = alpha * Bx[ipart-ipart_ref];
+        double Ty    = alpha * By[ipart-ipart_ref];
+        double Tz    = alpha * Bz[ipart-ipart_ref];
+        double Tx2   = Tx*Tx;
+        double Ty2   = Ty*Ty;
+        double Tz2   = Tz*Tz;
+        double TxTy  = Tx*Ty;
+        double TyTz  = Ty*Tz;
+        double TzTx  = Tz*Tx;
+        double inv_det_T = 1.0/(1.0+Tx2+Ty2+Tz2);
+
+        double upx = (  (1.0+Tx2-Ty2-Tz2)* umx  +      2.0*(TxTy+Tz)* umy  +      2.0*(TzTx-Ty)* umz  )*inv_det_T;
+        double upy = (      2.0*(TxTy-Tz)* umx  +  (1.0-Tx2+Ty2-Tz2)* umy  +      2.0*(TyTz+Tx)* umz  )*inv_det_T;
+        double upz = (      2.0*(TzTx+Ty)* umx  +      2.0*(TyTz-Tx)* umy  +  (1.0-Tx2-Ty2+Tz2)* umz  )*inv_det_T;
 
         // Half-acceleration in the electric field
-        pxsm = upx + charge_over_mass_*(*Epart)[ipart].x*dts2;
-        pysm = upy + charge_over_mass_*(*Epart)[ipart].y*dts2;
-        pzsm = upz + charge_over_mass_*(*Epart)[ipart].z*dts2;
-        (*gf)[ipart] = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        double pxsm = upx + charge_over_mass_*Ex[ipart-ipart_ref]*half_dt;
+        double pysm = upy + charge_over_mass_*Ey[ipart-ipart_ref]*half_dt;
+        double pzsm = upz + charge_over_mass_*Ez[ipart-ipart_ref]*half_dt;
+        double gfp = sqrt( 1.0 + pxsm*pxsm + pysm*pysm + pzsm*pzsm );
+        gf[ipart-ipart_ref] = gfp;
 
-        particles.momentum(0, ipart) = pxsm;
-        particles.momentum(1, ipart) = pysm;
-        particles.momentum(2, ipart) = pzsm;
+        momentum_x[ipart] = pxsm;
+        momentum_y[ipart] = pysm;
+        momentum_z[ipart] = pzsm;
 
         // Move the particle
-        for ( int i = 0 ; i<nDim_ ; i++ )
-            particles.position(i, ipart)     += dt*particles.momentum(i, ipart)/(*gf)[ipart];
+                     position_x[ipart] += step*pxsm/gfp;
+        if (Ndim>1)  position_y[ipart] += step*pysm/gfp;
+        if (Ndim>2)  position_z[ipart] += step*pzsm/gfp;
 
         // COMPUTE Chi
-        particles.chi(ipart)=0.5;
-        //DEBUG(5, "\t END "<< particles.position(0, ipart) );
+        chi[ipart]=0.5;
     }
 }
@@ -5,6 +5,7 @@
 #include <cstdlib>
 
 #include <iostream>
+#include <algorithm>
 
 #include <omp.h>
 
@@ -48,9 +49,16 @@ radiating(false),
 ionization_model("none"),
 velocityProfile(3,NULL),
 temperatureProfile(3,NULL),
+sort_mode("bin"),
+merge_every(0),
+merge_min_particles_per_cell(8),
+merge_min_packet_size(4),
+merge_max_packet_size(4),
+merge_momentum_cell_size(3,16),
 particles(&particles_sorted[0]),
 electron_species(NULL),
 clrw(params.clrw),  
+dynamics_block_size(params.dynamics_block_size),
 oversize(params.oversize), 
 cell_length(params.cell_length), 
 min_loc_vec(patch->getDomainLocalMin()), 
@@ -110,6 +118,7 @@ void Species::initCluster(Params& params)
     nrj_bc_lost = 0.;
     nrj_mw_lost = 0.;
     nrj_new_particles = 0.;
+    n_merged = 0.;
    
 }//END initCluster
 
@@ -398,34 +407,54 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
     // -------------------------------
     if (time_dual>time_frozen) { // moving particle
     
-        smpi->dynamics_resize(ithread, nDim_particle, bmax.back());
+        // Without dynamics_block_size, each bin goes through each step at once and the thread buffers hold the
+        // whole species. Otherwise, the bins are cut in blocks which go through all steps while still in cache,
+        // and the thread buffers only hold one block : particle iPart is stored at index iPart-ipart_ref.
+        bool fused = (dynamics_block_size > 0);
+        if (fused)
+            smpi->dynamics_resize(ithread, nDim_particle, dynamics_block_size);
+        else
+            smpi->dynamics_resize(ithread, nDim_particle, bmax.back());
 
         //Point to local thread dedicated buffers
         //Still needed for ionization
-        std::vector<LocalFields> *Epart = &(smpi->dynamics_Epart[ithread]);
+        std::vector<AlignedVector<double>> *Epart = &(smpi->dynamics_Epart[ithread]);
+        LocalFields Eloc;
 
+        int istart, iend, ipart_ref(0);
         for (unsigned int ibin = 0 ; ibin < bmin.size() ; ibin++) {
+        for (istart = bmin[ibin] ; istart < bmax[ibin] ; istart = iend) {
+            
+            if (fused) {
+                iend = min( istart + (int)dynamics_block_size, bmax[ibin] );
+                ipart_ref = istart;
+            } else {
+                iend = bmax[ibin];
+            }
 
             // Interpolate the fields at the particle position
-            (*Interp)(EMfields, *particles, smpi, bmin[ibin], bmax[ibin], ithread );
+            (*Interp)(EMfields, *particles, smpi, istart, iend, ithread, ipart_ref );
 
             //Ionization
             if (Ionize){                                
-                for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
+                for (iPart=istart ; (int)iPart<iend; iPart++ ) {
                     // Do the ionization (!for testParticles)
                     if ( (*particles).charge(iPart) < (int) atomic_number) {
                         //!\todo Check if it is necessary to put to 0 or if LocalFields ensures it
                         Jion.x=0.0;
                         Jion.y=0.0;
                         Jion.z=0.0;
-                        (*Ionize)(*particles, iPart, (*Epart)[iPart], Jion);
+                        Eloc.x = (*Epart)[0][iPart-ipart_ref];
+                        Eloc.y = (*Epart)[1][iPart-ipart_ref];
+                        Eloc.z = (*Epart)[2][iPart-ipart_ref];
+                        (*Ionize)(*particles, iPart, Eloc, Jion);
                         (*Proj)(EMfields->Jx_, EMfields->Jy_, EMfields->Jz_, *particles, iPart, Jion);
                     }
                 }
             }    
                 
             // Push the particles
-            (*Push)(*particles, smpi, bmin[ibin], bmax[ibin], ithread );
+            (*Push)(*particles, smpi, istart, iend, ithread, ipart_ref );
             //for (iPart=bmin[ibin] ; iPart<bmax[ibin]; iPart++ ) 
             //    (*Push)(*particles, iPart, (*Epart)[iPart], (*Bpart)[iPart] , (*gf)[iPart]);
 
@@ -433,10 +462,18 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
 
 
             // Apply wall and boundary conditions
-            for (iPart=bmin[ibin] ; (int)iPart<bmax[ibin]; iPart++ ) {
-                for(unsigned int iwall=0; iwall<partWalls->size(); iwall++) {
-                    if ( !(*partWalls)[iwall]->apply(*particles, iPart, this, ener_iPart)) {
-                        nrj_lost_per_thd[tid] += mass * ener_iPart;
+            double* gf = smpi->dynamics_gf[ithread].data();
+            double position_old[3];
+            for (iPart=istart ; (int)iPart<iend; iPart++ ) {
+                if ( partWalls->size()>0 ) {
+                    // Position before the push, recovered from the displacement (dt/gamma * p)
+                    for (unsigned int idim=0; idim<nDim_particle; idim++)
+                        position_old[idim] = (*particles).position(idim, iPart)
+                                           - params.timestep/gf[iPart-ipart_ref] * (*particles).momentum(idim, iPart);
+                    for(unsigned int iwall=0; iwall<partWalls->size(); iwall++) {
+                        if ( !(*partWalls)[iwall]->apply(*particles, iPart, position_old, this, ener_iPart)) {
+                            nrj_lost_per_thd[tid] += mass * ener_iPart;
+                        }
                     }
                 }
                 // Boundary Condition may be physical or due to domain decomposition
@@ -453,38 +490,17 @@ void Species::dynamics(double time_dual, unsigned int ispec, ElectroMagn* EMfiel
 
              // Project currents if not a Test species and charges as well if a diag is needed. 
              if (!(*particles).isTest)
-                 (*Proj)(EMfields, *particles, smpi, bmin[ibin], bmax[ibin], ithread, ibin, clrw, diag_flag, b_dim, ispec );
+                 (*Proj)(EMfields, *particles, smpi, istart, iend, ithread, ibin, clrw, diag_flag, b_dim, ispec, ipart_ref );
 
+        }// block
         }// ibin
 
         for (unsigned int ithd=0 ; ithd<nrj_lost_per_thd.size() ; ithd++)
             nrj_bc_lost += nrj_lost_per_thd[tid];
 
-        // Needs to be reviewed 
-        if (Ionize) {
-            for (unsigned int i=0; i < Ionize->new_electrons.size(); i++) {
-                // electron_species->(*particles).push_back(Ionize->new_electrons[i]);
-                                
-                int ibin = (int) ((Ionize->new_electrons).position(0,i) / cell_length[0]) - ( patch->getCellStartingGlobalIndex(0) + oversize[0] );
-                DEBUG("here " << ibin << " " << (Ionize->new_electrons).position(0,i)/(2*M_PI));
-
-                // Copy Ionize->new_electrons(i) in electron_species->particles at position electron_species->bmin[ibin]
-                Ionize->new_electrons.cp_particle(i, (*electron_species->particles), electron_species->bmin[ibin] );
-                                
-                // Update bins status
-                // (ugly update, memory is allocated anywhere, OK with vectors per particles parameters)
-                electron_species->bmax[ibin]++;
-                DEBUG("e- " << i << " to bin " << ibin << " (" <<bmin.size() << "," <<bmax.size()<<")" );
-                for (unsigned int ii=ibin+1; ii<bmin.size(); ii++) {
-                    electron_species->bmin[ii]++;
-                    electron_species->bmax[ii]++;
-                }
-            }
-            
-            // if (Ionize->new_electrons.size())
-            //      DEBUG("number of electrons " << electron_species->(*particles).size() << " " << );
-            Ionize->new_electrons.clear();
-        }
+        // Move the electrons created by ionization in the bins of the electron species
+        if (Ionize)
+            electron_species->importParticles( Ionize->new_electrons, patch );
     }
     else { // immobile particle (at the moment only project density)
         if ((diag_flag == 1)&&(!(*particles).isTest)){
@@ -574,8 +590,6 @@ void Species::sort_part()
 void Species::count_sort_part(Params &params)
 {
     unsigned int ip, npart, ixy,tot, oc, nxy, token;
-    int ix,iy;
-    double x,y;
 
     nxy = params.n_space[0]*params.n_space[1];
     token = (particles == &particles_sorted[0]);
@@ -590,15 +604,7 @@ void Species::count_sort_part(Params &params)
     // first loop counts the # of particles in each cell
     for (ip=0; ip < npart; ip++)
         {
-            x = (*particles).position(0,ip)-min_loc;
-            y = (*particles).position(1,ip)-min_loc_vec[1];
-
-            ix = floor(x * dx_inv_) ;
-            iy = floor(y * dy_inv_) ;
-
-            ixy = iy + ix*params.n_space[1];
-
-
+            ixy = cellIndex(ip, params);
             indices[ixy] ++;
         }
 
@@ -623,14 +629,7 @@ void Species::count_sort_part(Params &params)
 
     // last loop puts the particles and update the count array
     for (ip=0; ip < npart; ip++) {
-        x = (*particles).position(0,ip)-min_loc;
-        y = (*particles).position(1,ip)-min_loc_vec[1];
-
-        ix = floor(x * dx_inv_) ;
-        iy = floor(y * dy_inv_) ;
-
-        ixy = iy + ix*params.n_space[1];
-
+        ixy = cellIndex(ip, params);
         (*particles).overwrite_part(ip, particles_sorted[token] , indices[ixy]);
         indices[ixy]++;
     }
@@ -639,6 +638,283 @@ void Species::count_sort_part(Params &params)
 
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Sort particles by cell, in place (no copy of the particles)
+//   Cells are numbered as in count_sort_part, so that the cells of a bin are contiguous and bins remain ordered.
+//   Particles are permuted in cycles (American flag sort): a particle already inside the range of its cell is never
+//   moved, and each swap puts at least one particle in its final range. As most particles stay in their cell from
+//   one timestep to the next, only the particles which changed cell (and a few at the edges of the ranges) move.
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::cell_sort_part(Params &params)
+{
+    int ncell = params.n_space[0]*params.n_space[1];
+    int npart = (*particles).size();
+    
+    cell_of_part.resize(npart);
+    std::vector<int> cell_start(ncell+1), cell_next(ncell);
+    
+    // Count the particles in each cell
+    for (int ic=0; ic<=ncell; ic++) cell_start[ic] = 0;
+    for (int ip=0; ip<npart; ip++) {
+        cell_of_part[ip] = cellIndex(ip, params);
+        cell_start[cell_of_part[ip]+1]++;
+    }
+    for (int ic=0; ic<ncell; ic++) {
+        cell_start[ic+1] += cell_start[ic];
+        cell_next[ic] = cell_start[ic];
+    }
+    
+    // Permute particles until each cell range only contains its own particles
+    int ip, dest, dest_cell;
+    for (int ic=0; ic<ncell; ic++) {
+        while ( cell_next[ic] < cell_start[ic+1] ) {
+            ip = cell_next[ic];
+            dest_cell = cell_of_part[ip];
+            if ( dest_cell == ic ) {
+                cell_next[ic]++;
+                continue;
+            }
+            // Skip the particles already in place in the destination cell
+            while ( cell_of_part[cell_next[dest_cell]] == dest_cell ) cell_next[dest_cell]++;
+            dest = cell_next[dest_cell]++;
+            (*particles).swap_part(ip, dest);
+            std::swap( cell_of_part[ip], cell_of_part[dest] );
+        }
+    }
+    
+    // Bins bookmarking from the cells
+    unsigned int ncell_per_bin = clrw*params.n_space[1];
+    for (unsigned int ibin=0; ibin<bmin.size(); ibin++) {
+        bmin[ibin] = cell_start[ ibin   *ncell_per_bin];
+        bmax[ibin] = cell_start[(ibin+1)*ncell_per_bin];
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sort particles according to sort_mode
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::sort_particles(Params &params)
+{
+    if ( sort_mode == "cell" ) {
+        cell_sort_part(params);
+    } else if ( sort_mode == "count" ) {
+        // count_sort_part does not update bmin/bmax, this is done by sort_part
+        sort_part();
+        count_sort_part(params);
+    } else {
+        sort_part();
+    }
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Merge macro-particles sharing a cell and a momentum-space cell (M. Vranic et al., CPC 191, 65 (2015))
+//   Only the cells holding at least merge_min_particles_per_cell particles are processed. Their particles are grouped by
+//   charge and by momentum-space cell (merge_momentum_cell_size cells in |p|, azimuth and elevation, spanning the
+//   momenta of the cell). Each packet of merge_min_packet_size to merge_max_packet_size particles of a group is replaced
+//   by two particles of half the total weight, located at the positions of the first two particles of the packet,
+//   with momenta symmetric with respect to the total momentum: weight, charge, momentum and energy are conserved.
+//   Particles must be sorted by bins (this is done after each exchange).
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::mergeParticles(Params &params)
+{
+    Particles &part = *particles;
+    int npart = part.size();
+    if ( npart < (int)merge_min_particles_per_cell ) return;
+    
+    unsigned int np_cells = merge_momentum_cell_size[0];
+    unsigned int nt_cells = merge_momentum_cell_size[1];
+    unsigned int nf_cells = merge_momentum_cell_size[2];
+    long nmom_cells = np_cells*nt_cells*nf_cells;
+    
+    int ncell_per_bin = clrw * (nDim_particle>1 ? params.n_space[1] : 1);
+    std::vector<bool> removed(npart, false);
+    std::vector<int> cell(npart), count(ncell_per_bin+1), index;
+    std::vector<double> pabs, theta, phi;
+    std::vector< std::pair<long,int> > group;
+    
+    for (unsigned int ibin=0; ibin<bmin.size(); ibin++) {
+        int nbin = bmax[ibin]-bmin[ibin];
+        if ( nbin < (int)merge_min_particles_per_cell ) continue;
+        
+        // Particles of the bin grouped by cell (counting sort of their indexes)
+        for (int ic=0; ic<=ncell_per_bin; ic++) count[ic] = 0;
+        for (int ip=bmin[ibin]; ip<bmax[ibin]; ip++) {
+            cell[ip] = cellIndex(ip, params) - ibin*ncell_per_bin;
+            cell[ip] = max( 0, min( cell[ip], ncell_per_bin-1 ) );
+            count[cell[ip]+1]++;
+        }
+        for (int ic=0; ic<ncell_per_bin; ic++) count[ic+1] += count[ic];
+        index.resize(nbin);
+        for (int ip=bmin[ibin]; ip<bmax[ibin]; ip++)
+            index[count[cell[ip]]++] = ip;
+        // count[ic] is now the end of cell ic in index
+        
+        for (int ic=0; ic<ncell_per_bin; ic++) {
+            int first = (ic==0) ? 0 : count[ic-1];
+            int n = count[ic] - first;
+            if ( n < (int)merge_min_particles_per_cell ) continue;
+            
+            // Momentum of the particles in spherical coordinates, and their range in the cell
+            pabs.resize(n); theta.resize(n); phi.resize(n);
+            double pmin(0.), pmax(0.), tmin(0.), tmax(0.), fmin(0.), fmax(0.);
+            for (int i=0; i<n; i++) {
+                int ip = index[first+i];
+                double px = part.momentum(0,ip), py = part.momentum(1,ip), pz = part.momentum(2,ip);
+                pabs [i] = sqrt( px*px + py*py + pz*pz );
+                theta[i] = atan2( py, px );
+                phi  [i] = pabs[i]>0. ? asin( pz/pabs[i] ) : 0.;
+                if (i==0 || pabs [i]<pmin) pmin = pabs [i];
+                if (i==0 || pabs [i]>pmax) pmax = pabs [i];
+                if (i==0 || theta[i]<tmin) tmin = theta[i];
+                if (i==0 || theta[i]>tmax) tmax = theta[i];
+                if (i==0 || phi  [i]<fmin) fmin = phi  [i];
+                if (i==0 || phi  [i]>fmax) fmax = phi  [i];
+            }
+            double inv_dp = pmax>pmin ? np_cells/(pmax-pmin) : 0.;
+            double inv_dt = tmax>tmin ? nt_cells/(tmax-tmin) : 0.;
+            double inv_df = fmax>fmin ? nf_cells/(fmax-fmin) : 0.;
+            
+            // Group the particles of the cell by charge and momentum cell
+            group.resize(n);
+            for (int i=0; i<n; i++) {
+                long ipc = min( (long)((pabs [i]-pmin)*inv_dp), (long)np_cells-1 );
+                long itc = min( (long)((theta[i]-tmin)*inv_dt), (long)nt_cells-1 );
+                long ifc = min( (long)((phi  [i]-fmin)*inv_df), (long)nf_cells-1 );
+                long key = (long)part.charge(index[first+i]) * nmom_cells + ipc + np_cells*( itc + nt_cells*ifc );
+                group[i] = std::make_pair( key, index[first+i] );
+            }
+            std::sort( group.begin(), group.end() );
+            
+            // Merge the packets of each group
+            int g0, g1;
+            for (g0=0; g0<n; g0=g1) {
+                for (g1=g0; g1<n && group[g1].first==group[g0].first; g1++);
+                int k0 = g0;
+                while ( g1-k0 >= (int)merge_min_packet_size ) {
+                    int k1 = min( k0+(int)merge_max_packet_size, g1 );
+                    
+                    // Total weight, momentum and energy of the packet
+                    double w_t(0.), px_t(0.), py_t(0.), pz_t(0.), e_t(0.);
+                    for (int k=k0; k<k1; k++) {
+                        int ip = group[k].second;
+                        double w = part.weight(ip);
+                        w_t  += w;
+                        px_t += w * part.momentum(0,ip);
+                        py_t += w * part.momentum(1,ip);
+                        pz_t += w * part.momentum(2,ip);
+                        e_t  += w * part.lor_fac(ip);
+                    }
+                    
+                    // Both new particles have the mean energy, and their momenta make an angle
+                    // +/- omega with the total momentum, so that their sum is the total momentum
+                    double gamma_a = e_t/w_t;
+                    double p_a  = sqrt( max( gamma_a*gamma_a - 1., 0. ) );
+                    double p_t  = sqrt( px_t*px_t + py_t*py_t + pz_t*pz_t );
+                    double cos_omega = p_a>0. ? min( p_t/(w_t*p_a), 1. ) : 1.;
+                    double sin_omega = sqrt( 1. - cos_omega*cos_omega );
+                    
+                    // e1 along the total momentum, e2 perpendicular to e1 in the plane of e1 and of the first momentum
+                    double e1[3] = {1., 0., 0.};
+                    if (p_t>0.) {
+                        e1[0] = px_t/p_t; e1[1] = py_t/p_t; e1[2] = pz_t/p_t;
+                    }
+                    int ip_a = group[k0].second, ip_b = group[k0+1].second;
+                    double d[3] = { part.momentum(0,ip_a), part.momentum(1,ip_a), part.momentum(2,ip_a) };
+                    double e2[3], d_e1 = d[0]*e1[0] + d[1]*e1[1] + d[2]*e1[2];
+                    for (int i=0; i<3; i++) e2[i] = d[i] - d_e1*e1[i];
+                    double n2 = sqrt( e2[0]*e2[0] + e2[1]*e2[1] + e2[2]*e2[2] );
+                    if ( n2 <= 1.e-10*(abs(d_e1)+1.e-300) ) {
+                        // first momentum along e1 : use the axis the least aligned with e1
+                        int iax = 0;
+                        for (int i=1; i<3; i++) if ( abs(e1[i]) < abs(e1[iax]) ) iax = i;
+                        for (int i=0; i<3; i++) e2[i] = (i==iax ? 1. : 0.) - e1[iax]*e1[i];
+                        n2 = sqrt( e2[0]*e2[0] + e2[1]*e2[1] + e2[2]*e2[2] );
+                    }
+                    for (int i=0; i<3; i++) e2[i] /= n2;
+                    
+                    for (int i=0; i<3; i++) {
+                        part.momentum(i,ip_a) = p_a * ( cos_omega*e1[i] + sin_omega*e2[i] );
+                        part.momentum(i,ip_b) = p_a * ( cos_omega*e1[i] - sin_omega*e2[i] );
+                    }
+                    part.weight(ip_a) = 0.5*w_t;
+                    part.weight(ip_b) = 0.5*w_t;
+                    for (int k=k0+2; k<k1; k++)
+                        removed[group[k].second] = true;
+                    n_merged += k1-k0-2;
+                    
+                    k0 = k1;
+                }
+            }
+        } // ic
+    } // ibin
+    
+    // Remove the merged particles, keeping the order of the others and the bins contiguous
+    int inew = 0;
+    for (unsigned int ibin=0; ibin<bmin.size(); ibin++) {
+        int ibin_start = inew;
+        for (int ip=bmin[ibin]; ip<bmax[ibin]; ip++) {
+            if (removed[ip]) continue;
+            if (ip!=inew) part.overwrite_part(ip, inew);
+            inew++;
+        }
+        bmin[ibin] = ibin_start;
+        bmax[ibin] = inew;
+    }
+    if (inew<npart) part.erase_particle_trail(inew);
+}
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Insert the particles of new_particles at the end of their bins, then empty new_particles
+//   new_particles is an unsorted append buffer (e.g. filled by ionization during the step).
+//   As in Patch::finalizeCommParticles, room is made in all bins in one pass from the last bin to the first one:
+//   each bin is shifted by moving at most min(particles in bin, shift) particles, instead of one insertion per new particle.
+// ---------------------------------------------------------------------------------------------------------------------
+void Species::importParticles(Particles& new_particles, Patch* patch)
+{
+    unsigned int nNew = new_particles.size();
+    if (nNew==0) return;
+    
+    int nbin = bmin.size();
+    int first_cell = patch->getCellStartingGlobalIndex(0) + oversize[0];
+    
+    // Bin of each new particle, and number of new particles per bin (stored in shift[ibin+1])
+    vector<int> new_bin(nNew);
+    vector<int> shift(nbin+1, 0);
+    for (unsigned int i=0; i<nNew; i++) {
+        int ibin = ( (int)(new_particles.position(0,i) / cell_length[0]) - first_cell ) / (int)clrw;
+        ibin = max( 0, min( ibin, nbin-1 ) );
+        new_bin[i] = ibin;
+        shift[ibin+1]++;
+    }
+    // shift[ibin] becomes the number of new particles in bins before ibin
+    for (int ibin=1; ibin<=nbin; ibin++)
+        shift[ibin] += shift[ibin-1];
+    
+    // Make room at the end of the particles array
+    (*particles).create_particles( nNew );
+    
+    // Shift bins, must be done sequentially, last bin first
+    int n_particles, nmove, lmove;
+    for (int ibin=nbin-1; ibin>=1; ibin--) {
+        n_particles = bmax[ibin]-bmin[ibin];
+        nmove = min(n_particles, shift[ibin]); // Nbr of particles to move
+        lmove = max(n_particles, shift[ibin]); // How far particles must be shifted
+        if (nmove>0) (*particles).overwrite_part(bmin[ibin], bmin[ibin]+lmove, nmove);
+        bmin[ibin] += shift[ibin];
+        bmax[ibin] += shift[ibin];
+    }
+    
+    // Room has been made at the end of each bin: copy the new particles there
+    for (unsigned int i=0; i<nNew; i++) {
+        new_particles.overwrite_part( i, *particles, bmax[new_bin[i]] );
+        bmax[new_bin[i]]++;
+    }
+    
+    new_particles.clear();
+}
+
 
 int Species::createParticles(vector<unsigned int> n_space_to_create, Params& params, Patch *patch, int new_bin_idx)
 {
@@ -680,18 +956,32 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
     int npart_effective = 0;
     double remainder, nppc;
     
+    // Coordinates of all cells, so that each profile is evaluated in one call
+    unsigned int ncells = n_space_to_create[0]*n_space_to_create[1]*n_space_to_create[2];
+    vector<vector<double> > x_cells(3, vector<double>(ncells));
+    unsigned int icell = 0;
     for (unsigned int i=0; i<n_space_to_create[0]; i++) {
         for (unsigned int j=0; j<n_space_to_create[1]; j++) {
             for (unsigned int k=0; k<n_space_to_create[2]; k++) {
-                n_part_in_cell(i,j,k) = 0.;
-                
-                vector<double> x_cell(3,0);
-                x_cell[0] = cell_position[0] + (i+0.5)*cell_length[0];
-                x_cell[1] = cell_position[1] + (j+0.5)*cell_length[1];
-                x_cell[2] = cell_position[2] + (k+0.5)*cell_length[2];
-                
-                // Obtain the number of particles per cell
-                nppc = ppcProfile->valueAt(x_cell);
+                x_cells[0][icell] = cell_position[0] + (i+0.5)*cell_length[0];
+                x_cells[1][icell] = cell_position[1] + (j+0.5)*cell_length[1];
+                x_cells[2][icell] = cell_position[2] + (k+0.5)*cell_length[2];
+                icell++;
+            }
+        }
+    }
+    
+    // Obtain the number of particles per cell
+    vector<double> profile_values;
+    ppcProfile->valuesAt(x_cells, profile_values);
+    
+    // List the cells which contain particles
+    vector<unsigned int> cells;
+    icell = 0;
+    for (unsigned int i=0; i<n_space_to_create[0]; i++) {
+        for (unsigned int j=0; j<n_space_to_create[1]; j++) {
+            for (unsigned int k=0; k<n_space_to_create[2]; k++) {
+                nppc = profile_values[icell];
                 
                 n_part_in_cell(i,j,k) = floor(nppc);
                 // if nb of particle per cell is not an integer value
@@ -709,39 +999,54 @@ int Species::createParticles(vector<unsigned int> n_space_to_create, Params& par
                 if( n_part_in_cell(i,j,k)<=0. ) {
                     n_part_in_cell(i,j,k) = 0.;
                     density(i,j,k) = 0.;
-                    continue;
-                }
-                
-                // assign charge its correct value in the cell
-                charge(i,j,k) = chargeProfile->valueAt(x_cell);
-                if( charge(i,j,k)>max_charge ) max_charge=charge(i,j,k);
-                // assign density its correct value in the cell
-                density(i,j,k) = densityProfile->valueAt(x_cell);
-                if(density(i,j,k)!=0. && densityProfileType=="charge") {
-                    if(charge(i,j,k)==0.) ERROR("Encountered non-zero charge density and zero charge at the same location");
-                    density(i,j,k) /= charge(i,j,k);
+                } else {
+                    cells.push_back(icell);
                 }
-                density(i,j,k) = abs(density(i,j,k));
-                
-                // for non-zero density define temperature & mean-velocity and increment the nb of particles
-                if (density(i,j,k)!=0.0) {
-                    
-                    // assign the temperature & mean-velocity their correct value in the cell
-                    for (unsigned int m=0; m<3; m++) {
-                        temperature[m](i,j,k) = temperatureProfile[m]->valueAt(x_cell);
-                        //MESSAGE("temp 1 :" <<  temperature[m](i,j,k))
-                        velocity[m](i,j,k) = velocityProfile[m]->valueAt(x_cell);
-                    }
-                    
-                    // increment the effective number of particle by n_part_in_cell(i,j,k)
-                    // for each cell with as non-zero density
-                    npart_effective += n_part_in_cell(i,j,k);
-                    
-                }//ENDif non-zero density
-                
-            }//i
+                icell++;
+            }//k
         }//j
-    }//k end the loop on all cells
+    }//i
+    
+    // assign charge and density their correct values in these cells
+    for (unsigned int c=0; c<cells.size(); c++) {
+        for (unsigned int idim=0; idim<3; idim++) x_cells[idim][c] = x_cells[idim][cells[c]];
+    }
+    for (unsigned int idim=0; idim<3; idim++) x_cells[idim].resize(cells.size());
+    vector<double> charge_values;
+    chargeProfile ->valuesAt(x_cells, charge_values);
+    densityProfile->valuesAt(x_cells, profile_values);
+    unsigned int nselected = 0;
+    for (unsigned int c=0; c<cells.size(); c++) {
+        icell = cells[c];
+        charge.data_[icell] = charge_values[c];
+        if( charge_values[c]>max_charge ) max_charge=charge_values[c];
+        double dens = profile_values[c];
+        if(dens!=0. && densityProfileType=="charge") {
+            if(charge_values[c]==0.) ERROR("Encountered non-zero charge density and zero charge at the same location");
+            dens /= charge_values[c];
+        }
+        density.data_[icell] = abs(dens);
+        
+        // keep the cells with non-zero density, and increment the nb of particles
+        if (density.data_[icell]!=0.0) {
+            cells[nselected] = icell;
+            x_cells[0][nselected] = x_cells[0][c];
+            x_cells[1][nselected] = x_cells[1][c];
+            x_cells[2][nselected] = x_cells[2][c];
+            nselected++;
+            npart_effective += n_part_in_cell.data_[icell];
+        }
+    }
+    cells.resize(nselected);
+    for (unsigned int idim=0; idim<3; idim++) x_cells[idim].resize(nselected);
+    
+    // assign the temperature & mean-velocity their correct value in the cells with non-zero density
+    for (unsigned int m=0; m<3; m++) {
+        temperatureProfile[m]->valuesAt(x_cells, profile_values);
+        for (unsigned int c=0; c<cells.size(); c++) temperature[m].data_[cells[c]] = profile_values[c];
+        velocityProfile[m]->valuesAt(x_cells, profile_values);
+        for (unsigned int c=0; c<cells.size(); c++) velocity[m].data_[cells[c]] = profile_values[c];
+    }
     
     // defines npart_effective for the Species & create the corresponding particles
     // -----------------------------------------------------------------------
@@ -155,6 +155,25 @@ public:
     //! Method used to sort particles
     void sort_part();
     void count_sort_part(Params& param);
+    //! Method used to sort particles by cell, in place, moving only the particles which changed cell
+    void cell_sort_part(Params& param);
+    //! Method used to sort particles according to sort_mode
+    void sort_particles(Params& param);
+    
+    //! Particles sorting mode, possible values: "bin" (by clrw-wide bins), "cell" (incremental in-place sort by cell)
+    //! or "count" (by cell, counting sort in a copy of the particles)
+    std::string sort_mode;
+    
+    //! Method used to merge macro-particles sharing a cell and a momentum-space cell
+    void mergeParticles(Params& param);
+    //! Number of timesteps between two merging operations (0 : no merging)
+    int merge_every;
+    //! Minimum number of particles in a cell for merging to happen in this cell
+    unsigned int merge_min_particles_per_cell;
+    //! Minimum and maximum number of particles merged at once into two particles
+    unsigned int merge_min_packet_size, merge_max_packet_size;
+    //! Number of momentum-space cells in |p|, azimuthal angle and elevation angle
+    std::vector<unsigned int> merge_momentum_cell_size;
 
     void updateMvWinLimits(double x_moved);
 
@@ -175,6 +194,8 @@ public:
     
     //! Cluster width in number of cells
     unsigned int clrw; //Should divide the number of cells in X of a single MPI domain. 
+    //! Number of particles of a bin processed at once by dynamics (0 : whole bin, stage by stage)
+    unsigned int dynamics_block_size;
     //! first and last index of each particle bin
     std::vector<int> bmin, bmax;
     //! sub dimensions of buffers for dim > 1
@@ -214,10 +235,12 @@ public:
     double getLostNrjMW() const {return mass*nrj_mw_lost;}
     
     double getNewParticlesNRJ() const {return mass*nrj_new_particles;}
+    double getNbrOfMergedParticles() const {return n_merged;}
     void reinitDiags() { 
         nrj_bc_lost = 0;
         nrj_mw_lost = 0;
         nrj_new_particles = 0;
+        n_merged = 0;
     }
     inline void storeNRJlost( double nrj ) { nrj_mw_lost = nrj; };
     
@@ -229,7 +252,7 @@ public:
     }
     
     inline int getMemFootPrint() {
-        int speciesSize  = ( 2*nDim_particle + 3 + 1 )*sizeof(double) + sizeof(short);
+        int speciesSize  = nDim_particle*sizeof(double) + ( 3 + 1 )*sizeof(particle_real) + sizeof(short);
         if ( particles->isTest )
             speciesSize += sizeof ( unsigned int );
         //speciesSize *= getNbrOfParticles();
@@ -240,6 +263,9 @@ public:
     //! Method to create new particles.
     int  createParticles(std::vector<unsigned int> n_space_to_create, Params& params, Patch * patch, int new_bin_idx);
     
+    //! Method to insert new particles (e.g. created by ionization) in their bins, in a single pass
+    void importParticles(Particles& new_particles, Patch* patch);
+    
     //! 2 times pi
     double PI2;
     double dx_inv_, dy_inv_;
@@ -288,6 +314,21 @@ private:
     double nrj_mw_lost;
     //! Accumulate nrj added with new particles
     double nrj_new_particles;
+    //! Accumulate the number of particles removed by merging
+    double n_merged;
+    
+    //! Cell of each particle (buffer of cell_sort_part)
+    std::vector<int> cell_of_part;
+    
+    //! Cell of a particle, in the numbering of count_sort_part and cell_sort_part (y first)
+    inline int cellIndex(unsigned int iPart, Params& params) {
+        int ix = floor( ((*particles).position(0,iPart)-min_loc) * dx_inv_ );
+        ix = std::max( 0, std::min( ix, (int)params.n_space[0]-1 ) );
+        if (nDim_particle==1) return ix;
+        int iy = floor( ((*particles).position(1,iPart)-min_loc_vec[1]) * dy_inv_ );
+        iy = std::max( 0, std::min( iy, (int)params.n_space[1]-1 ) );
+        return iy + ix*params.n_space[1];
+    }
 };
 
 #endif
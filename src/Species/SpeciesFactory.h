@@ -73,6 +73,11 @@ public:
         
         PyTools::extract("c_part_max",thisSpecies->c_part_max,"Species",ispec);
         
+        PyTools::extract("sort_mode",thisSpecies->sort_mode,"Species",ispec);
+        if ( (thisSpecies->sort_mode!="bin") && (thisSpecies->sort_mode!="cell") && (thisSpecies->sort_mode!="count") ) {
+            ERROR("For species '" << species_type << "' unknown sort_mode: " << thisSpecies->sort_mode);
+        }
+        
         if( !PyTools::extract("mass",thisSpecies->mass ,"Species",ispec) ) {
             ERROR("For species '" << species_type << "' mass not defined.");
         }
@@ -240,6 +245,35 @@ public:
         TimeSelection track_timeSelection( PyTools::extract_py("track_every", "Species", ispec), "Track" );
         thisSpecies->particles->tracked = ! track_timeSelection.isEmpty();
         
+        // Extract the merging parameters
+        PyTools::extract("merge_every",thisSpecies->merge_every,"Species",ispec);
+        if (thisSpecies->merge_every < 0) {
+            ERROR("For species '" << species_type << "' merge_every must be positive or zero");
+        }
+        if (thisSpecies->merge_every > 0) {
+            if (thisSpecies->particles->isTest || thisSpecies->particles->tracked) {
+                ERROR("For species '" << species_type << "' merging is not possible for test or tracked particles");
+            }
+            PyTools::extract("merge_min_particles_per_cell",thisSpecies->merge_min_particles_per_cell,"Species",ispec);
+            PyTools::extract("merge_min_packet_size",thisSpecies->merge_min_packet_size,"Species",ispec);
+            PyTools::extract("merge_max_packet_size",thisSpecies->merge_max_packet_size,"Species",ispec);
+            if (thisSpecies->merge_min_packet_size < 3) {
+                ERROR("For species '" << species_type << "' merge_min_packet_size must be at least 3");
+            }
+            if (thisSpecies->merge_max_packet_size < thisSpecies->merge_min_packet_size) {
+                ERROR("For species '" << species_type << "' merge_max_packet_size must be at least merge_min_packet_size");
+            }
+            PyTools::extract("merge_momentum_cell_size",thisSpecies->merge_momentum_cell_size,"Species",ispec);
+            if (thisSpecies->merge_momentum_cell_size.size()!=3) {
+                ERROR("For species '" << species_type << "' merge_momentum_cell_size must be a list of 3 integers");
+            }
+            for (unsigned int i=0; i<3; i++) {
+                if (thisSpecies->merge_momentum_cell_size[i]==0) {
+                    ERROR("For species '" << species_type << "' merge_momentum_cell_size must be strictly positive");
+                }
+            }
+        }
+        
         // Create the particles
         if (!params.restart) {
             // does a loop over all cells in the simulation
@@ -270,6 +304,12 @@ public:
         newSpecies->initPosition_type     = species->initPosition_type;
         newSpecies->initMomentum_type     = species->initMomentum_type;
         newSpecies->c_part_max            = species->c_part_max;
+        newSpecies->sort_mode             = species->sort_mode;
+        newSpecies->merge_every                  = species->merge_every;
+        newSpecies->merge_min_particles_per_cell = species->merge_min_particles_per_cell;
+        newSpecies->merge_min_packet_size        = species->merge_min_packet_size;
+        newSpecies->merge_max_packet_size        = species->merge_max_packet_size;
+        newSpecies->merge_momentum_cell_size     = species->merge_momentum_cell_size;
         newSpecies->mass                  = species->mass;
         newSpecies->time_frozen           = species->time_frozen;
         newSpecies->radiating             = species->radiating;
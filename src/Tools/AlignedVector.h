@@ -0,0 +1,107 @@
+// -------------------------------------------------------------------------------------
+// Aligned storage helpers : allocator, vector type with padded capacity and array views
+// -------------------------------------------------------------------------------------
+
+#ifndef ALIGNEDVECTOR_H
+#define ALIGNEDVECTOR_H
+
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+//! Alignment (in bytes) of all the arrays allocated by AlignedAllocator : one cache line, also the width of AVX-512 registers
+#define SMILEI_ALIGNMENT 64
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class AlignedAllocator : STL allocator returning memory aligned on SMILEI_ALIGNMENT bytes
+//  --------------------------------------------------------------------------------------------------------------------
+template<class T>
+class AlignedAllocator {
+public:
+    typedef T              value_type;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef std::size_t    size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template<class U> struct rebind { typedef AlignedAllocator<U> other; };
+
+    AlignedAllocator() {}
+    AlignedAllocator(const AlignedAllocator&) {}
+    template<class U> AlignedAllocator(const AlignedAllocator<U>&) {}
+    ~AlignedAllocator() {}
+
+    pointer       address(reference x)       const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+
+    //! Allocate n elements, rounded up to a whole number of cache lines
+    pointer allocate(size_type n, const void* = 0) {
+        if (n==0) return NULL;
+        void* p(NULL);
+        if ( posix_memalign( &p, SMILEI_ALIGNMENT, padded_size(n)*sizeof(T) ) )
+            throw std::bad_alloc();
+        return static_cast<pointer>(p);
+    }
+    void deallocate(pointer p, size_type) {
+        free(p);
+    }
+
+    size_type max_size() const {
+        return size_type(-1) / sizeof(T);
+    }
+
+    void construct(pointer p, const T& val) { new((void*)p) T(val); }
+    void destroy(pointer p) { p->~T(); }
+
+    //! Number of elements of type T filling a whole number of cache lines
+    static size_type padded_size(size_type n) {
+        const size_type lane = SMILEI_ALIGNMENT/sizeof(T) > 0 ? SMILEI_ALIGNMENT/sizeof(T) : 1;
+        return ( (n+lane-1)/lane ) * lane;
+    }
+};
+
+template<class T, class U>
+inline bool operator==(const AlignedAllocator<T>&, const AlignedAllocator<U>&) { return true;  }
+template<class T, class U>
+inline bool operator!=(const AlignedAllocator<T>&, const AlignedAllocator<U>&) { return false; }
+
+
+//! std::vector whose data is aligned on SMILEI_ALIGNMENT bytes
+template<class T>
+using AlignedVector = std::vector<T, AlignedAllocator<T> >;
+
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class ArrayView : non-owning view (pointer + size) on a contiguous array
+//!   ArrayView<const T> is a read-only view, ArrayView<T> allows modifications of the elements.
+//!   The view is invalidated by any operation which reallocates the underlying array (push_back, insert ...)
+//  --------------------------------------------------------------------------------------------------------------------
+template<class T>
+class ArrayView {
+public:
+    typedef T            value_type;
+    typedef T*           iterator;
+    typedef std::size_t  size_type;
+
+    ArrayView() : data_(NULL), size_(0) {}
+    ArrayView(T* data, size_type size) : data_(data), size_(size) {}
+    template<class V>
+    ArrayView(V& v) : data_(v.data()), size_(v.size()) {}
+
+    inline T& operator[](size_type i) const { return data_[i]; }
+    inline T* data()  const { return data_; }
+    inline T* begin() const { return data_; }
+    inline T* end()   const { return data_+size_; }
+    inline size_type size() const { return size_; }
+    inline bool empty() const { return size_==0; }
+
+private:
+    T* data_;
+    size_type size_;
+};
+
+#endif
@@ -8,6 +8,9 @@
 
 #include <hdf5.h>
 #include <string>
+#include <vector>
+
+#include "AlignedVector.h"
 
 //! HDF5 help functions
 class H5 {
@@ -151,6 +154,26 @@ class H5 {
         vect(locationId, name, v[0], v.size(), H5T_NATIVE_DOUBLE, deflate);
     }
     
+    //! write an aligned vector<unsigned int> (no copy)
+    static void vect(hid_t locationId, std::string name, AlignedVector<unsigned int>& v, int deflate=0) {
+        vect(locationId, name, *v.data(), v.size(), H5T_NATIVE_UINT, deflate);
+    }
+    
+    //! write an aligned vector<short> (no copy)
+    static void vect(hid_t locationId, std::string name, AlignedVector<short>& v, int deflate=0) {
+        vect(locationId, name, *v.data(), v.size(), H5T_NATIVE_SHORT, deflate);
+    }
+    
+    //! write an aligned vector<double> (no copy)
+    static void vect(hid_t locationId, std::string name, AlignedVector<double>& v, int deflate=0) {
+        vect(locationId, name, *v.data(), v.size(), H5T_NATIVE_DOUBLE, deflate);
+    }
+    
+    //! write an aligned vector<float> (no copy)
+    static void vect(hid_t locationId, std::string name, AlignedVector<float>& v, int deflate=0) {
+        vect(locationId, name, *v.data(), v.size(), H5T_NATIVE_FLOAT, deflate);
+    }
+    
     
     //! write any vector
     //! type is the h5 type (H5T_NATIVE_DOUBLE, H5T_NATIVE_INT, etc.)
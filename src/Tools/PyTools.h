@@ -21,6 +21,7 @@
 #include <Python.h>
 #include <vector>
 #include <sstream>
+#include <cstring>
 #include "Tools.h"
 
 //! tools to query python nemlist and get back C++ values and vectors
@@ -259,6 +260,65 @@ public:
         Py_XDECREF(pyresult);
         return retval;
     }
+
+    //! run python function once with numpy arrays as arguments: the first nx arrays of x,
+    //! followed by the scalar time if withTime. The result, an array of n values, is stored in result.
+    //! Returns false, clearing the python error, if numpy is missing, if the function cannot handle arrays
+    //! or if it does not return one value per point (e.g. a scalar from a function ignoring its coordinates)
+    static bool runPyFunctionOnArrays(PyObject *pyFunction, std::vector<std::vector<double> > &x, unsigned int nx,
+                                      std::vector<double> &result, bool withTime=false, double time=0.) {
+        unsigned int n = x[0].size();
+        PyObject* numpy = PyImport_ImportModule("numpy");
+        if (!numpy) {
+            PyErr_Clear();
+            return false;
+        }
+
+        // Copy the coordinates in new numpy arrays
+        bool ok = true;
+        PyObject* args = PyTuple_New(nx + (withTime?1:0));
+        for (unsigned int ix=0; ix<nx; ix++) {
+            PyObject* array = PyObject_CallMethod(numpy, const_cast<char *>("empty"), const_cast<char *>("I"), n);
+            Py_buffer view;
+            if (array && PyObject_GetBuffer(array, &view, PyBUF_WRITABLE)==0) {
+                memcpy(view.buf, &x[ix][0], n*sizeof(double));
+                PyBuffer_Release(&view);
+            } else {
+                ok = false;
+            }
+            if (!array) {
+                Py_INCREF(Py_None);
+                array = Py_None;
+            }
+            PyTuple_SetItem(args, ix, array);
+        }
+        if (withTime) PyTuple_SetItem(args, nx, PyFloat_FromDouble(time));
+
+        // Call the function, then make sure that the result is a contiguous 1D array of n doubles
+        // (not broadcast : each point must get its own value, as when calling the function point by point)
+        PyObject* pyresult = ok ? PyObject_CallObject(pyFunction, args) : NULL;
+        PyObject* array = NULL;
+        if (pyresult)
+            array = PyObject_CallMethod(numpy, const_cast<char *>("ascontiguousarray"), const_cast<char *>("Os"), pyresult, "float64");
+        ok = false;
+        if (array) {
+            Py_buffer view;
+            if (PyObject_GetBuffer(array, &view, PyBUF_C_CONTIGUOUS)==0) {
+                if (view.ndim == 1 && view.len == (Py_ssize_t)(n*sizeof(double))) {
+                    result.resize(n);
+                    memcpy(&result[0], view.buf, n*sizeof(double));
+                    ok = true;
+                }
+                PyBuffer_Release(&view);
+            }
+        }
+        if (!ok) PyErr_Clear();
+        Py_XDECREF(array);
+        Py_XDECREF(pyresult);
+        Py_DECREF(args);
+        Py_DECREF(numpy);
+        return ok;
+    }
     
     //! get T from python
     template< typename T>
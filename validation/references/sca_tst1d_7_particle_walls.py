@@ -0,0 +1,190 @@
+# 1 time
+# 2 Utot
+# 3 Uexp
+# 4 Ubal
+# 5 Ubal_norm
+# 6 Uelm
+# 7 Ukin
+# 8 Uelm_bnd
+# 9 Ukin_bnd
+# 10 Uelm_inj_mvw
+# 11 Uelm_out_mvw
+# 12 Ukin_inj_mvw
+# 13 Ukin_out_mvw
+# 14 Ntot_ion
+# 15 Zavg_ion
+# 16 Ukin_ion
+# 17 Ntot_eon
+# 18 Zavg_eon
+# 19 Ukin_eon
+# 20 Uelm_Ex
+# 21 Uelm_Ey
+# 22 Uelm_Ez
+# 23 Uelm_Bx_m
+# 24 Uelm_By_m
+# 25 Uelm_Bz_m
+# 26 ExMin
+# 27 ExMinCell
+# 28 ExMax
+# 29 ExMaxCell
+# 30 EyMin
+# 31 EyMinCell
+# 32 EyMax
+# 33 EyMaxCell
+# 34 EzMin
+# 35 EzMinCell
+# 36 EzMax
+# 37 EzMaxCell
+# 38 Bx_mMin
+# 39 Bx_mMinCell
+# 40 Bx_mMax
+# 41 Bx_mMaxCell
+# 42 By_mMin
+# 43 By_mMinCell
+# 44 By_mMax
+# 45 By_mMaxCell
+# 46 Bz_mMin
+# 47 Bz_mMinCell
+# 48 Bz_mMax
+# 49 Bz_mMaxCell
+# 50 JxMin
+# 51 JxMinCell
+# 52 JxMax
+# 53 JxMaxCell
+# 54 JyMin
+# 55 JyMinCell
+# 56 JyMax
+# 57 JyMaxCell
+# 58 JzMin
+# 59 JzMinCell
+# 60 JzMax
+# 61 JzMaxCell
+# 62 RhoMin
+# 63 RhoMinCell
+# 64 RhoMax
+# 65 RhoMaxCell
+# 66 PoyEast
+# 67 PoyEastInst
+# 68 PoyWest
+# 69 PoyWestInst
+#
+#               time                Utot                Uexp                Ubal           Ubal_norm                Uelm                Ukin            Uelm_bnd            Ukin_bnd        Uelm_inj_mvw        Uelm_out_mvw        Ukin_inj_mvw        Ukin_out_mvw            Ntot_ion            Zavg_ion            Ukin_ion            Ntot_eon            Zavg_eon            Ukin_eon             Uelm_Ex             Uelm_Ey             Uelm_Ez           Uelm_Bx_m           Uelm_By_m           Uelm_Bz_m               ExMin           ExMinCell               ExMax           ExMaxCell               EyMin           EyMinCell               EyMax           EyMaxCell               EzMin           EzMinCell               EzMax           EzMaxCell             Bx_mMin         Bx_mMinCell             Bx_mMax         Bx_mMaxCell             By_mMin         By_mMinCell             By_mMax         By_mMaxCell             Bz_mMin         Bz_mMinCell             Bz_mMax         Bz_mMaxCell               JxMin           JxMinCell               JxMax           JxMaxCell               JyMin           JyMinCell               JyMax           JyMaxCell               JzMin           JzMinCell               JzMax           JzMaxCell              RhoMin          RhoMinCell              RhoMax          RhoMaxCell             PoyEast         PoyEastInst             PoyWest         PoyWestInst
+    0.0000000000e+00    4.6454316785e-03    9.2907684775e-03   -4.6453367990e-03   -9.9997957574e-01    9.4879504686e-08    4.6453367990e-03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.6453367990e-03    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942989471e-03    1.9800000000e+03   -8.0000000000e+00    2.3510378519e-03    9.4879504686e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.4621434675e-03    1.2500000000e+02    7.4573742029e-03    1.1300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.5484074510e-02    1.4800000000e+02    6.2259163087e-02    1.3000000000e+02   -5.7233691090e-02    1.3900000000e+02    6.1256784162e-02    1.6200000000e+02   -6.5694008806e-02    1.1400000000e+02    6.3627090979e-02    1.2700000000e+02   -2.0610864672e+00    1.2700000000e+02    2.2255472143e+00    1.1700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    4.2025525744e-01    4.6454575507e-03    4.6454315572e-03    2.5993450957e-08    5.5954866535e-06    1.1006534055e-06    4.6443568973e-03   -1.2126134707e-10    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942906257e-03    1.9800000000e+03   -8.0000000000e+00    2.3500662716e-03    1.0943367290e-06    1.8693357487e-10    1.3780695201e-10    0.0000000000e+00    2.8787901609e-09    3.1131457906e-09   -2.1721234013e-02    1.5400000000e+02    2.4356970536e-02    1.2100000000e+02   -2.4685475095e-04    1.0100000000e+02    1.5703907449e-04    1.5000000000e+02   -2.1024650806e-04    1.7000000000e+02    2.7208940138e-04    1.3200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1102527417e-03    1.1000000000e+02    9.2708330925e-04    1.3600000000e+02   -9.9836627518e-04    1.2900000000e+02    9.6716401908e-04    1.4100000000e+02   -1.7675451890e-01    1.3400000000e+02    1.4114850664e-01    1.0200000000e+02   -1.2425418416e-01    1.1800000000e+02    1.3759124096e-01    1.7100000000e+02   -1.4483821007e-01    1.4300000000e+02    1.4375483057e-01    1.6600000000e+02   -4.2042796380e+00    1.3400000000e+02    3.5114645724e+00    7.9000000000e+01   -5.5021192542e-11   -3.7145143642e-13   -6.6240154526e-11    1.1535979020e-12
+    8.4051051489e-01    4.6454541303e-03    4.6454313333e-03    2.2796957723e-08    4.9073927463e-06    1.9022007780e-06    4.6435519295e-03   -3.4515878529e-10    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942802636e-03    1.9800000000e+03   -8.0000000000e+00    2.3492716659e-03    1.8904385006e-06    1.4988442650e-10    1.2610820109e-10    0.0000000000e+00    6.2541925227e-09    5.2320922255e-09   -2.6830606561e-02    1.4900000000e+02    2.6478917611e-02    8.8000000000e+01   -2.2852562649e-04    1.2500000000e+02    9.0535736530e-05    1.5100000000e+02   -1.4213458346e-04    1.3000000000e+02    1.9003786023e-04    1.5300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.2399550262e-03    1.0900000000e+02    1.3621280763e-03    1.3300000000e+02   -1.1963991186e-03    1.4000000000e+02    1.0691152895e-03    1.4700000000e+02   -1.5921517900e-01    1.5800000000e+02    1.6678156015e-01    1.4600000000e+02   -1.2994078811e-01    1.4500000000e+02    1.3431094838e-01    1.2900000000e+02   -1.2562248759e-01    1.1800000000e+02    1.4585307739e-01    1.3200000000e+02   -4.0304013987e+00    1.0900000000e+02    4.1781602634e+00    1.0900000000e+02   -1.3614177969e-10    4.4992336859e-14   -2.0901700561e-10    5.3305946575e-14
+    1.2607657723e+00    4.6454550595e-03    4.6454309417e-03    2.4117775822e-08    5.1917189813e-06    2.9232720708e-06    4.6425317874e-03   -7.3675641928e-10    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941845103e-03    1.9800000000e+03   -8.0000000000e+00    2.3483472771e-03    2.9051972444e-06    8.4634564382e-11    1.5690596623e-10    0.0000000000e+00    1.0609642514e-08    7.2236433416e-09   -3.0710426519e-02    1.2800000000e+02    3.1399490917e-02    9.0000000000e+01   -1.6843766065e-04    1.3200000000e+02    6.7613198617e-05    1.0900000000e+02   -1.6044637327e-04    1.0700000000e+02    1.3140435637e-04    1.2200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1305646683e-03    1.4000000000e+02    1.5685825860e-03    1.1600000000e+02   -1.2204290315e-03    1.4300000000e+02    1.1474487476e-03    1.3800000000e+02   -1.5959723271e-01    1.3200000000e+02    1.5870747926e-01    1.3400000000e+02   -1.4713896975e-01    1.2100000000e+02    1.5309130389e-01    1.2800000000e+02   -1.3966961269e-01    1.3700000000e+02    1.3302700556e-01    1.2400000000e+02   -4.3150708553e+00    1.4800000000e+02    4.8496173088e+00    1.4000000000e+02   -2.1163576295e-10   -9.0006915679e-13   -5.2512065634e-10    3.0543249289e-12
+    1.6810210298e+00    4.6454620761e-03    4.6454305265e-03    3.1549576071e-08    6.7915273013e-06    2.8732859899e-06    4.6425887901e-03   -1.1519767580e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2938407115e-03    1.9800000000e+03   -8.0000000000e+00    2.3487480786e-03    2.8458684243e-06    7.7586789575e-11    1.3970075128e-10    0.0000000000e+00    1.8240931544e-08    8.9593465115e-09   -3.3428947030e-02    1.0500000000e+02    2.8332687089e-02    1.0200000000e+02   -1.2967946894e-04    1.3200000000e+02    7.6856546918e-05    1.3500000000e+02   -1.4418022993e-04    1.3000000000e+02    7.4824581358e-05    1.6800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1345490493e-03    1.3100000000e+02    1.9916242712e-03    1.5000000000e+02   -1.3297010661e-03    1.0700000000e+02    9.9534606920e-04    1.0900000000e+02   -1.7198269779e-01    1.4500000000e+02    1.6495342824e-01    1.2600000000e+02   -1.6538781354e-01    1.6900000000e+02    1.4983307035e-01    1.0100000000e+02   -1.6008262320e-01    1.3100000000e+02    1.5414745851e-01    1.3900000000e+02   -5.1619454340e+00    1.3200000000e+02    4.6337915439e+00    9.6000000000e+01   -3.1553516448e-10   -1.8796129483e-12   -8.3644159347e-10    2.3089174186e-12
+    2.1012762872e+00    4.6454791438e-03    4.6454299179e-03    4.9225901730e-08    1.0596625919e-05    4.9681433309e-06    4.6405110005e-03   -1.7606123244e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2935233871e-03    1.9800000000e+03   -8.0000000000e+00    2.3469876134e-03    4.9334023709e-06    9.2256790545e-11    1.3372320936e-10    0.0000000000e+00    2.3171247672e-08    1.1343732316e-08   -5.1291352306e-02    1.2900000000e+02    2.6443662224e-02    1.2100000000e+02   -7.4344234002e-05    1.2900000000e+02    1.3864533250e-04    1.1700000000e+02   -1.4411875463e-04    1.2300000000e+02    1.1072846104e-04    1.6900000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.9716950121e-04    6.6000000000e+01    2.1952879330e-03    1.3100000000e+02   -1.2953594930e-03    1.0600000000e+02    1.1815396026e-03    1.1100000000e+02   -1.4011869966e-01    1.0600000000e+02    1.7491063682e-01    1.4700000000e+02   -1.5971959130e-01    1.5600000000e+02    1.5133686245e-01    1.0800000000e+02   -1.5412169500e-01    1.6500000000e+02    1.5429482321e-01    1.0600000000e+02   -5.3809670321e+00    1.4100000000e+02    5.3544688933e+00    1.5800000000e+02   -5.7360438306e-10   -3.2610604799e-12   -1.1870079414e-09    3.3430525093e-12
+    2.5215315447e+00    4.6454572680e-03    4.6454293213e-03    2.7946699593e-08    6.0159532045e-06    5.6810141163e-06    4.6397762539e-03   -2.3571596848e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2933316097e-03    1.9800000000e+03   -8.0000000000e+00    2.3464446442e-03    5.6395948608e-06    1.2645680572e-10    9.5352271079e-11    0.0000000000e+00    2.7508691149e-08    1.3688755298e-08   -5.2550276238e-02    1.1900000000e+02    2.9385819671e-02    1.2100000000e+02   -7.3047726445e-05    1.6000000000e+02    1.5622748526e-04    1.0200000000e+02   -9.2933463443e-05    1.2500000000e+02    1.2551972605e-04    1.1900000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.4789702166e-04    1.3800000000e+02    2.2681616342e-03    1.2500000000e+02   -1.0590788055e-03    1.1100000000e+02    1.6136105953e-03    1.2300000000e+02   -1.5688559218e-01    1.2300000000e+02    1.5869350843e-01    1.4200000000e+02   -1.4544042979e-01    1.7000000000e+02    1.5369577270e-01    9.2000000000e+01   -1.3914054434e-01    1.5900000000e+02    1.3329417149e-01    1.4900000000e+02   -4.5397405011e+00    1.4300000000e+02    4.6178201840e+00    1.0800000000e+02   -8.4850304632e-10   -2.7763458834e-12   -1.5086566385e-09    2.9715825508e-12
+    2.9417868021e+00    4.6454611042e-03    4.6454287057e-03    3.2398506365e-08    6.9742724911e-06    4.1998948808e-06    4.6412612094e-03   -2.9727661545e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2932181849e-03    1.9800000000e+03   -8.0000000000e+00    2.3480430244e-03    4.1518932935e-06    1.4484786517e-10    1.3938181356e-10    0.0000000000e+00    3.0240856929e-08    1.7476500662e-08   -4.3615033943e-02    1.1400000000e+02    3.0240135403e-02    1.2700000000e+02   -1.0354188256e-04    1.7500000000e+02    1.0196000873e-04    1.1400000000e+02   -1.4542329111e-04    1.0000000000e+02    7.6746530932e-05    1.6200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.5087570038e-04    1.1300000000e+02    2.6479926242e-03    1.3500000000e+02   -1.1729838261e-03    1.3800000000e+02    1.9909995778e-03    1.3400000000e+02   -1.8611911903e-01    1.7400000000e+02    1.7035670188e-01    1.2500000000e+02   -1.4429659715e-01    1.5900000000e+02    1.3796036860e-01    1.1900000000e+02   -1.6444741022e-01    1.3500000000e+02    1.4948149841e-01    1.2000000000e+02   -4.6018931950e+00    1.1800000000e+02    5.0937950634e+00    1.2200000000e+02   -1.1840187054e-09   -4.7872560575e-12   -1.7887474491e-09    2.2438577819e-12
+    3.3620420595e+00    4.6454639587e-03    4.6454278970e-03    3.6061710406e-08    7.7628330157e-06    4.3620279079e-06    4.6411019308e-03   -3.7815325180e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2934174918e-03    1.9800000000e+03   -8.0000000000e+00    2.3476844389e-03    4.3074745983e-06    1.8676926735e-10    1.4377180677e-10    0.0000000000e+00    3.2639708441e-08    2.1583060083e-08   -4.0244736563e-02    1.3600000000e+02    3.1244812460e-02    1.4500000000e+02   -9.8117531335e-05    1.6300000000e+02    8.3501999343e-05    9.1000000000e+01   -1.9277485857e-04    1.0700000000e+02    4.4674965419e-05    1.7300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.8052452210e-04    1.2700000000e+02    2.6411249771e-03    1.5700000000e+02   -1.4550515796e-03    1.0500000000e+02    2.4584853965e-03    1.1800000000e+02   -1.6740381916e-01    1.4700000000e+02    1.5265056233e-01    1.4000000000e+02   -1.5309346207e-01    1.4900000000e+02    1.4398226078e-01    1.3700000000e+02   -1.4903882389e-01    1.2400000000e+02    1.4443051002e-01    1.3300000000e+02   -4.6098462777e+00    1.3600000000e+02    4.4346388520e+00    9.9000000000e+01   -1.6305218246e-09   -3.7981933314e-12   -2.1510106934e-09    3.0872188166e-12
+    3.7822973170e+00    4.6454518362e-03    4.6454273152e-03    2.4521064889e-08    5.2785331021e-06    3.6370184550e-06    4.6418148178e-03   -4.3633093751e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2938698818e-03    1.9800000000e+03   -8.0000000000e+00    2.3479449360e-03    3.5783590402e-06    2.4804151204e-10    9.1791990820e-11    0.0000000000e+00    3.4432718523e-08    2.3886862744e-08   -4.1895229247e-02    1.2500000000e+02    3.0636160484e-02    1.3300000000e+02   -8.5688940682e-05    1.4900000000e+02    9.8639925024e-05    7.5000000000e+01   -1.4349649803e-04    1.2800000000e+02    3.1944932807e-05    1.0100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.0574193140e-04    1.5400000000e+02    2.6082849759e-03    1.5200000000e+02   -1.1942831674e-03    1.2400000000e+02    2.3298948120e-03    1.3700000000e+02   -1.8144749297e-01    1.3100000000e+02    1.6419839382e-01    1.6600000000e+02   -1.4809100943e-01    1.3400000000e+02    1.4841218640e-01    1.5800000000e+02   -1.6323154409e-01    1.6200000000e+02    1.4784389882e-01    1.1300000000e+02   -4.5104833291e+00    1.1300000000e+02    5.2307197325e+00    1.2600000000e+02   -1.9107933681e-09   -2.3279117185e-12   -2.4525160070e-09    3.6743358045e-12
+    4.2025525744e+00    4.6454544930e-03    4.6454266341e-03    2.7858900807e-08    5.9970531772e-06    2.6487754659e-06    4.6428057175e-03   -5.0444040536e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941188372e-03    1.9800000000e+03   -8.0000000000e+00    2.3486868804e-03    2.5900108037e-06    2.0484715217e-10    7.4008591839e-11    0.0000000000e+00    3.3536698103e-08    2.4949108338e-08   -3.1840610065e-02    1.1700000000e+02    2.5094516529e-02    1.0100000000e+02   -5.0902561884e-05    1.8100000000e+02    1.2209199453e-04    1.3200000000e+02   -9.2824224563e-05    1.4100000000e+02    8.3971920492e-05    1.5200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.7923759172e-04    1.3700000000e+02    2.3694064092e-03    1.3800000000e+02   -8.5040068246e-04    1.1600000000e+02    2.4537936712e-03    1.4900000000e+02   -1.8674339471e-01    1.3300000000e+02    1.5966011498e-01    1.6500000000e+02   -1.6240830367e-01    1.2100000000e+02    1.4467880425e-01    1.5800000000e+02   -1.3937869585e-01    1.3600000000e+02    1.3549822391e-01    1.2700000000e+02   -4.9542436791e+00    1.0000000000e+02    4.4013729831e+00    1.3900000000e+02   -2.1997676382e-09   -3.5240118295e-12   -2.8446364154e-09    4.0521964939e-12
+    4.6228078319e+00    4.6454668825e-03    4.6454259729e-03    4.0909538423e-08    8.8064019135e-06    3.6359723860e-06    4.6418309101e-03   -5.7055769278e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942167762e-03    1.9800000000e+03   -8.0000000000e+00    2.3476141338e-03    3.5795882771e-06    1.7232640562e-10    6.1192386919e-11    0.0000000000e+00    3.0854745330e-08    2.5295844760e-08   -3.2851277588e-02    1.4500000000e+02    3.6356090695e-02    1.6300000000e+02   -3.9543204109e-05    1.6500000000e+02    1.4084727021e-04    1.1400000000e+02   -6.4736944708e-05    1.8000000000e+02    1.2326686841e-04    9.1000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.8843380175e-04    1.2900000000e+02    2.1893587383e-03    1.4000000000e+02   -4.1811758445e-04    1.2500000000e+02    2.2608405759e-03    1.4800000000e+02   -1.6562009809e-01    1.4600000000e+02    1.9461563208e-01    1.5600000000e+02   -1.4322194147e-01    1.3400000000e+02    1.4305187646e-01    1.2300000000e+02   -1.6127568129e-01    1.2600000000e+02    1.4521401956e-01    1.4400000000e+02   -4.9070273243e+00    9.6000000000e+01    4.7841336955e+00    1.2800000000e+02   -2.5390369902e-09   -4.6812511562e-12   -3.1665399377e-09    2.5172951849e-12
+    5.0430630893e+00    4.6454559528e-03    4.6454251579e-03    3.0794835600e-08    6.6290579070e-06    4.1134494726e-06    4.6413425033e-03   -6.5205442074e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2943208107e-03    1.9800000000e+03   -8.0000000000e+00    2.3470216926e-03    4.0611270765e-06    1.9158744289e-10    1.1806116804e-10    0.0000000000e+00    2.6533170296e-08    2.5479577227e-08   -3.2688293854e-02    1.7800000000e+02    3.1294203779e-02    1.5700000000e+02   -8.1265329307e-05    1.6800000000e+02    1.2119769775e-04    6.9000000000e+01   -3.7344946863e-05    1.4100000000e+02    1.7062160691e-04    1.1100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.4924213416e-04    1.1500000000e+02    1.8881666088e-03    1.7700000000e+02   -1.0768911052e-04    1.5700000000e+02    2.5368685179e-03    1.3600000000e+02   -1.4060764479e-01    1.4300000000e+02    1.8422905726e-01    1.7500000000e+02   -1.3545234745e-01    1.0100000000e+02    1.3988729273e-01    1.1700000000e+02   -1.5922809286e-01    1.5600000000e+02    1.5187706345e-01    1.3700000000e+02   -4.8300371546e+00    1.4300000000e+02    4.3002477147e+00    1.6100000000e+02   -3.0412846573e-09   -6.6803437152e-12   -3.4792595500e-09    2.9617442682e-12
+    5.4633183468e+00    4.6454675956e-03    4.6454243533e-03    4.3242356409e-08    9.3085765548e-06    5.1360187499e-06    4.6403315769e-03   -7.3252388784e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942935426e-03    1.9800000000e+03   -8.0000000000e+00    2.3460380343e-03    5.0813057545e-06    2.2500919808e-10    1.4437190065e-10    0.0000000000e+00    2.4397428756e-08    2.9946185580e-08   -3.5061537459e-02    1.2500000000e+02    3.5180519261e-02    1.2800000000e+02   -6.2408219193e-05    1.7000000000e+02    1.1521305515e-04    1.0100000000e+02   -3.1033510541e-05    1.5600000000e+02    1.7990119689e-04    8.9000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.6880260499e-04    1.3200000000e+02    1.7885230134e-03    1.4900000000e+02   -1.0230530274e-06    1.3100000000e+02    2.6604157053e-03    1.1600000000e+02   -1.6359668738e-01    1.5600000000e+02    1.8144289819e-01    1.4000000000e+02   -1.5881963970e-01    1.0900000000e+02    1.5081797049e-01    1.3800000000e+02   -1.5472749696e-01    1.1900000000e+02    1.3467297772e-01    1.3300000000e+02   -5.1419941151e+00    1.1700000000e+02    5.1135401942e+00    1.4000000000e+02   -3.5364925956e-09   -3.3147602939e-12   -3.7887462828e-09    3.1663451482e-12
+    5.8835736042e+00    4.6454630423e-03    4.6454236582e-03    3.9384040940e-08    8.4780153204e-06    5.4215798713e-06    4.6400414624e-03   -8.0202696818e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942230636e-03    1.9800000000e+03   -8.0000000000e+00    2.3458183988e-03    5.3584562020e-06    1.9141989499e-10    1.3462928758e-10    0.0000000000e+00    2.5595549943e-08    3.7202070131e-08   -3.8544684294e-02    1.2000000000e+02    3.3982000606e-02    1.0700000000e+02   -7.1782264653e-05    1.7800000000e+02    1.0692465014e-04    1.1800000000e+02   -2.6177027423e-06    1.7400000000e+02    1.9570629026e-04    1.5400000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.7705614991e-04    1.3300000000e+02    2.0302229164e-03    1.1000000000e+02    5.6402078009e-05    1.2500000000e+02    3.0651104454e-03    1.0200000000e+02   -1.6567078839e-01    1.4800000000e+02    1.6919480658e-01    1.3900000000e+02   -1.7440349717e-01    1.4600000000e+02    1.4609164838e-01    1.3000000000e+02   -1.4165039662e-01    9.9000000000e+01    1.7119378843e-01    1.3700000000e+02   -4.8486530158e+00    1.7400000000e+02    4.3589306777e+00    1.1100000000e+02   -3.8869761860e-09   -2.8077812589e-12   -4.1332934959e-09    4.2277530562e-12
+    6.3038288617e+00    4.6454534851e-03    4.6454230974e-03    3.0387651917e-08    6.5414054108e-06    5.9344652644e-06    4.6395190198e-03   -8.5810591419e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942177625e-03    1.9800000000e+03   -8.0000000000e+00    2.3453012573e-03    5.8634306772e-06    1.2042120080e-10    1.0101007943e-10    0.0000000000e+00    2.6875507213e-08    4.3937648759e-08   -5.4248741224e-02    1.3300000000e+02    2.9404328961e-02    1.6400000000e+02   -6.0645303016e-05    1.5600000000e+02    9.9473723117e-05    1.1600000000e+02   -2.5641599616e-06    1.6000000000e+02    1.8159659401e-04    1.3200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0423883435e-03    1.6900000000e+02    2.1129130117e-03    1.0700000000e+02    1.9718419394e-04    1.6200000000e+02    3.7187134343e-03    1.1000000000e+02   -1.7165704126e-01    1.7900000000e+02    1.7892838352e-01    1.1400000000e+02   -1.8608518247e-01    1.7800000000e+02    1.4876136582e-01    1.2000000000e+02   -1.4275368252e-01    1.4000000000e+02    1.6020898371e-01    1.3100000000e+02   -4.2791459488e+00    1.3400000000e+02    5.0731614290e+00    1.0400000000e+02   -4.1472761686e-09   -1.8453236871e-12   -4.4337829733e-09    1.3213359964e-12
+    6.7240841191e+00    4.6454559226e-03    4.6454228521e-03    3.3070508294e-08    7.1189311527e-06    5.4508000479e-06    4.6400051225e-03   -8.8264210713e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941867114e-03    1.9800000000e+03   -8.0000000000e+00    2.3458184111e-03    5.3728478287e-06    1.6081906730e-10    6.0747294116e-11    0.0000000000e+00    2.8983372365e-08    4.8747280504e-08   -4.4732286407e-02    1.3400000000e+02    3.0146205005e-02    1.5100000000e+02   -9.8104027673e-05    1.8500000000e+02    1.0313466341e-04    1.1800000000e+02   -2.7525249941e-05    1.4200000000e+02    1.4346812113e-04    9.3000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.8173290687e-04    1.4100000000e+02    2.0785835970e-03    1.3600000000e+02    3.0206391679e-04    1.2300000000e+02    3.8033223932e-03    1.0800000000e+02   -1.9086784744e-01    1.3000000000e+02    1.6984150510e-01    1.3000000000e+02   -1.4820638399e-01    1.5400000000e+02    1.5286636367e-01    9.9000000000e+01   -1.3493992412e-01    1.3300000000e+02    1.5477058338e-01    1.0000000000e+02   -5.2283735355e+00    1.2000000000e+02    4.6251342184e+00    1.3400000000e+02   -4.3232805778e-09   -1.7481914812e-12   -4.5031404935e-09    7.3291096624e-13
+    7.1443393765e+00    4.6454513721e-03    4.6454226556e-03    2.8716510460e-08    6.1816667315e-06    3.8718037785e-06    4.6415795684e-03   -9.0228594937e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2940447536e-03    1.9800000000e+03   -8.0000000000e+00    2.3475348147e-03    3.7903593951e-06    7.0912591328e-11    4.0277478143e-11    0.0000000000e+00    2.9314037164e-08    5.2019156163e-08   -4.2886218258e-02    1.3100000000e+02    2.8173696210e-02    1.2900000000e+02   -9.2088319168e-05    1.4200000000e+02    3.7943854381e-05    8.5000000000e+01   -5.6122144793e-05    1.3700000000e+02    7.5174069288e-05    9.5000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1094483664e-03    1.0600000000e+02    2.0132552987e-03    1.3800000000e+02    2.9074118156e-04    1.3600000000e+02    3.6668601177e-03    1.2200000000e+02   -1.7202608602e-01    1.1100000000e+02    1.5831609130e-01    1.5100000000e+02   -1.4688905747e-01    1.3200000000e+02    1.6200107592e-01    1.0400000000e+02   -1.5299649804e-01    1.3400000000e+02    1.6533907044e-01    9.6000000000e+01   -4.7912813362e+00    1.3900000000e+02    3.7586646627e+00    1.2900000000e+02   -4.4502233809e-09   -6.7715350398e-13   -4.5726361128e-09    5.9542017716e-13
+    7.5645946340e+00    4.6454706681e-03    4.6454225180e-03    4.8150149732e-08    1.0365053899e-05    3.5012228594e-06    4.6419694453e-03   -9.1604971115e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2940306281e-03    1.9800000000e+03   -8.0000000000e+00    2.3479388172e-03    3.4204072133e-06    4.5995268653e-11    5.4575420346e-11    0.0000000000e+00    2.7059769510e-08    5.3655305909e-08   -4.1080041445e-02    1.4500000000e+02    3.2190550939e-02    1.3300000000e+02   -8.0517061280e-05    1.1500000000e+02    6.0532869919e-05    1.2600000000e+02   -1.0804770451e-04    1.5200000000e+02    5.0400289645e-05    1.1800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0162673153e-03    1.6400000000e+02    1.8223309371e-03    1.2300000000e+02   -2.5915771997e-05    1.4700000000e+02    3.6802001493e-03    1.1900000000e+02   -1.7384365652e-01    1.7400000000e+02    1.4733289632e-01    1.7300000000e+02   -1.5874941772e-01    1.2300000000e+02    1.7843243772e-01    1.1000000000e+02   -1.7504493921e-01    1.4900000000e+02    1.4273320718e-01    1.2000000000e+02   -5.5885538001e+00    1.3100000000e+02    4.5423826435e+00    1.3500000000e+02   -4.5170963435e-09   -7.7316291804e-13   -4.6434007680e-09    5.1581651336e-13
+    7.9848498914e+00    4.6454650493e-03    4.6454223969e-03    4.2652444166e-08    9.1815889497e-06    4.4208387854e-06    4.6410442105e-03   -9.2816402768e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941913606e-03    1.9800000000e+03   -8.0000000000e+00    2.3468528499e-03    4.3432978928e-06    4.5726252677e-11    3.6366109246e-11    0.0000000000e+00    2.3973168564e-08    5.3485631628e-08   -4.4356269863e-02    1.2200000000e+02    3.4719610999e-02    1.4400000000e+02   -8.2571128317e-05    1.3100000000e+02    7.9731823917e-05    9.8000000000e+01   -1.1289945503e-04    1.3700000000e+02    4.2624993654e-05    1.5700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.5811830227e-04    1.3800000000e+02    1.9027991412e-03    1.0300000000e+02    4.0756457146e-04    1.4100000000e+02    3.4715875462e-03    1.0900000000e+02   -1.5376582434e-01    1.0200000000e+02    1.6871030770e-01    1.1400000000e+02   -1.6774683556e-01    1.3800000000e+02    1.4586917190e-01    1.9000000000e+02   -1.8518621939e-01    1.2600000000e+02    1.2321760302e-01    1.4000000000e+02   -4.7007462206e+00    1.4100000000e+02    4.2676278321e+00    1.0800000000e+02   -4.5719453481e-09   -9.2045958185e-14   -4.7096949287e-09    7.9198608210e-13
+    8.4051051489e+00    4.6454656019e-03    4.6454222727e-03    4.3329155991e-08    9.3272614881e-06    3.8602496355e-06    4.6416053522e-03   -9.4057962588e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2943048485e-03    1.9800000000e+03   -8.0000000000e+00    2.3473005037e-03    3.7828632477e-06    4.7238732913e-11    6.9384333162e-11    0.0000000000e+00    2.0030056506e-08    5.7239708187e-08   -3.9959230995e-02    1.6800000000e+02    2.2778524864e-02    1.1700000000e+02   -1.0010568783e-04    1.2500000000e+02    5.8606948581e-05    9.7000000000e+01   -1.0491124989e-04    1.6300000000e+02    7.6414081081e-05    1.2000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1514458080e-03    1.1600000000e+02    1.7133829422e-03    1.1500000000e+02    3.2812028778e-04    1.4900000000e+02    3.5649326663e-03    1.2000000000e+02   -1.5766823160e-01    1.3200000000e+02    1.6676682038e-01    1.4400000000e+02   -1.7626788914e-01    1.5400000000e+02    1.5418554306e-01    1.4100000000e+02   -1.3806448336e-01    1.4300000000e+02    1.5468172731e-01    1.2000000000e+02   -4.4580255774e+00    1.5000000000e+02    4.7159179531e+00    1.3100000000e+02   -4.6106995494e-09   -6.3336188678e-13   -4.7950967094e-09    1.2300347878e-12
+    8.8253604063e+00    4.6454615214e-03    4.6454220246e-03    3.9496774835e-08    8.5022830102e-06    4.2499042842e-06    4.6412116171e-03   -9.6538923225e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942904282e-03    1.9800000000e+03   -8.0000000000e+00    2.3469211889e-03    4.1750265113e-06    3.4051020071e-11    6.2087136533e-11    0.0000000000e+00    1.6946659852e-08    5.7834974839e-08   -4.4836354443e-02    1.2200000000e+02    2.4145461624e-02    1.4200000000e+02   -6.1421542543e-05    1.3800000000e+02    8.2723979984e-05    1.5700000000e+02   -8.1042352908e-05    1.4900000000e+02    7.0336976822e-05    1.2600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.2492439112e-03    1.4100000000e+02    1.6808597786e-03    1.3100000000e+02    5.8472594906e-04    1.3400000000e+02    3.5338018283e-03    1.2700000000e+02   -1.6178324878e-01    1.5200000000e+02    1.5636910077e-01    1.2200000000e+02   -1.3597373586e-01    1.4800000000e+02    1.5784651831e-01    6.3000000000e+01   -1.4771134919e-01    1.4900000000e+02    1.6810420890e-01    1.1400000000e+02   -4.8368642747e+00    1.3700000000e+02    4.4490646009e+00    1.2300000000e+02   -4.7011230949e-09   -1.2380183870e-12   -4.9527692276e-09    1.1466550868e-12
+    9.2456156638e+00    4.6454726087e-03    4.6454217426e-03    5.0866161555e-08    1.0949716856e-05    4.5168146755e-06    4.6409557941e-03   -9.9359064216e-09    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2943120389e-03    1.9800000000e+03   -8.0000000000e+00    2.3466437551e-03    4.4436828154e-06    5.3668868219e-11    6.9971749834e-11    0.0000000000e+00    1.3728891603e-08    5.9279327858e-08   -4.4153617377e-02    1.4600000000e+02    2.2915989710e-02    1.2200000000e+02   -6.8137239888e-05    1.8500000000e+02    6.5312971938e-05    9.1000000000e+01   -7.8617743468e-05    1.3800000000e+02    6.9623474691e-05    9.8000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.4365824750e-03    1.5100000000e+02    1.2351430613e-03    1.4400000000e+02    7.8581223831e-04    1.2800000000e+02    3.4920199807e-03    1.0500000000e+02   -1.6999437251e-01    1.4900000000e+02    1.7315291566e-01    1.3500000000e+02   -1.5731877089e-01    1.0800000000e+02    1.5562655966e-01    1.0900000000e+02   -1.5017330729e-01    9.4000000000e+01    1.4011124781e-01    1.2700000000e+02   -5.0931223924e+00    1.6800000000e+02    4.8628883559e+00    1.4800000000e+02   -4.8530934513e-09   -1.5170489248e-12   -5.0828129703e-09    1.5644552727e-12
+    9.6658709212e+00    4.6454607325e-03    4.6454212975e-03    3.9435014730e-08    8.4889882059e-06    4.7584173652e-06    4.6407023151e-03   -1.0381014902e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941618818e-03    1.9800000000e+03   -8.0000000000e+00    2.3465404333e-03    4.6875458686e-06    9.5302073971e-11    8.0143101547e-11    0.0000000000e+00    1.1777496761e-08    5.8918554650e-08   -4.4715001162e-02    1.3400000000e+02    2.7526381791e-02    1.2700000000e+02   -1.3555995849e-04    1.5400000000e+02    5.7403701090e-05    9.2000000000e+01   -8.3254791315e-05    1.7300000000e+02    7.1505555912e-05    8.9000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.5959692073e-03    1.4000000000e+02    1.1379494408e-03    1.2400000000e+02    9.2902722499e-04    1.5300000000e+02    3.3468395303e-03    1.4700000000e+02   -1.6400800368e-01    1.1400000000e+02    1.6910059247e-01    1.5000000000e+02   -1.3201851149e-01    1.2000000000e+02    1.2841917048e-01    1.4100000000e+02   -1.7766119057e-01    1.4000000000e+02    1.4746484871e-01    1.3900000000e+02   -4.3350140599e+00    1.2500000000e+02    4.8719261984e+00    1.2000000000e+02   -5.1349161496e-09   -2.7204960946e-12   -5.2460987527e-09    1.6666545837e-12
+    1.0086126179e+01    4.6454642426e-03    4.6454208796e-03    4.3362981027e-08    9.3345428430e-06    4.9009314779e-06    4.6405633111e-03   -1.0798887196e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2938208580e-03    1.9800000000e+03   -8.0000000000e+00    2.3467424531e-03    4.8289661414e-06    9.4093412426e-11    1.0329344507e-10    0.0000000000e+00    1.1683002250e-08    6.0084947397e-08   -4.1169642436e-02    1.6400000000e+02    3.1346054251e-02    1.1200000000e+02   -1.3737760945e-04    1.5000000000e+02    3.9914394591e-05    1.1900000000e+02   -7.4710324685e-05    1.6800000000e+02    9.4741445728e-05    1.0400000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.5481847535e-03    1.2700000000e+02    7.7164545652e-04    1.5600000000e+02    1.0602672719e-03    1.3400000000e+02    3.5925682521e-03    1.4200000000e+02   -1.8590938838e-01    1.2400000000e+02    1.5314505068e-01    1.7100000000e+02   -1.4620497666e-01    1.1400000000e+02    1.3488052077e-01    1.7100000000e+02   -1.3857346336e-01    1.3000000000e+02    1.4583015509e-01    1.2900000000e+02   -4.5480379960e+00    1.2600000000e+02    5.3517574304e+00    1.2400000000e+02   -5.3452781686e-09   -1.8216471248e-12   -5.4536090273e-09    2.0268896040e-12
+    1.0506381436e+01    4.6454645233e-03    4.6454204933e-03    4.4029984407e-08    9.4781254906e-06    5.6299985881e-06    4.6398345247e-03   -1.1185219911e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2937269508e-03    1.9800000000e+03   -8.0000000000e+00    2.3461075738e-03    5.5511742360e-06    8.8563814989e-11    1.1329199484e-10    0.0000000000e+00    1.3117786018e-08    6.5504710250e-08   -4.1055733796e-02    1.4500000000e+02    3.7313959014e-02    1.2400000000e+02   -1.2732424396e-04    1.1700000000e+02    3.6697706164e-05    1.1900000000e+02   -4.6893772665e-05    1.8900000000e+02    1.1067389576e-04    1.1500000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.8371545574e-03    1.1200000000e+02    8.3201345246e-04    1.3900000000e+02    1.0534802760e-03    1.5500000000e+02    3.7232745213e-03    1.4000000000e+02   -1.8687845935e-01    1.1400000000e+02    1.6406512186e-01    1.3800000000e+02   -1.4258033982e-01    1.3900000000e+02    1.2472141380e-01    1.7800000000e+02   -1.3256732384e-01    1.3900000000e+02    1.4945572173e-01    1.3000000000e+02   -4.9609231513e+00    1.4800000000e+02    4.8701954222e+00    1.8000000000e+02   -5.5085587854e-09   -1.0765546973e-12   -5.6766611257e-09    2.3720104621e-12
+    1.0926636694e+01    4.6454535957e-03    4.6454201820e-03    3.3413655330e-08    7.1927987843e-06    5.4016548110e-06    4.6400519408e-03   -1.1496492361e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2937471487e-03    1.9800000000e+03   -8.0000000000e+00    2.3463047921e-03    5.3113992427e-06    1.0168360597e-10    1.6474513496e-10    0.0000000000e+00    1.6668435006e-08    7.3320704498e-08   -3.8442726383e-02    1.0900000000e+02    3.6127803720e-02    1.0800000000e+02   -1.4428906970e-04    1.1500000000e+02    2.9993050011e-05    1.1900000000e+02   -2.1507481734e-05    1.5100000000e+02    1.3917693823e-04    1.4000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.9808124376e-03    1.0000000000e+02    8.5757583037e-04    1.2000000000e+02    7.0502015738e-04    1.3600000000e+02    3.9920934094e-03    1.0900000000e+02   -1.6155146137e-01    1.2200000000e+02    1.6678853421e-01    1.4800000000e+02   -1.6585609580e-01    1.1600000000e+02    1.6108096814e-01    1.5200000000e+02   -1.5100240186e-01    1.3200000000e+02    1.6271522300e-01    1.4700000000e+02   -4.4181802374e+00    1.2700000000e+02    4.5695163454e+00    1.6800000000e+02   -5.6030976885e-09   -3.6338963335e-13   -5.8933946723e-09    1.0937721993e-12
+    1.1346891951e+01    4.6454529934e-03    4.6454200227e-03    3.2970687451e-08    7.0974431943e-06    5.2628541494e-06    4.6401901393e-03   -1.1655746928e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2937564817e-03    1.9800000000e+03   -8.0000000000e+00    2.3464336576e-03    5.1636191071e-06    8.7803125220e-11    1.6471414394e-10    0.0000000000e+00    1.8371955952e-08    8.0610569118e-08   -3.4183270181e-02    1.1700000000e+02    4.0329007122e-02    9.5000000000e+01   -1.1542398205e-04    1.4500000000e+02    5.8138494916e-05    1.3200000000e+02   -9.8423224679e-06    1.7000000000e+02    1.6152162900e-04    1.6300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.9962391942e-03    1.0800000000e+02    1.0492933182e-03    1.3100000000e+02    5.4976094734e-04    1.6400000000e+02    4.0260468641e-03    1.2700000000e+02   -1.6065533224e-01    1.7400000000e+02    1.4733930031e-01    1.3600000000e+02   -1.7635907889e-01    1.2500000000e+02    1.6166287996e-01    1.3500000000e+02   -1.5872851635e-01    1.0000000000e+02    1.5222778945e-01    1.1600000000e+02   -4.2223069670e+00    1.3000000000e+02    4.5208203885e+00    1.8000000000e+02   -5.6441101706e-09   -4.0805491767e-13   -6.0116367571e-09    7.4314175555e-13
+    1.1767147208e+01    4.6454618245e-03    4.6454198707e-03    4.1953796217e-08    9.0311943260e-06    6.3478941717e-06    4.6391139304e-03   -1.1807759714e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2938594185e-03    1.9800000000e+03   -8.0000000000e+00    2.3452545119e-03    6.2426092257e-06    7.5713682336e-11    1.2365704433e-10    0.0000000000e+00    1.9152881314e-08    8.5932693943e-08   -3.8344073084e-02    1.3500000000e+02    4.6129455009e-02    9.2000000000e+01   -8.4291221358e-05    1.2900000000e+02    1.1859257084e-04    1.4200000000e+02   -5.6104465440e-05    1.4700000000e+02    1.2075067019e-04    1.0000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.0844855731e-03    1.3300000000e+02    9.7418051113e-04    1.2000000000e+02    6.6410759392e-04    1.4800000000e+02    3.8315462313e-03    1.0700000000e+02   -1.5618937304e-01    1.7900000000e+02    1.5323406249e-01    1.2700000000e+02   -1.7403369542e-01    1.1200000000e+02    1.4612792197e-01    1.4200000000e+02   -1.7080724199e-01    1.0200000000e+02    1.4776662411e-01    1.3100000000e+02   -4.2944500103e+00    1.3500000000e+02    5.3018375674e+00    1.6000000000e+02   -5.7458668490e-09   -1.0634456800e-12   -6.0618928651e-09    4.0074127519e-13
+    1.2187402466e+01    4.6454645082e-03    4.6454197508e-03    4.4757355873e-08    9.6347032892e-06    6.5286542508e-06    4.6389358539e-03   -1.1927655798e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2938751817e-03    1.9800000000e+03   -8.0000000000e+00    2.3450606722e-03    6.4184756668e-06    4.7887448572e-11    1.2108289576e-10    0.0000000000e+00    1.9982563041e-08    9.0027050612e-08   -3.3507944852e-02    1.2500000000e+02    5.8484281420e-02    1.0600000000e+02   -4.0424348559e-05    1.5500000000e+02    1.1285787167e-04    1.5800000000e+02   -9.2887574106e-05    1.6400000000e+02    8.4769879574e-05    1.2800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.0388092077e-03    1.0100000000e+02    7.2925563276e-04    8.0000000000e+01    3.9694481651e-04    1.2800000000e+02    3.6927596597e-03    1.0800000000e+02   -1.5478669878e-01    1.2600000000e+02    1.4924495654e-01    1.5600000000e+02   -1.4975669477e-01    1.3600000000e+02    1.5583704689e-01    1.2200000000e+02   -1.4092360535e-01    1.5900000000e+02    1.6876818655e-01    1.3000000000e+02   -5.2596262174e+00    1.1100000000e+02    5.3495881044e+00    1.8600000000e+02   -5.8009505044e-09   -4.2699612994e-13   -6.1267052936e-09    1.3992406028e-12
+    1.2607657723e+01    4.6454503217e-03    4.6454195203e-03    3.0801451288e-08    6.6304820348e-06    5.4605380341e-06    4.6399897837e-03   -1.2158204527e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2939764840e-03    1.9800000000e+03   -8.0000000000e+00    2.3460132997e-03    5.3449822482e-06    6.7440032549e-11    1.2344642177e-10    0.0000000000e+00    2.1856121148e-08    9.3508778233e-08   -2.7588759685e-02    1.5300000000e+02    5.1055358535e-02    1.1900000000e+02   -4.2190525074e-05    1.2200000000e+02    1.2508668660e-04    1.7500000000e+02   -1.2424762176e-04    1.7700000000e+02    3.6751547296e-05    1.3000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.3040996754e-03    1.3800000000e+02    6.1325379234e-04    1.2700000000e+02    3.1054549776e-04    9.4000000000e+01    3.7421143225e-03    1.3000000000e+02   -1.4256625896e-01    1.6100000000e+02    1.8745648639e-01    1.6600000000e+02   -1.8952383976e-01    1.3300000000e+02    1.5382448760e-01    9.2000000000e+01   -1.6851676171e-01    1.3900000000e+02    1.6574474443e-01    1.3500000000e+02   -4.1651158565e+00    1.5400000000e+02    4.8443155539e+00    1.6700000000e+02   -5.8680244906e-09   -8.2405641725e-13   -6.2901800364e-09    1.9932884494e-12
+    1.3027912981e+01    4.6454402892e-03    4.6454193659e-03    2.0923315698e-08    4.5040627322e-06    4.2661375784e-06    4.6411741516e-03   -1.2312634206e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2940476166e-03    1.9800000000e+03   -8.0000000000e+00    2.3471265350e-03    4.1443323664e-06    2.7064717302e-11    2.4604532767e-10    0.0000000000e+00    2.4380307151e-08    9.7151794871e-08   -2.6265748621e-02    1.4000000000e+02    4.4905714453e-02    1.4700000000e+02   -5.1281777234e-05    1.6700000000e+02    9.9479589288e-05    1.5200000000e+02   -1.5360929705e-04    1.6300000000e+02    1.7425409424e-05    1.2900000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.1424728579e-03    1.7800000000e+02    3.8147791460e-04    1.3500000000e+02    2.2268547373e-04    1.3200000000e+02    3.6033219198e-03    1.4300000000e+02   -1.5515402981e-01    1.3100000000e+02    1.3921699023e-01    1.1100000000e+02   -1.5128756334e-01    1.1600000000e+02    1.6383078079e-01    1.4300000000e+02   -1.5203720078e-01    1.4200000000e+02    1.3840499300e-01    1.2600000000e+02   -4.6009078937e+00    1.3100000000e+02    4.2372933440e+00    1.7600000000e+02   -5.9353528452e-09   -6.6037376242e-13   -6.3772813606e-09    9.5281107395e-13
+    1.3448168238e+01    4.6454463140e-03    4.6454190386e-03    2.7275401171e-08    5.8714459837e-06    3.8712102752e-06    4.6415751037e-03   -1.2639868832e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941504753e-03    1.9800000000e+03   -8.0000000000e+00    2.3474246284e-03    3.7433924598e-06    4.5283303191e-11    1.5865039970e-10    0.0000000000e+00    2.8292466443e-08    9.9321415229e-08   -2.6743354913e-02    1.1400000000e+02    3.9331968935e-02    1.2200000000e+02   -3.4716734339e-05    1.0800000000e+02    1.1239815237e-04    1.1800000000e+02   -8.9826474661e-05    1.6800000000e+02    4.6139469161e-05    3.8000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.2684957966e-03    1.6300000000e+02    3.8108773334e-04    1.6600000000e+02    3.3295310467e-04    1.2400000000e+02    3.6977700894e-03    1.0600000000e+02   -1.6974032599e-01    1.1600000000e+02    1.8876125843e-01    1.5100000000e+02   -1.3855378655e-01    1.0900000000e+02    1.3665577745e-01    1.5500000000e+02   -1.3201365159e-01    1.6100000000e+02    1.6184465945e-01    1.5900000000e+02   -4.3885038935e+00    9.6000000000e+01    4.4253220123e+00    1.7300000000e+02   -6.0052159502e-09   -1.0425359440e-12   -6.6346528816e-09    4.2853035607e-12
+    1.3868423496e+01    4.6454519663e-03    4.6454184718e-03    3.3494485843e-08    7.2101987847e-06    4.1096308618e-06    4.6413423354e-03   -1.3206698248e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941535914e-03    1.9800000000e+03   -8.0000000000e+00    2.3471887440e-03    3.9791610863e-06    7.8452912643e-11    1.9420596500e-10    0.0000000000e+00    3.0848324441e-08    9.9348792248e-08   -3.0024793726e-02    1.4100000000e+02    3.8981066789e-02    1.1900000000e+02   -5.1073956907e-05    1.5200000000e+02    1.4062291359e-04    1.1100000000e+02   -7.8329592864e-05    1.5700000000e+02    1.0538320595e-04    9.6000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.3976525364e-03    1.2700000000e+02    4.1868331403e-05    1.6400000000e+02    3.6809415716e-04    1.0500000000e+02    3.7755509224e-03    1.4000000000e+02   -1.4590439034e-01    1.4200000000e+02    1.8616736806e-01    8.8000000000e+01   -1.3933316408e-01    1.3600000000e+02    1.4412589805e-01    1.1000000000e+02   -1.4407899094e-01    1.3900000000e+02    1.3802905902e-01    1.3500000000e+02   -4.0977718186e+00    1.2400000000e+02    5.4215085913e+00    1.5900000000e+02   -6.1280737102e-09   -1.7956697857e-12   -7.0786245378e-09    4.2229931311e-12
+    1.4288678753e+01    4.6454575059e-03    4.6454176885e-03    3.9817434315e-08    8.5713098525e-06    4.2311718548e-06    4.6412263340e-03   -1.3990030407e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942944172e-03    1.9800000000e+03   -8.0000000000e+00    2.3469319169e-03    4.0977025927e-06    8.5881069602e-11    2.6910195602e-10    0.0000000000e+00    3.4885206528e-08    9.8229072577e-08   -3.3629971140e-02    1.2900000000e+02    3.8605799943e-02    8.8000000000e+01   -2.5236020716e-05    1.5500000000e+02    1.1964012471e-04    1.2500000000e+02   -4.9678105794e-05    1.4500000000e+02    9.6068048059e-05    8.0000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.9361044190e-03    1.5000000000e+02   -1.4907754940e-04    1.2100000000e+02    5.5389447459e-04    1.0500000000e+02    3.8931764007e-03    1.2400000000e+02   -1.2418433859e-01    1.4800000000e+02    1.6992341926e-01    1.0300000000e+02   -1.6805932342e-01    1.6000000000e+02    1.3522030774e-01    1.5400000000e+02   -1.3734612857e-01    1.7300000000e+02    1.3069589730e-01    8.3000000000e+01   -4.5634605095e+00    1.2300000000e+02    4.3149411559e+00    1.7300000000e+02   -6.4371142773e-09   -3.3229254609e-12   -7.5529161300e-09    5.8601085585e-12
+    1.4708934011e+01    4.6454654986e-03    4.6454166604e-03    4.8838290272e-08    1.0513186643e-05    4.6096663949e-06    4.6408558323e-03   -1.5018135288e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946168621e-03    1.9800000000e+03   -8.0000000000e+00    2.3462389702e-03    4.4697898328e-06    1.6176169905e-10    3.5373406341e-10    0.0000000000e+00    4.1753605434e-08    9.7607460887e-08   -3.4075690224e-02    1.3600000000e+02    3.5171093013e-02    1.5300000000e+02   -1.3133022925e-05    1.5500000000e+02    1.5035475923e-04    1.5800000000e+02   -3.9607134402e-05    1.8600000000e+02    1.1442527382e-04    8.7000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.3169420258e-03    1.5000000000e+02   -4.2974100286e-05    1.2200000000e+02    1.0105986173e-03    1.0600000000e+02    4.1512706184e-03    1.2700000000e+02   -1.6708416557e-01    1.0800000000e+02    1.8627562761e-01    1.4300000000e+02   -1.5395947026e-01    1.4700000000e+02    1.3235137042e-01    1.2100000000e+02   -1.4389938197e-01    1.4300000000e+02    1.7570306127e-01    1.4900000000e+02   -4.8370788117e+00    1.1600000000e+02    4.9210695223e+00    1.2300000000e+02   -6.7734937676e-09   -3.7495471763e-12   -8.2446415202e-09    9.7007503934e-12
+    1.5129189268e+01    4.6454517708e-03    4.6454151933e-03    3.6577473614e-08    7.8738589104e-06    4.4664142662e-06    4.6409853565e-03   -1.6485171514e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2948396884e-03    1.9800000000e+03   -8.0000000000e+00    2.3461456681e-03    4.3225871808e-06    2.0781351292e-10    3.4446558107e-10    0.0000000000e+00    4.7220133895e-08    9.6054672460e-08   -3.7267630736e-02    1.3300000000e+02    3.1255237772e-02    1.7100000000e+02   -1.5270061667e-06    1.0300000000e+02    1.8545824090e-04    8.5000000000e+01   -3.9893310162e-05    2.0500000000e+02    1.4316458988e-04    8.0000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.3937642688e-03    1.3600000000e+02   -4.3772749068e-04    1.4100000000e+02    1.1541436631e-03    1.3900000000e+02    4.0243402957e-03    1.3300000000e+02   -1.6818029394e-01    1.4800000000e+02    1.7535343041e-01    1.4500000000e+02   -1.5293280310e-01    1.5900000000e+02    1.5211666022e-01    1.4500000000e+02   -1.3676501673e-01    1.4300000000e+02    1.5029556158e-01    1.2700000000e+02   -4.5911714898e+00    1.3400000000e+02    4.9010028178e+00    1.3700000000e+02   -7.2136517846e-09   -4.2153243832e-12   -9.2715197293e-09    9.3640676457e-12
+    1.5549444525e+01    4.6454507638e-03    4.6454138630e-03    3.6900861374e-08    7.9434730566e-06    4.4169847656e-06    4.6410337791e-03   -1.7815534975e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2949556778e-03    1.9800000000e+03   -8.0000000000e+00    2.3460781013e-03    4.2636568228e-06    1.8715834698e-10    4.1615981116e-10    0.0000000000e+00    5.7083980304e-08    9.5640644294e-08   -4.1441172441e-02    1.3000000000e+02    2.8360486413e-02    1.2600000000e+02   -1.2231549529e-05    1.3700000000e+02    1.7875048897e-04    1.0000000000e+02   -6.4752218555e-05    1.8600000000e+02    1.2697923302e-04    1.0700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.7206689168e-03    1.5000000000e+02   -5.6233517259e-04    1.2000000000e+02    1.1277976169e-03    1.3500000000e+02    3.8027882531e-03    1.3500000000e+02   -1.7564341059e-01    1.4600000000e+02    1.6302393451e-01    1.4000000000e+02   -1.6613749417e-01    1.5100000000e+02    1.3734246235e-01    1.5500000000e+02   -1.5638222950e-01    1.3800000000e+02    1.8490426846e-01    1.6500000000e+02   -5.1260114626e+00    1.4600000000e+02    4.5620397125e+00    1.3500000000e+02   -7.7111337029e-09   -7.1355487191e-12   -1.0104401273e-08    8.3654890846e-12
+    1.5969699783e+01    4.6454409881e-03    4.6454123392e-03    2.8648861315e-08    6.1671042214e-06    3.9038628232e-06    4.6415371253e-03   -1.9339256411e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2951301006e-03    1.9800000000e+03   -8.0000000000e+00    2.3464070246e-03    3.7364930597e-06    1.4295260459e-10    3.6510849966e-10    0.0000000000e+00    6.7664629708e-08    9.9197072702e-08   -3.5293962087e-02    1.7000000000e+02    2.6556177243e-02    1.5900000000e+02   -6.4336171577e-05    1.4000000000e+02    1.1330098314e-04    9.3000000000e+01   -7.3179993901e-05    1.6300000000e+02    9.4859648021e-05    1.1000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.9260281525e-03    1.0000000000e+02   -7.1322523608e-04    1.1400000000e+02    1.3620570137e-03    1.3500000000e+02    4.2190899686e-03    1.1800000000e+02   -1.7692192943e-01    1.3400000000e+02    1.5855840631e-01    1.4600000000e+02   -1.3616338022e-01    1.2000000000e+02    1.4783774984e-01    1.5400000000e+02   -1.5196251318e-01    1.3400000000e+02    1.5564312700e-01    1.4300000000e+02   -4.9967037620e+00    1.5800000000e+02    4.0267304045e+00    1.5000000000e+02   -8.3993110997e-09   -6.6862364067e-12   -1.0939945311e-08    8.7016792317e-12
+    1.6389955040e+01    4.6454397263e-03    4.6454106941e-03    2.9032224808e-08    6.2496290587e-06    3.3002648565e-06    4.6421394614e-03   -2.0984429637e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2952856888e-03    1.9800000000e+03   -8.0000000000e+00    2.3468537726e-03    3.1178892669e-06    1.7129151257e-10    3.4256027681e-10    0.0000000000e+00    7.7917282768e-08    1.0394445498e-07   -2.9640403971e-02    1.8000000000e+02    2.7145483466e-02    1.4200000000e+02   -1.2091275705e-04    1.6000000000e+02    4.6344618014e-05    1.1900000000e+02   -7.6416981264e-05    1.8800000000e+02    9.1207233275e-05    7.8000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.6717033534e-03    1.5400000000e+02   -1.0759044842e-03    1.4100000000e+02    1.4323451373e-03    1.4200000000e+02    4.5084534441e-03    1.2600000000e+02   -1.8741385936e-01    1.2600000000e+02    1.7382830553e-01    1.6000000000e+02   -1.3857732433e-01    9.6000000000e+01    1.6238916125e-01    1.4100000000e+02   -1.6783636164e-01    1.5300000000e+02    1.4731021518e-01    1.2600000000e+02   -4.3035391321e+00    1.4100000000e+02    4.0664947920e+00    1.2600000000e+02   -9.0757092388e-09   -6.7160400311e-12   -1.1908720398e-08    1.1252578707e-11
+    1.6810210298e+01    4.6454476243e-03    4.6454090850e-03    3.8539270686e-08    8.2961656426e-06    3.3485153043e-06    4.6420991090e-03   -2.2593496248e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2951280694e-03    1.9800000000e+03   -8.0000000000e+00    2.3469710395e-03    3.1491324244e-06    2.0661953786e-10    3.1190740074e-10    0.0000000000e+00    8.9115101837e-08    1.0974925115e-07   -3.3409989207e-02    1.3000000000e+02    2.9609725515e-02    1.3400000000e+02   -1.5633289052e-04    1.8800000000e+02    1.0988218903e-05    8.8000000000e+01   -8.3528101727e-05    1.6800000000e+02    7.0597630410e-05    1.2000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.8292179501e-03    1.4100000000e+02   -1.3633595161e-03    1.3200000000e+02    1.5629224910e-03    1.2200000000e+02    4.4700363125e-03    1.2800000000e+02   -1.8256064523e-01    1.3300000000e+02    1.8073431833e-01    1.2400000000e+02   -1.3785879604e-01    1.4800000000e+02    1.5209463245e-01    1.7100000000e+02   -1.4417795172e-01    1.2500000000e+02    1.4503535896e-01    1.5800000000e+02   -4.9736209163e+00    1.2800000000e+02    4.3646171055e+00    1.5400000000e+02   -9.6529110778e-09   -4.8255935385e-12   -1.2940585170e-08    9.5762409312e-12
+    1.7230465555e+01    4.6454440636e-03    4.6454076063e-03    3.6457289729e-08    7.8479874965e-06    4.0564726641e-06    4.6413875910e-03   -2.4072162755e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2949531916e-03    1.9800000000e+03   -8.0000000000e+00    2.3464343994e-03    3.8330890324e-06    1.9744400749e-10    3.5353714022e-10    0.0000000000e+00    1.0553729953e-07    1.1729535101e-07   -3.6486771353e-02    1.3300000000e+02    3.3109424317e-02    1.1600000000e+02   -1.7476243527e-04    1.8200000000e+02    2.4096941522e-05    1.1500000000e+02   -9.7748958096e-05    1.7800000000e+02    7.6709429638e-05    7.6000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.4840140806e-03    1.4800000000e+02   -1.3813561023e-03    1.2400000000e+02    1.9636392608e-03    1.0600000000e+02    4.7990214481e-03    1.4300000000e+02   -1.6493155443e-01    1.6300000000e+02    1.5057795460e-01    1.1700000000e+02   -1.4276957549e-01    1.5100000000e+02    1.4234990510e-01    1.3200000000e+02   -1.4487945285e-01    1.0000000000e+02    1.5303469999e-01    1.4700000000e+02   -4.1525525586e+00    1.2700000000e+02    4.5454514409e+00    1.0600000000e+02   -1.0112709532e-08   -4.3707006233e-12   -1.3959453223e-08    1.0279322145e-11
+    1.7650720813e+01    4.6454575218e-03    4.6454061795e-03    5.1342278874e-08    1.1052208369e-05    4.9137182748e-06    4.6405438035e-03   -2.5498956953e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947563828e-03    1.9800000000e+03   -8.0000000000e+00    2.3457874208e-03    4.6641785222e-06    1.4431556885e-10    2.6477851836e-10    0.0000000000e+00    1.2254588638e-07    1.2658477217e-07   -4.3544202233e-02    1.1400000000e+02    2.9117683482e-02    1.4500000000e+02   -1.5513461361e-04    1.6800000000e+02    2.6210614669e-05    1.2200000000e+02   -7.6616414147e-05    1.7300000000e+02    7.4885076559e-05    2.0000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.8273723564e-03    1.3700000000e+02   -1.5659277821e-03    1.3800000000e+02    2.1326489744e-03    1.0800000000e+02    5.1350450054e-03    1.3000000000e+02   -1.8592303804e-01    1.2100000000e+02    1.6919944315e-01    1.2000000000e+02   -1.4899619995e-01    1.0200000000e+02    1.5538512063e-01    9.8000000000e+01   -1.2873896440e-01    1.0400000000e+02    1.6766326313e-01    1.5000000000e+02   -5.5637895946e+00    1.2100000000e+02    5.2883244047e+00    1.1400000000e+02   -1.0490554704e-08   -2.6025991135e-12   -1.5008402249e-08    8.3042151073e-12
+    1.8070976070e+01    4.6454532640e-03    4.6454052788e-03    4.7985258598e-08    1.0329558568e-05    4.9341617928e-06    4.6405191022e-03   -2.6399719486e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946473461e-03    1.9800000000e+03   -8.0000000000e+00    2.3458717561e-03    4.6582204424e-06    7.9935692764e-11    2.9487430260e-10    0.0000000000e+00    1.3954928688e-07    1.3601725346e-07   -4.4761717428e-02    9.9000000000e+01    3.4672482144e-02    1.2300000000e+02   -1.1607322344e-04    1.3400000000e+02    2.6674260076e-05    1.2200000000e+02   -8.1125213689e-05    1.4100000000e+02    6.6478859556e-05    1.1300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.8393649933e-03    1.5300000000e+02   -1.4977007257e-03    1.2400000000e+02    2.2463696314e-03    1.0500000000e+02    5.2947610634e-03    1.3300000000e+02   -1.8857375941e-01    1.3400000000e+02    1.6032094798e-01    1.1200000000e+02   -1.5598677825e-01    1.5600000000e+02    1.3583491952e-01    1.3400000000e+02   -1.4650352276e-01    1.2900000000e+02    1.9091582498e-01    1.2400000000e+02   -4.8047883095e+00    1.8100000000e+02    4.8418372912e+00    1.4300000000e+02   -1.0688607536e-08   -1.8101551879e-12   -1.5711111949e-08    4.9350107265e-12
+    1.8491231328e+01    4.6454449344e-03    4.6454045842e-03    4.0350225695e-08    8.6860013209e-06    4.4877896250e-06    4.6409571448e-03   -2.7094319938e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945456090e-03    1.9800000000e+03   -8.0000000000e+00    2.3464115357e-03    4.1903173349e-06    3.4809895531e-11    2.0280813152e-10    0.0000000000e+00    1.5395349222e-07    1.4328117990e-07   -3.9695149041e-02    1.2400000000e+02    3.0685394977e-02    1.2500000000e+02   -8.1013136002e-05    1.4400000000e+02    6.0599460207e-05    1.1400000000e+02   -1.0365850394e-04    1.4400000000e+02    4.1653849644e-05    9.7000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.8419517046e-03    1.6500000000e+02   -1.7540814392e-03    1.0900000000e+02    2.3495471968e-03    1.2000000000e+02    5.4857859522e-03    1.1300000000e+02   -1.6603796090e-01    1.3000000000e+02    1.8963314391e-01    1.4600000000e+02   -1.6088443342e-01    1.3500000000e+02    1.5813925762e-01    1.5100000000e+02   -1.6225154627e-01    1.2900000000e+02    1.6307235090e-01    1.7800000000e+02   -4.8571056577e+00    1.5500000000e+02    4.4363188779e+00    1.2200000000e+02   -1.0900121126e-08   -2.0916994577e-12   -1.6194198812e-08    4.3363235728e-12
+    1.8911486585e+01    4.6454339932e-03    4.6454041408e-03    2.9852433786e-08    6.4261915474e-06    4.0530438201e-06    4.6413809494e-03   -2.7537708009e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944382613e-03    1.9800000000e+03   -8.0000000000e+00    2.3469426881e-03    3.7426401206e-06    1.9263059070e-11    1.8096141031e-10    0.0000000000e+00    1.6508987823e-07    1.4511359682e-07   -3.2874806604e-02    1.4700000000e+02    3.3337860087e-02    1.3200000000e+02   -6.4471228720e-05    1.4000000000e+02    8.7982278118e-05    1.5200000000e+02   -1.4147691922e-04    1.5400000000e+02    8.5756819625e-06    8.5000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.1366649689e-03    1.4500000000e+02   -1.9316161066e-03    1.0400000000e+02    2.1082921135e-03    1.0300000000e+02    5.4872208243e-03    1.3000000000e+02   -1.3246726904e-01    1.1800000000e+02    1.5518988939e-01    1.1900000000e+02   -1.6101775434e-01    1.1900000000e+02    1.8124158902e-01    1.1100000000e+02   -1.5531433371e-01    1.4700000000e+02    1.9090965765e-01    1.5400000000e+02   -4.5533681529e+00    1.4100000000e+02    4.3727826817e+00    1.5900000000e+02   -1.1064765416e-08   -1.1276132431e-12   -1.6472942593e-08    3.1660450943e-12
+    1.9331741842e+01    4.6454415134e-03    4.6454037671e-03    3.7746337469e-08    8.1254746773e-06    4.0711332138e-06    4.6413703802e-03   -2.7911438721e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944214893e-03    1.9800000000e+03   -8.0000000000e+00    2.3469488909e-03    3.7552359288e-06    2.3224538384e-11    1.8282745471e-10    0.0000000000e+00    1.7474003241e-07    1.4095120050e-07   -3.5357807946e-02    1.5100000000e+02    2.8658273946e-02    1.2900000000e+02   -4.5051873345e-05    1.0200000000e+02    9.9085700877e-05    1.1000000000e+02   -1.4471480460e-04    1.6100000000e+02    5.5572247611e-06    9.8000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.3769259951e-03    1.3800000000e+02   -2.0105556510e-03    1.0200000000e+02    2.3046321492e-03    1.6200000000e+02    5.0885269826e-03    1.4100000000e+02   -1.4619491461e-01    1.5300000000e+02    1.5103816980e-01    6.4000000000e+01   -1.4250701646e-01    1.7200000000e+02    1.4295608105e-01    1.2200000000e+02   -1.5258723463e-01    1.6700000000e+02    1.6689052894e-01    1.3300000000e+02   -4.8886176315e+00    1.1800000000e+02    4.1294807266e+00    1.2800000000e+02   -1.1150702213e-08   -9.0008608196e-13   -1.6760736508e-08    3.7767361790e-12
+    1.9751997100e+01    4.6454285929e-03    4.6454033302e-03    2.5262717335e-08    5.4381850995e-06    3.5199822588e-06    4.6419086107e-03   -2.8348299275e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944999315e-03    1.9800000000e+03   -8.0000000000e+00    2.3474086791e-03    3.1981338122e-06    4.3797170828e-11    1.4294455763e-10    0.0000000000e+00    1.8271788611e-07    1.3894381879e-07   -3.1113532568e-02    8.2000000000e+01    2.5134795009e-02    1.0900000000e+02   -3.9547952724e-05    1.0400000000e+02    9.4998192454e-05    1.5100000000e+02   -1.1055411743e-04    1.5600000000e+02    4.3585123001e-05    1.0900000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.4149360542e-03    1.4300000000e+02   -2.2275994068e-03    1.2200000000e+02    2.2021018648e-03    1.1100000000e+02    5.0419287095e-03    1.4600000000e+02   -1.7544244961e-01    1.3100000000e+02    1.4301630248e-01    1.4800000000e+02   -1.4452191178e-01    1.4100000000e+02    1.6222751145e-01    1.3900000000e+02   -1.4794211421e-01    1.8300000000e+02    1.4708987948e-01    1.2500000000e+02   -4.7979646855e+00    1.3300000000e+02    4.6125722075e+00    1.3100000000e+02   -1.1213563992e-08   -7.4707022328e-13   -1.7134735282e-08    3.3846489545e-12
+    2.0172252357e+01    4.6454361576e-03    4.6454030440e-03    3.3113545680e-08    7.1281956063e-06    2.9954809771e-06    4.6424406766e-03   -2.8634443142e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945865104e-03    1.9800000000e+03   -8.0000000000e+00    2.3478541662e-03    2.6679365787e-06    4.3253574027e-11    1.3390523356e-10    0.0000000000e+00    1.9191226080e-07    1.3545497875e-07   -2.5750088929e-02    1.2100000000e+02    2.7122073823e-02    1.0800000000e+02   -8.6002760282e-05    1.3000000000e+02    9.2497151223e-05    1.4500000000e+02   -1.0905737980e-04    1.6000000000e+02    3.2502945886e-05    9.0000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.5790005402e-03    1.2400000000e+02   -2.1692407378e-03    1.1300000000e+02    2.3046718733e-03    1.0300000000e+02    4.9221550672e-03    1.2800000000e+02   -1.8435294552e-01    1.3500000000e+02    1.5853757792e-01    1.6200000000e+02   -1.4971535892e-01    8.7000000000e+01    1.0031332502e-01    7.6000000000e+01   -1.4898677589e-01    1.5000000000e+02    1.5489701819e-01    1.0400000000e+02   -4.3046258853e+00    1.3500000000e+02    4.0960125579e+00    1.4700000000e+02   -1.1290984870e-08   -7.5840396331e-13   -1.7343458271e-08    1.1228123340e-12
+    2.0592507615e+01    4.6454355204e-03    4.6454028187e-03    3.2701686145e-08    7.0395365615e-06    3.3885550766e-06    4.6420469653e-03   -2.8859761453e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946111614e-03    1.9800000000e+03   -8.0000000000e+00    2.3474358039e-03    3.0560701241e-06    5.1709510152e-11    1.5249599601e-10    0.0000000000e+00    1.9924010624e-07    1.3304064072e-07   -2.7902585155e-02    1.4500000000e+02    2.8896081428e-02    1.6400000000e+02   -8.2630688696e-05    1.2500000000e+02    8.9087700653e-05    1.3000000000e+02   -1.3828418048e-04    1.7200000000e+02    3.2409331234e-05    9.2000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.5631131363e-03    1.3700000000e+02   -2.2286051959e-03    1.3900000000e+02    2.3218447057e-03    1.3500000000e+02    5.2463693596e-03    1.4400000000e+02   -1.5926808255e-01    1.5100000000e+02    1.8286041313e-01    1.6200000000e+02   -1.5528320406e-01    1.4400000000e+02    1.4838294446e-01    1.7300000000e+02   -1.4913187920e-01    1.7100000000e+02    1.6079519651e-01    1.4900000000e+02   -4.2621595232e+00    1.3700000000e+02    3.9326328445e+00    1.2000000000e+02   -1.1419614602e-08   -1.6037516446e-12   -1.7440146852e-08    3.2124180217e-13
+    2.1012762872e+01    4.6454445498e-03    4.6454026579e-03    4.1891860054e-08    9.0178616226e-06    3.3837944788e-06    4.6420607553e-03   -2.9020580493e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947068843e-03    1.9800000000e+03   -8.0000000000e+00    2.3473538710e-03    3.0543443289e-06    5.9486904804e-11    1.3565891466e-10    0.0000000000e+00    2.0074963135e-07    1.2850537269e-07   -3.6949154453e-02    8.8000000000e+01    2.7984585146e-02    1.8900000000e+02   -5.6295156653e-05    1.4200000000e+02    8.6914779451e-05    1.1800000000e+02   -1.7021507014e-04    1.3600000000e+02    1.9559151231e-05    1.3100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.5023965202e-03    1.4000000000e+02   -2.6065424494e-03    1.0700000000e+02    2.2233555862e-03    1.1600000000e+02    5.0425177142e-03    1.4300000000e+02   -1.6090063474e-01    1.1300000000e+02    1.7523461397e-01    1.2000000000e+02   -1.6255496644e-01    1.2600000000e+02    1.4559979812e-01    1.0500000000e+02   -1.2377959545e-01    1.3400000000e+02    1.5726060563e-01    1.1700000000e+02   -4.5870753980e+00    1.5700000000e+02    4.6370198919e+00    1.3600000000e+02   -1.1529277885e-08   -1.1724607437e-12   -1.7491302608e-08    2.2250134503e-13
+    2.1433018130e+01    4.6454501810e-03    4.6454025006e-03    4.7680480311e-08    1.0263950395e-05    3.5873647166e-06    4.6418628163e-03   -2.9177937915e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946645459e-03    1.9800000000e+03   -8.0000000000e+00    2.3471982704e-03    3.2534468552e-06    3.8805421990e-11    1.5038997098e-10    0.0000000000e+00    2.0748379190e-07    1.2624487408e-07   -3.8400339644e-02    8.0000000000e+01    2.7287684010e-02    1.0500000000e+02   -4.5720946614e-05    1.1200000000e+02    7.7635315047e-05    1.4400000000e+02   -1.4281889588e-04    1.5400000000e+02    1.1862426548e-05    1.0800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.6566873661e-03    1.3000000000e+02   -2.3110108424e-03    1.2300000000e+02    2.0248966712e-03    1.4800000000e+02    5.1783506456e-03    1.5700000000e+02   -1.6858024143e-01    8.4000000000e+01    1.9260372880e-01    1.4700000000e+02   -1.4725949276e-01    9.6000000000e+01    1.5611143012e-01    1.5900000000e+02   -1.5514264391e-01    1.0900000000e+02    1.6231311599e-01    1.6400000000e+02   -5.4365386332e+00    1.3700000000e+02    4.5187371261e+00    1.3200000000e+02   -1.1662233980e-08   -5.3031318251e-13   -1.7515703935e-08    2.5185275755e-13
+    2.1853273387e+01    4.6454472551e-03    4.6454024477e-03    4.4807304057e-08    9.6454553975e-06    3.8242530433e-06    4.6416230020e-03   -2.9230744420e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946045333e-03    1.9800000000e+03   -8.0000000000e+00    2.3470184687e-03    3.4873595725e-06    6.7082204802e-11    9.5800411231e-11    0.0000000000e+00    2.1495342019e-07    1.2177716799e-07   -3.9232591892e-02    9.2000000000e+01    2.4942367234e-02    1.1800000000e+02   -6.6462408466e-05    9.7000000000e+01    8.5392012499e-05    1.8100000000e+02   -1.3745261349e-04    1.2200000000e+02    7.4851218537e-06    1.0700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.0268600183e-03    1.3400000000e+02   -2.1900846087e-03    1.5900000000e+02    2.2656333420e-03    1.3800000000e+02    5.0152396844e-03    1.5200000000e+02   -1.7365891952e-01    1.3100000000e+02    1.7085682004e-01    1.6600000000e+02   -1.3752784352e-01    1.2800000000e+02    1.4281230763e-01    1.4500000000e+02   -1.8262805938e-01    1.5800000000e+02    1.4775634120e-01    1.5200000000e+02   -5.3197988768e+00    9.2000000000e+01    4.8457309779e+00    1.3300000000e+02   -1.1695235026e-08   -3.8331499929e-13   -1.7535509393e-08    4.1149300106e-13
+    2.2273528645e+01    4.6454432874e-03    4.6454023201e-03    4.0967235406e-08    8.8188220690e-06    4.5326717022e-06    4.6409106157e-03   -2.9358347201e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946479261e-03    1.9800000000e+03   -8.0000000000e+00    2.3462626896e-03    4.1965597044e-06    5.7203935713e-11    7.6076065227e-11    0.0000000000e+00    2.1942078516e-07    1.1655793266e-07   -3.4327825202e-02    8.9000000000e+01    3.7173304603e-02    1.3200000000e+02   -9.3830858916e-05    1.0600000000e+02    5.3969596254e-05    1.6200000000e+02   -1.1595236772e-04    1.3700000000e+02    4.6886446416e-05    1.5200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.7196097657e-03    1.3300000000e+02   -2.1550601107e-03    1.5600000000e+02    2.0585599960e-03    1.4900000000e+02    5.1451548803e-03    1.5200000000e+02   -1.7315031794e-01    1.4200000000e+02    1.7766837857e-01    1.7200000000e+02   -1.3192571000e-01    1.3000000000e+02    1.4155773461e-01    1.1400000000e+02   -1.7164964471e-01    1.6400000000e+02    1.5254416549e-01    1.5500000000e+02   -4.2109717079e+00    1.4600000000e+02    4.7689509148e+00    1.0700000000e+02   -1.1763453275e-08   -7.5476770740e-13   -1.7594893925e-08    1.1048794457e-12
+    2.2693783902e+01    4.6454348963e-03    4.6454020436e-03    3.2852700114e-08    7.0720446210e-06    4.8730035584e-06    4.6405618927e-03   -2.9634935325e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945489841e-03    1.9800000000e+03   -8.0000000000e+00    2.3460129086e-03    4.5347743134e-06    9.1939111708e-11    8.9058016191e-11    0.0000000000e+00    2.2534394870e-07    1.1270429918e-07   -4.0698084263e-02    1.0000000000e+02    3.9373620227e-02    1.3500000000e+02   -1.1920322202e-04    1.2000000000e+02    3.5742561290e-05    1.0100000000e+02   -9.9931173001e-05    1.3700000000e+02    5.9998876028e-05    1.3100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.4688552199e-03    1.3200000000e+02   -1.9960830556e-03    1.3500000000e+02    2.0721509228e-03    1.4100000000e+02    5.1359596345e-03    1.1300000000e+02   -1.8481224561e-01    1.2100000000e+02    1.5457432313e-01    1.2700000000e+02   -1.5413871999e-01    1.3500000000e+02    1.4754226811e-01    1.1600000000e+02   -1.4855928577e-01    1.1100000000e+02    1.7548195644e-01    1.6100000000e+02   -5.2122562067e+00    1.4400000000e+02    5.3338482318e+00    1.4000000000e+02   -1.1828954893e-08   -6.2880192496e-13   -1.7805980432e-08    1.8632799441e-12
+    2.3114039159e+01    4.6454298258e-03    4.6454016946e-03    2.8131208541e-08    6.0556715689e-06    3.5244396517e-06    4.6419053862e-03   -2.9983856738e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944972298e-03    1.9800000000e+03   -8.0000000000e+00    2.3474081564e-03    3.1920297328e-06    1.2444891174e-10    9.2162233553e-11    0.0000000000e+00    2.2316523582e-07    1.0902807197e-07   -3.0092097620e-02    1.5500000000e+02    3.4425321160e-02    1.2400000000e+02   -1.4085395647e-04    1.2600000000e+02    3.3266993017e-06    1.8000000000e+02   -8.9821257349e-05    1.0900000000e+02    6.1755866653e-05    1.4600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.4172160194e-03    1.4000000000e+02   -1.8242846145e-03    1.3400000000e+02    1.7697725911e-03    1.1300000000e+02    5.0315830715e-03    1.2100000000e+02   -1.6859330393e-01    1.4300000000e+02    1.8323143810e-01    1.2600000000e+02   -1.4218043121e-01    1.7800000000e+02    1.3762211418e-01    1.3600000000e+02   -1.6517362437e-01    1.1000000000e+02    1.5149629242e-01    1.0900000000e+02   -4.5092995668e+00    1.5000000000e+02    4.2702770755e+00    1.7000000000e+02   -1.1918963030e-08   -2.3152113386e-12   -1.8064893708e-08    3.0498652052e-12
+    2.3534294417e+01    4.6454581524e-03    4.6454009872e-03    5.7165255390e-08    1.2305692850e-05    5.7133919075e-06    4.6397447605e-03   -3.0691321852e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944464863e-03    1.9800000000e+03   -8.0000000000e+00    2.3452982743e-03    5.3892703117e-06    1.2010515212e-10    1.0922516990e-10    0.0000000000e+00    2.1894375342e-07    1.0494851205e-07   -3.8678206315e-02    1.5000000000e+02    3.9888392815e-02    1.1900000000e+02   -1.1402296817e-04    9.2000000000e+01    2.7987822184e-05    1.4000000000e+02   -8.8497816828e-05    1.1000000000e+02    5.7404413553e-05    1.5600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.3262251284e-03    1.4100000000e+02   -1.7238266087e-03    1.2600000000e+02    1.3702830864e-03    1.3200000000e+02    5.3235226199e-03    1.3300000000e+02   -1.6083790634e-01    1.5000000000e+02    1.6149467876e-01    9.1000000000e+01   -1.7373442339e-01    1.3200000000e+02    1.7246592578e-01    1.1900000000e+02   -1.6222702786e-01    1.0700000000e+02    1.3919870750e-01    1.6400000000e+02   -4.3767806128e+00    1.3600000000e+02    5.2001921827e+00    1.5100000000e+02   -1.2237787152e-08   -4.2132693320e-12   -1.8453534700e-08    4.0111857877e-12
+    2.3954549674e+01    4.6454418899e-03    4.6454001378e-03    4.1752111273e-08    8.9877785666e-06    7.0216988999e-06    4.6384201910e-03   -3.1540732808e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2943762573e-03    1.9800000000e+03   -8.0000000000e+00    2.3440439336e-03    6.7101844793e-06    1.3918848673e-10    1.5235930733e-10    0.0000000000e+00    2.1487190915e-07    9.6350963612e-08   -3.7796870455e-02    1.6500000000e+02    4.5603251202e-02    1.2000000000e+02   -1.0081637594e-04    1.3700000000e+02    6.7160880196e-05    1.5400000000e+02   -1.1930505859e-04    9.2000000000e+01    3.9555449840e-05    1.4600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.2757870759e-03    1.8100000000e+02   -1.6331562972e-03    1.4900000000e+02    1.3398755643e-03    1.5100000000e+02    4.5129008271e-03    1.2400000000e+02   -1.7158301143e-01    1.5500000000e+02    1.8424286629e-01    9.2000000000e+01   -1.4579958165e-01    1.1000000000e+02    1.4436490865e-01    1.9200000000e+02   -1.6386487399e-01    1.3500000000e+02    1.3399753067e-01    1.2200000000e+02   -4.9081473709e+00    1.8000000000e+02    5.6327833938e+00    1.6200000000e+02   -1.2607199389e-08   -3.7087634457e-12   -1.8933533419e-08    4.4528468303e-12
+    2.4374804932e+01    4.6454412905e-03    4.6453993887e-03    4.1901819722e-08    9.0200055931e-06    5.9325814525e-06    4.6395087091e-03   -3.2289795593e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2943839896e-03    1.9800000000e+03   -8.0000000000e+00    2.3451247195e-03    5.6372888383e-06    1.8794089493e-10    1.7956635895e-10    0.0000000000e+00    2.0839783729e-07    8.6527269744e-08   -3.3812577861e-02    1.3400000000e+02    4.4031222461e-02    1.2300000000e+02   -8.6314173484e-05    1.2300000000e+02    8.1552367053e-05    1.5300000000e+02   -1.3661905517e-04    1.0700000000e+02    4.4850099233e-05    1.3500000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.0613948300e-03    1.7800000000e+02   -1.6399492789e-03    1.5000000000e+02    1.3192821051e-03    1.6700000000e+02    4.0580282205e-03    1.1700000000e+02   -1.6730527528e-01    1.4100000000e+02    2.1035483425e-01    1.0300000000e+02   -1.3652911204e-01    1.7500000000e+02    1.6283415215e-01    1.2600000000e+02   -1.2496796984e-01    1.1100000000e+02    1.5032006170e-01    1.1400000000e+02   -5.3170429065e+00    1.5700000000e+02    5.1741432860e+00    1.5200000000e+02   -1.2912669418e-08   -3.0965925170e-12   -1.9377126175e-08    3.3686388809e-12
+    2.4795060189e+01    4.6454490777e-03    4.6453986908e-03    5.0386972665e-08    1.0846564141e-05    5.7181932183e-06    4.6397308845e-03   -3.2987731119e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2943640026e-03    1.9800000000e+03   -8.0000000000e+00    2.3453668819e-03    5.4413430217e-06    1.5023142064e-10    1.9411214035e-10    0.0000000000e+00    1.9617096630e-07    8.0334886715e-08   -3.3645862676e-02    1.4700000000e+02    3.8658419066e-02    1.0600000000e+02   -7.1096656481e-05    8.5000000000e+01    1.0089124104e-04    1.8000000000e+02   -1.0785940661e-04    1.0000000000e+02    7.3119464315e-05    1.5200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.4205643461e-03    1.0000000000e+02   -1.7005827708e-03    1.2800000000e+02    1.1427210093e-03    9.4000000000e+01    3.9253022248e-03    1.4200000000e+02   -1.5795525844e-01    1.4300000000e+02    1.7194867131e-01    1.2100000000e+02   -1.3839007073e-01    1.5600000000e+02    1.5862170004e-01    1.4600000000e+02   -1.6734678872e-01    1.4800000000e+02    1.3715366725e-01    1.1900000000e+02   -4.0349120892e+00    1.2500000000e+02    5.3024376760e+00    1.3600000000e+02   -1.3258116226e-08   -3.1735123219e-12   -1.9729614893e-08    4.5599950854e-12
+    2.5215315447e+01    4.6454391448e-03    4.6453979489e-03    4.1195917444e-08    8.8680493644e-06    6.7892242442e-06    4.6386499206e-03   -3.3729569052e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945536722e-03    1.9800000000e+03   -8.0000000000e+00    2.3440962484e-03    6.5258315692e-06    1.5425677405e-10    1.0901825154e-10    0.0000000000e+00    1.8745860310e-07    7.5670796933e-08   -3.7646693535e-02    1.5700000000e+02    4.2695792216e-02    1.1200000000e+02   -2.7316554777e-05    1.0900000000e+02    1.0063186347e-04    1.8900000000e+02   -6.3635005174e-05    1.3200000000e+02    1.0504347840e-04    1.3500000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.4489879227e-03    1.1000000000e+02   -1.6992715359e-03    1.3900000000e+02    1.0464051656e-03    1.1700000000e+02    3.7749225299e-03    1.3400000000e+02   -1.7312784144e-01    1.0100000000e+02    1.4855785807e-01    1.6200000000e+02   -1.5276938152e-01    1.7800000000e+02    1.4489476277e-01    1.4600000000e+02   -1.4676370950e-01    1.2800000000e+02    1.4451990735e-01    1.0400000000e+02   -4.9157603146e+00    1.1000000000e+02    5.0304020749e+00    1.0900000000e+02   -1.3646487184e-08   -3.3699064696e-12   -2.0083081868e-08    3.1141944624e-12
+    2.5635570704e+01    4.6454298679e-03    4.6453972303e-03    3.2637651138e-08    7.0257520500e-06    6.0758791306e-06    4.6393539888e-03   -3.4448226575e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2949824586e-03    1.9800000000e+03   -8.0000000000e+00    2.3443715301e-03    5.8260046091e-06    2.6918700108e-10    1.2720200509e-10    0.0000000000e+00    1.8176879948e-07    6.7709333044e-08   -3.9032773499e-02    1.3300000000e+02    4.2847179873e-02    1.1200000000e+02   -1.0228459366e-05    1.2200000000e+02    1.3472715424e-04    1.6800000000e+02   -6.9333829334e-05    1.2500000000e+02    1.0110833336e-04    1.3600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.4839874852e-03    1.1200000000e+02   -1.6343367790e-03    1.1200000000e+02    5.4971885041e-04    1.2200000000e+02    3.7019126474e-03    1.5500000000e+02   -1.6829153253e-01    1.2400000000e+02    1.8590929854e-01    1.2000000000e+02   -1.6017107719e-01    1.4300000000e+02    1.6145531681e-01    1.1900000000e+02   -1.4670450058e-01    1.5000000000e+02    1.4140044558e-01    1.1100000000e+02   -5.2636575738e+00    1.1500000000e+02    4.7166861023e+00    1.1400000000e+02   -1.4090356588e-08   -3.4962536359e-12   -2.0357869987e-08    2.5686987999e-12
+    2.6055825962e+01    4.6454251029e-03    4.6453963963e-03    2.8706650389e-08    6.1795442008e-06    4.6410650898e-06    4.6407840378e-03   -3.5282221555e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2953344131e-03    1.9800000000e+03   -8.0000000000e+00    2.3454496247e-03    4.4069185959e-06    2.1210885366e-10    1.9474108421e-10    0.0000000000e+00    1.7385004625e-07    5.9889597789e-08   -3.4922300742e-02    9.8000000000e+01    3.1441257522e-02    1.0500000000e+02   -3.6787983427e-05    7.8000000000e+01    1.1496368427e-04    1.6800000000e+02   -9.3254460875e-05    1.2100000000e+02    9.1935614940e-05    1.0200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.0850653160e-03    1.0400000000e+02   -1.8388826955e-03    7.5000000000e+01    2.0053970025e-04    1.2100000000e+02    3.5725195380e-03    1.0800000000e+02   -1.3627471101e-01    1.6400000000e+02    1.6441221494e-01    1.3000000000e+02   -1.3944629919e-01    1.3400000000e+02    1.5314392871e-01    1.3600000000e+02   -1.6069975769e-01    1.2300000000e+02    1.3629863925e-01    1.4900000000e+02   -4.8115956528e+00    1.6500000000e+02    5.1379378810e+00    1.1600000000e+02   -1.4513262437e-08   -3.2705082024e-12   -2.0768959118e-08    4.0477510645e-12
+    2.6476081219e+01    4.6454291869e-03    4.6453958485e-03    3.3338454554e-08    7.1766106708e-06    3.2499689377e-06    4.6421792180e-03   -3.5830009938e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2954918993e-03    1.9800000000e+03   -8.0000000000e+00    2.3466873187e-03    3.0307945000e-06    1.8913531140e-10    1.3315856263e-10    0.0000000000e+00    1.6645924267e-07    5.2392901170e-08   -3.6346466142e-02    1.3700000000e+02    2.3897270649e-02    1.4900000000e+02   -7.5615177311e-05    7.9000000000e+01    7.8766069514e-05    1.8200000000e+02   -4.5816640457e-05    1.2700000000e+02    1.0769857137e-04    1.4100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.2877001125e-03    1.0400000000e+02   -1.9090500803e-03    1.5900000000e+02    3.0186285234e-04    1.1500000000e+02    3.2603028747e-03    1.1400000000e+02   -1.5906201795e-01    1.0200000000e+02    1.7663492793e-01    1.4200000000e+02   -1.2196546590e-01    1.2100000000e+02    1.5943269481e-01    1.2600000000e+02   -1.5402263047e-01    1.2800000000e+02    1.5488754648e-01    1.4700000000e+02   -4.5469774998e+00    1.4800000000e+02    4.6964090180e+00    9.3000000000e+01   -1.4699330630e-08   -1.1766177360e-12   -2.1130679308e-08    2.9528589103e-12
+    2.6896336476e+01    4.6454282068e-03    4.6453954710e-03    3.2735782489e-08    7.0468763196e-06    2.6158270471e-06    4.6428123797e-03   -3.6207487157e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2954641060e-03    1.9800000000e+03   -8.0000000000e+00    2.3473482737e-03    2.4124175442e-06    1.9025493182e-10    1.6166518850e-10    0.0000000000e+00    1.5758638946e-07    4.5471193279e-08   -3.8807211954e-02    1.2800000000e+02    1.7518308256e-02    1.6700000000e+02   -1.1120376272e-04    1.3600000000e+02    4.4051319872e-05    1.6700000000e+02   -3.5291975942e-06    1.1500000000e+02    1.5732043026e-04    1.4300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.0302037195e-03    9.8000000000e+01   -1.9987263999e-03    1.7100000000e+02    1.4715872081e-04    1.2800000000e+02    3.1952480955e-03    1.3300000000e+02   -1.5332158349e-01    1.4600000000e+02    1.4938807961e-01    1.2200000000e+02   -1.7243313014e-01    1.3700000000e+02    1.6280610460e-01    1.6100000000e+02   -1.4385607048e-01    1.2600000000e+02    1.6517145487e-01    1.3900000000e+02   -4.9600640246e+00    1.7600000000e+02    5.1258350550e+00    1.2400000000e+02   -1.4794423007e-08   -8.3132379812e-13   -2.1413064150e-08    2.4024105820e-12
+    2.7316591734e+01    4.6454361149e-03    4.6453951250e-03    4.0989863699e-08    8.8236931541e-06    3.6374960775e-06    4.6417986188e-03   -3.6553460414e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2954046792e-03    1.9800000000e+03   -8.0000000000e+00    2.3463939397e-03    3.4484862979e-06    1.8698629599e-10    1.5104624600e-10    0.0000000000e+00    1.4842021409e-07    4.0251532972e-08   -3.9003425745e-02    1.3300000000e+02    3.0026293211e-02    1.1200000000e+02   -1.3911742212e-04    1.2400000000e+02    7.6560717921e-06    1.7400000000e+02   -2.1723683037e-06    1.3800000000e+02    1.4454751889e-04    1.6200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.9147901086e-03    9.7000000000e+01   -2.0594979879e-03    1.4300000000e+02   -9.0262892661e-06    1.4100000000e+02    3.1368566636e-03    1.2100000000e+02   -1.7858610671e-01    1.2800000000e+02    1.3975201428e-01    1.4500000000e+02   -1.6888467288e-01    2.0200000000e+02    1.7494418547e-01    1.2100000000e+02   -1.6574019946e-01    1.3400000000e+02    1.2794107008e-01    1.1600000000e+02   -5.2727226044e+00    1.5900000000e+02    4.6064147567e+00    1.2500000000e+02   -1.4873593988e-08   -7.3276904253e-13   -2.1679866426e-08    2.5528598892e-12
+    2.7736846991e+01    4.6454365592e-03    4.6453948343e-03    4.1724837326e-08    8.9819074337e-06    3.9854179947e-06    4.6414511412e-03   -3.6844144381e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2951986221e-03    1.9800000000e+03   -8.0000000000e+00    2.3462525191e-03    3.8063668244e-06    1.6690264506e-10    1.3462599449e-10    0.0000000000e+00    1.4328964355e-07    3.5459998144e-08   -3.4532301055e-02    1.4000000000e+02    3.5651449005e-02    1.3400000000e+02   -1.2887063791e-04    1.2500000000e+02    3.4924048392e-05    1.5300000000e+02   -3.2054240403e-07    1.1700000000e+02    1.5526555643e-04    1.4600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.9928873224e-03    9.5000000000e+01   -2.1460591817e-03    1.6400000000e+02    1.9695283640e-04    1.3100000000e+02    3.1292185836e-03    1.2300000000e+02   -1.5587208860e-01    1.3000000000e+02    1.7160670387e-01    1.4200000000e+02   -1.5853672952e-01    1.3400000000e+02    1.3686527262e-01    1.1400000000e+02   -1.6994420111e-01    1.4500000000e+02    1.5755070392e-01    1.2200000000e+02   -4.7475950996e+00    1.3400000000e+02    4.9778712272e+00    1.4000000000e+02   -1.4974451516e-08   -1.0327930761e-12   -2.1869692866e-08    1.8146385807e-12
+    2.8157102249e+01    4.6454318851e-03    4.6453945533e-03    3.7331779532e-08    8.0362347605e-06    4.5326878417e-06    4.6408991973e-03   -3.7125164057e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2950046808e-03    1.9800000000e+03   -8.0000000000e+00    2.3458945165e-03    4.3641319250e-06    1.1096789439e-10    1.4861637960e-10    0.0000000000e+00    1.3624119952e-07    3.2055132910e-08   -4.0189257303e-02    1.6100000000e+02    3.0263363988e-02    1.2800000000e+02   -1.0079085423e-04    1.2200000000e+02    5.0289099441e-05    1.5300000000e+02   -4.2033748114e-06    9.3000000000e+01    1.3551809858e-04    1.5000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.7990069213e-03    9.5000000000e+01   -1.7916620858e-03    1.3900000000e+02    2.0725351224e-04    1.0800000000e+02    3.2402253403e-03    1.6500000000e+02   -1.6050423035e-01    1.2900000000e+02    1.6671661288e-01    1.6900000000e+02   -1.6739438240e-01    1.1300000000e+02    1.7913389302e-01    1.4200000000e+02   -1.6192112004e-01    1.0800000000e+02    1.4267980263e-01    1.9500000000e+02   -4.5846453027e+00    1.3600000000e+02    4.7308507500e+00    1.6500000000e+02   -1.5072559306e-08   -9.9122540824e-13   -2.2052604751e-08    3.4884566279e-12
+    2.8577357506e+01    4.6454152844e-03    4.6453939571e-03    2.1327286030e-08    4.5910235057e-06    3.9691547007e-06    4.6414461297e-03   -3.7721359128e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2949792477e-03    1.9800000000e+03   -8.0000000000e+00    2.3464668821e-03    3.8105636648e-06    8.2664214855e-11    1.2534817108e-10    0.0000000000e+00    1.2956026919e-07    2.8822754271e-08   -3.6834578498e-02    1.7800000000e+02    2.6112502772e-02    1.3000000000e+02   -7.1794225637e-05    1.3500000000e+02    5.1339518338e-05    1.2800000000e+02   -1.3594142460e-05    8.6000000000e+01    1.2129971376e-04    1.4100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.8331937218e-03    1.0900000000e+02   -1.5406325011e-03    1.1200000000e+02    6.8805820910e-06    1.2600000000e+02    2.9212158912e-03    1.5800000000e+02   -1.6461365270e-01    1.5900000000e+02    1.7641790878e-01    1.4700000000e+02   -1.8495297340e-01    1.0800000000e+02    1.3241358428e-01    1.6800000000e+02   -1.7999468463e-01    9.4000000000e+01    1.7426597869e-01    1.2900000000e+02   -4.4944020149e+00    1.3000000000e+02    4.3000687799e+00    1.4400000000e+02   -1.5213590973e-08   -1.6670362867e-12   -2.2507768155e-08    3.6047787416e-12
+    2.8997612764e+01    4.6454295654e-03    4.6453934886e-03    3.6076874725e-08    7.7660973667e-06    3.7619094327e-06    4.6416676560e-03   -3.8189941109e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2949776817e-03    1.9800000000e+03   -8.0000000000e+00    2.3466899743e-03    3.6169453948e-06    1.5007826500e-10    2.5239826957e-10    0.0000000000e+00    1.1865502651e-07    2.5906534812e-08   -3.4520530963e-02    1.5500000000e+02    2.7011735210e-02    1.2600000000e+02   -9.2562158386e-05    1.4100000000e+02    4.1154279362e-05    1.3700000000e+02   -3.1243300144e-05    1.1100000000e+02    1.3813521641e-04    1.5100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.6583255704e-03    9.6000000000e+01   -1.5577843552e-03    8.1000000000e+01    4.6718085683e-05    9.4000000000e+01    2.5181040943e-03    1.5300000000e+02   -1.5994511139e-01    1.2200000000e+02    2.1400939784e-01    1.6200000000e+02   -1.8364792162e-01    1.1400000000e+02    1.5402251552e-01    1.3300000000e+02   -1.7328326568e-01    1.0400000000e+02    1.5324585283e-01    1.5000000000e+02   -4.7528459834e+00    1.3200000000e+02    4.6132891961e+00    1.3800000000e+02   -1.5364322053e-08   -2.5990233662e-12   -2.2825619056e-08    2.8502195187e-12
+    2.9417868021e+01    4.6454333216e-03    4.6453927777e-03    4.0543912636e-08    8.7276953881e-06    4.5491362672e-06    4.6408841854e-03   -3.8900772711e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2949399582e-03    1.9800000000e+03   -8.0000000000e+00    2.3459442271e-03    4.4199591700e-06    1.4416317076e-10    3.2619386609e-10    0.0000000000e+00    1.0501854833e-07    2.3688191760e-08   -4.2635840175e-02    1.4300000000e+02    2.9485146911e-02    1.4200000000e+02   -1.1790571477e-04    9.7000000000e+01    4.9898365132e-05    1.6600000000e+02    2.4145963306e-05    8.0000000000e+01    1.8572922550e-04    1.6500000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.5326409078e-03    1.0900000000e+02   -1.5749916443e-03    1.4900000000e+02   -8.9929367075e-05    1.6600000000e+02    2.5157072819e-03    1.5100000000e+02   -1.5827627324e-01    1.0400000000e+02    1.6807671546e-01    1.2000000000e+02   -1.5792281718e-01    1.2600000000e+02    1.4348177429e-01    1.2100000000e+02   -1.4731063724e-01    9.5000000000e+01    1.4401387411e-01    9.9000000000e+01   -5.1259184598e+00    8.6000000000e+01    4.7315942599e+00    1.6600000000e+02   -1.5777857654e-08   -4.2917833943e-12   -2.3122915057e-08    2.9091803635e-12
+    2.9838123278e+01    4.6454174976e-03    4.6453920419e-03    2.5455624724e-08    5.4797113563e-06    4.1632208884e-06    4.6412542767e-03   -3.9636549098e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2948190624e-03    1.9800000000e+03   -8.0000000000e+00    2.3464352143e-03    4.0457777132e-06    1.1007526536e-10    3.1515375650e-10    0.0000000000e+00    9.3695210621e-08    2.3322735572e-08   -4.3101439048e-02    1.4300000000e+02    2.8905463959e-02    1.6400000000e+02   -1.0483958505e-04    1.1900000000e+02    3.7191955559e-05    1.5400000000e+02    2.9529254190e-05    1.1900000000e+02    1.9964624608e-04    1.7000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.6196390180e-03    1.0600000000e+02   -1.3571596989e-03    1.1800000000e+02   -1.2720269547e-04    1.7500000000e+02    2.6910807219e-03    1.2100000000e+02   -1.8290130187e-01    1.2800000000e+02    1.5755650966e-01    1.4600000000e+02   -1.6543638387e-01    1.0200000000e+02    1.6270818702e-01    1.4000000000e+02   -1.3579208890e-01    1.5300000000e+02    1.6564512107e-01    1.6700000000e+02   -4.7601818420e+00    1.5100000000e+02    4.4593288243e+00    1.3900000000e+02   -1.6189037832e-08   -3.3178116992e-12   -2.3447511266e-08    2.6674542251e-12
+    3.0258378536e+01    4.6454346962e-03    4.6453913450e-03    4.3351183556e-08    9.3320032575e-06    4.6922894915e-06    4.6407424067e-03   -4.0333506558e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947027367e-03    1.9800000000e+03   -8.0000000000e+00    2.3460396700e-03    4.5855223442e-06    7.8718276302e-11    3.6974847116e-10    0.0000000000e+00    8.3197936106e-08    2.3120744440e-08   -4.9462750819e-02    1.3900000000e+02    2.9339104297e-02    1.1900000000e+02   -1.0081868869e-04    1.3100000000e+02    3.4681146305e-05    1.5100000000e+02    2.9502946407e-05    1.1100000000e+02    2.0867332732e-04    1.5500000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.1755039118e-03    1.3300000000e+02   -1.4155649524e-03    9.9000000000e+01   -1.9712443845e-04    1.4100000000e+02    2.9025181575e-03    8.3000000000e+01   -1.7206380114e-01    1.5500000000e+02    1.6626410697e-01    1.2800000000e+02   -1.5667599714e-01    1.0500000000e+02    1.4622495192e-01    1.3900000000e+02   -1.3640261731e-01    1.4000000000e+02    1.4776760464e-01    1.3800000000e+02   -5.3037394906e+00    1.6700000000e+02    5.1630569267e+00    1.2100000000e+02   -1.6604567460e-08   -5.5196805463e-12   -2.3728939098e-08    2.7280533014e-12
+    3.0678633793e+01    4.6454181188e-03    4.6453903722e-03    2.7746529602e-08    5.9728635619e-06    5.6106856637e-06    4.6398074331e-03   -4.1306246385e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946963041e-03    1.9800000000e+03   -8.0000000000e+00    2.3451111290e-03    5.5111156230e-06    7.3925918444e-11    3.9332574048e-10    0.0000000000e+00    7.6481856141e-08    2.2620932884e-08   -5.1241016511e-02    8.5000000000e+01    2.8611232646e-02    1.2900000000e+02   -7.9610873794e-05    1.0100000000e+02    3.7440864324e-05    1.3200000000e+02    1.9833140614e-05    6.8000000000e+01    1.8528340024e-04    1.7100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.8846535855e-03    1.3100000000e+02   -9.3881728210e-04    1.7200000000e+02   -3.2831876443e-04    1.3800000000e+02    2.5570948799e-03    1.1600000000e+02   -1.7246063064e-01    1.5000000000e+02    1.4380372617e-01    1.2800000000e+02   -1.5942310066e-01    1.2400000000e+02    1.5007446223e-01    1.3900000000e+02   -1.5961164511e-01    1.6700000000e+02    1.7022684131e-01    1.3800000000e+02   -5.1516366699e+00    1.5400000000e+02    4.6010629867e+00    1.1700000000e+02   -1.7259462791e-08   -7.4093915171e-12   -2.4046783594e-08    3.7911402007e-12
+    3.1098889051e+01    4.6454107176e-03    4.6453892346e-03    2.1482951822e-08    4.6245329409e-06    4.4001759971e-06    4.6410105416e-03   -4.2443867990e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2949205272e-03    1.9800000000e+03   -8.0000000000e+00    2.3460900143e-03    4.3055497389e-06    3.7517616310e-11    2.7735482247e-10    0.0000000000e+00    7.2123895147e-08    2.2187490692e-08   -3.8642592928e-02    1.3100000000e+02    2.9129474499e-02    1.2900000000e+02   -5.3006222390e-05    1.1800000000e+02    7.8512019741e-05    1.9800000000e+02   -2.4360274226e-05    1.0700000000e+02    1.3424457131e-04    1.6000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.6416185969e-03    1.4700000000e+02   -5.9785819075e-04    1.1900000000e+02   -4.8624287832e-04    1.2800000000e+02    2.4572934892e-03    1.0500000000e+02   -1.6467416541e-01    1.6200000000e+02    1.6086202159e-01    1.5300000000e+02   -1.5276391323e-01    1.3200000000e+02    1.6101733838e-01    1.1800000000e+02   -1.3757386396e-01    9.5000000000e+01    1.8337540892e-01    7.1000000000e+01   -4.7703548025e+00    1.1600000000e+02    5.2517050097e+00    1.2900000000e+02   -1.7972064344e-08   -6.7292172977e-12   -2.4471803645e-08    5.5859857364e-12
+    3.1519144308e+01    4.6454198647e-03    4.6453882563e-03    3.1608369341e-08    6.8041834492e-06    3.2687081728e-06    4.6421511565e-03   -4.3422181568e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2950173505e-03    1.9800000000e+03   -8.0000000000e+00    2.3471338060e-03    3.1785803428e-06    6.5201589575e-11    2.6618843607e-10    0.0000000000e+00    6.9255254080e-08    2.0541185875e-08   -2.7924481186e-02    1.2200000000e+02    2.8103984719e-02    1.3700000000e+02   -3.6930279499e-05    1.1000000000e+02    1.0635115913e-04    1.5800000000e+02   -8.1732844869e-05    8.6000000000e+01    9.7619059977e-05    1.6000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.2335645903e-03    1.2900000000e+02   -4.4382842871e-04    1.5600000000e+02   -3.1206810170e-04    1.0400000000e+02    2.3877182968e-03    1.3300000000e+02   -1.9539164685e-01    1.0900000000e+02    1.6373412980e-01    1.1400000000e+02   -1.7029278590e-01    1.0300000000e+02    1.3903318269e-01    1.4900000000e+02   -1.2677004069e-01    1.8100000000e+02    1.7117300927e-01    9.3000000000e+01   -4.8534929494e+00    9.0000000000e+01    4.3337392269e+00    1.5600000000e+02   -1.8612136367e-08   -6.3886322196e-12   -2.4810045201e-08    3.2466619205e-12
+    3.1939399566e+01    4.6454034388e-03    4.6453870887e-03    1.6350126343e-08    3.5196139939e-06    3.1072739787e-06    4.6422961648e-03   -4.4589842236e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2951514029e-03    1.9800000000e+03   -8.0000000000e+00    2.3471447619e-03    3.0216773330e-06    6.6776037885e-11    2.3024815739e-10    0.0000000000e+00    6.7876007306e-08    1.7423614203e-08   -2.4385399731e-02    1.1800000000e+02    2.8784784382e-02    1.2200000000e+02   -3.1364363441e-05    9.8000000000e+01    1.2314188255e-04    1.7300000000e+02   -5.5584780279e-05    7.2000000000e+01    9.8558408466e-05    1.3800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.1615540720e-03    1.3600000000e+02   -4.9800283138e-05    1.2700000000e+02   -2.8224206593e-04    1.4100000000e+02    2.1007816972e-03    1.0900000000e+02   -1.6106799460e-01    1.5800000000e+02    1.7150270531e-01    1.2600000000e+02   -1.6629407898e-01    1.1500000000e+02    1.3841480960e-01    1.1800000000e+02   -1.2346595597e-01    1.2300000000e+02    1.6869053929e-01    1.3800000000e+02   -3.5725263365e+00    1.1200000000e+02    3.9913005302e+00    1.7800000000e+02   -1.9483976252e-08   -8.9865070831e-12   -2.5105865984e-08    3.3874175040e-12
+    3.2359654823e+01    4.6454129221e-03    4.6453860569e-03    2.6865260020e-08    5.7831568473e-06    3.6363271674e-06    4.6417765950e-03   -4.5621634209e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2950571394e-03    1.9800000000e+03   -8.0000000000e+00    2.3467194555e-03    3.5491247892e-06    7.5376505844e-11    1.6659736859e-10    0.0000000000e+00    7.0292825538e-08    1.6667578734e-08   -3.7014051818e-02    1.2100000000e+02    2.4393467138e-02    1.7500000000e+02   -8.1210331069e-06    1.1400000000e+02    1.1698191690e-04    1.6500000000e+02   -6.5171709701e-05    1.2200000000e+02    7.6951137806e-05    1.7300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.0306849621e-03    1.2200000000e+02    4.7841398240e-04    1.2500000000e+02   -6.3885027165e-04    1.2500000000e+02    2.0409921201e-03    1.1800000000e+02   -1.3713235412e-01    1.3000000000e+02    1.6413627243e-01    8.2000000000e+01   -1.6021403755e-01    1.3800000000e+02    1.6396988902e-01    1.2000000000e+02   -1.5302344127e-01    1.4500000000e+02    1.7407786802e-01    1.3300000000e+02   -4.8143983479e+00    1.0900000000e+02    4.5296454428e+00    1.5400000000e+02   -2.0343498648e-08   -6.4150864902e-12   -2.5278135561e-08    1.1805341190e-12
+    3.2779910081e+01    4.6454110539e-03    4.6453854143e-03    2.5639551198e-08    5.5193043344e-06    3.5067330066e-06    4.6419043209e-03   -4.6264169406e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2950604398e-03    1.9800000000e+03   -8.0000000000e+00    2.3468438811e-03    3.4208240680e-06    8.9507150364e-11    9.9819916977e-11    0.0000000000e+00    6.9865470890e-08    1.5854140588e-08   -3.9679630363e-02    1.4100000000e+02    2.1004598763e-02    1.2500000000e+02   -1.3916133678e-06    6.7000000000e+01    1.2232067248e-04    1.6300000000e+02   -9.8620470886e-05    7.8000000000e+01    4.0849332846e-05    1.7600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.8632561746e-03    1.4700000000e+02    5.2941759497e-04    1.3000000000e+02   -8.2788494499e-04    1.4600000000e+02    1.7521155895e-03    1.3200000000e+02   -1.6617497588e-01    1.3400000000e+02    1.6303005012e-01    1.6000000000e+02   -1.4841398514e-01    1.5200000000e+02    1.2882188586e-01    1.0500000000e+02   -1.6537811657e-01    1.3000000000e+02    1.6184103882e-01    1.4800000000e+02   -4.4956770677e+00    1.4100000000e+02    4.5044197789e+00    7.4000000000e+01   -2.0807372275e-08   -3.6225614974e-12   -2.5456797131e-08    1.5463139054e-12
+    3.3200165338e+01    4.6454162933e-03    4.6453850204e-03    3.1272853229e-08    6.7319584902e-06    2.3976536281e-06    4.6430186397e-03   -4.6658056884e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2951515117e-03    1.9800000000e+03   -8.0000000000e+00    2.3478671280e-03    2.3154594525e-06    5.9936500872e-11    1.3200636747e-10    0.0000000000e+00    6.6434951417e-08    1.5567281302e-08   -3.3997441769e-02    1.3300000000e+02    1.8200135288e-02    1.4900000000e+02   -2.9419282471e-05    9.7000000000e+01    1.1522512307e-04    1.8400000000e+02   -1.5434758741e-04    1.2400000000e+02   -2.1345198726e-05    1.5800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7348413276e-03    1.3100000000e+02    6.7791476521e-04    1.2800000000e+02   -9.6892137830e-04    1.2400000000e+02    1.9224429188e-03    1.2300000000e+02   -1.6527343384e-01    1.2100000000e+02    1.8641903176e-01    1.5200000000e+02   -1.6069514905e-01    9.3000000000e+01    1.6521430066e-01    1.6500000000e+02   -1.7231354633e-01    1.6900000000e+02    1.5998027922e-01    1.4000000000e+02   -3.5393489217e+00    1.7400000000e+02    4.4125291435e+00    1.3300000000e+02   -2.1058972223e-08   -1.9568722036e-12   -2.5599084662e-08    1.5499903739e-12
+    3.3620420595e+01    4.6454276653e-03    4.6453847550e-03    4.2910240419e-08    9.2370835240e-06    4.1032442945e-06    4.6413244210e-03   -4.6923470744e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2950975205e-03    1.9800000000e+03   -8.0000000000e+00    2.3462269005e-03    4.0273756247e-06    3.5742569962e-11    1.6702700915e-10    0.0000000000e+00    6.0909921287e-08    1.4755979012e-08   -4.2625285776e-02    1.6500000000e+02    2.5990273276e-02    1.8100000000e+02   -6.7212718925e-05    1.5300000000e+02    6.2606507397e-05    1.0100000000e+02   -2.0126496649e-04    1.2900000000e+02   -4.1975268861e-05    1.2800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.4580877118e-03    1.0100000000e+02    4.5550551604e-04    1.5100000000e+02   -9.1060653861e-04    1.0900000000e+02    1.9411096504e-03    1.3300000000e+02   -1.7525948712e-01    1.3700000000e+02    1.8739918433e-01    1.2600000000e+02   -1.4625415481e-01    1.0200000000e+02    1.7379267079e-01    1.4300000000e+02   -1.3762318105e-01    9.9000000000e+01    1.3217344313e-01    1.2900000000e+02   -4.7482839722e+00    1.3700000000e+02    4.6781653404e+00    1.5700000000e+02   -2.1212939846e-08   -8.6558716816e-13   -2.5710530898e-08    6.0510483869e-13
+    3.4040675853e+01    4.6454117947e-03    4.6453846766e-03    2.7118043075e-08    5.8375722542e-06    4.2848081410e-06    4.6411269865e-03   -4.7001872686e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2948006557e-03    1.9800000000e+03   -8.0000000000e+00    2.3463263309e-03    4.2163859477e-06    2.7389158768e-11    2.4604694615e-10    0.0000000000e+00    5.5475630307e-08    1.2673126856e-08   -3.7174483699e-02    1.1100000000e+02    2.0959169007e-02    1.6100000000e+02   -8.6751330786e-05    1.2500000000e+02    5.3452704684e-05    1.1800000000e+02   -2.1424613000e-04    1.4700000000e+02   -4.9639330169e-05    1.1200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6017807942e-03    1.2000000000e+02    8.1828748852e-04    1.5300000000e+02   -6.0011282620e-04    1.1100000000e+02    1.7523406089e-03    1.3100000000e+02   -1.4641350584e-01    1.1300000000e+02    1.8362019680e-01    1.0000000000e+02   -1.4323833393e-01    8.6000000000e+01    1.3368976781e-01    1.6100000000e+02   -1.5163676558e-01    1.3600000000e+02    1.4950490782e-01    1.2600000000e+02   -4.5740652156e+00    1.3600000000e+02    4.4088146711e+00    1.5300000000e+02   -2.1267243984e-08   -2.1966636110e-13   -2.5734628701e-08    5.1252487335e-14
+    3.4460931110e+01    4.6454097899e-03    4.6453846550e-03    2.5134888073e-08    5.4106679018e-06    4.5744225330e-06    4.6408353673e-03   -4.7023498146e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945076684e-03    1.9800000000e+03   -8.0000000000e+00    2.3463276989e-03    4.5110352346e-06    9.5139820196e-12    3.1228479276e-10    0.0000000000e+00    5.0174613031e-08    1.2890886661e-08   -3.9491575612e-02    1.2100000000e+02    2.1538560542e-02    1.3300000000e+02   -4.6910712401e-05    1.2600000000e+02    4.7440172292e-05    1.3700000000e+02   -2.2901953366e-04    1.2000000000e+02   -1.0910215719e-04    1.3800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.4886611820e-03    1.4300000000e+02    6.1283964734e-04    1.5200000000e+02   -6.3093406247e-04    1.2700000000e+02    1.7388771507e-03    1.1000000000e+02   -1.5690470205e-01    1.6100000000e+02    1.6647813242e-01    1.3400000000e+02   -1.5256664400e-01    1.3400000000e+02    1.3851362331e-01    1.1500000000e+02   -1.4995009814e-01    1.7300000000e+02    1.5997989609e-01    1.3600000000e+02   -4.3025723133e+00    8.5000000000e+01    3.7016499302e+00    1.0800000000e+02   -2.1276424264e-08   -5.9622924589e-14   -2.5747073882e-08    8.8298453712e-13
+    3.4881186368e+01    4.6454243266e-03    4.6453845146e-03    3.9811959209e-08    8.5701312525e-06    5.4949112103e-06    4.6399294153e-03   -4.7163897367e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944011899e-03    1.9800000000e+03   -8.0000000000e+00    2.3455282254e-03    5.4387628582e-06    1.2408608159e-11    2.8433482733e-10    0.0000000000e+00    4.3336198542e-08    1.2515410110e-08   -4.4362969899e-02    1.0800000000e+02    3.4544615452e-02    1.5400000000e+02   -4.3495419976e-05    1.5500000000e+02    7.1476290055e-05    1.3500000000e+02   -2.3110456459e-04    1.1900000000e+02   -6.3804036192e-05    1.1100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.6902583370e-03    1.3400000000e+02    3.6610154896e-04    1.6900000000e+02   -7.5925768107e-04    1.6900000000e+02    1.7566544178e-03    1.0900000000e+02   -1.6860067915e-01    1.4200000000e+02    1.9489734874e-01    1.2000000000e+02   -1.6464528551e-01    1.3000000000e+02    1.4809917085e-01    1.2400000000e+02   -1.5547840986e-01    1.1100000000e+02    1.4755251096e-01    1.5300000000e+02   -4.8345148434e+00    1.5600000000e+02    4.5484953166e+00    1.2300000000e+02   -2.1293349726e-08   -9.2832419712e-14   -2.5870547642e-08    2.1564143824e-12
+    3.5301441625e+01    4.6454133332e-03    4.6453843208e-03    2.9012441029e-08    6.2453702985e-06    5.0811316899e-06    4.6403322015e-03   -4.7357737121e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942766639e-03    1.9800000000e+03   -8.0000000000e+00    2.3460555376e-03    5.0309940053e-06    2.5340524141e-11    1.5428810111e-10    0.0000000000e+00    3.8075525536e-08    1.1882530493e-08   -3.5990200686e-02    1.3900000000e+02    3.5781626415e-02    1.7500000000e+02   -7.5108978945e-05    1.1200000000e+02    6.9821736428e-05    1.2100000000e+02   -1.7206404536e-04    1.4000000000e+02    6.3515014139e-06    1.3500000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.5530630014e-03    1.1700000000e+02   -4.7273056609e-05    1.4400000000e+02   -7.6288575661e-04    1.3600000000e+02    1.8528727436e-03    1.2400000000e+02   -1.5601939518e-01    1.3300000000e+02    1.4199389688e-01    1.4000000000e+02   -1.5269848443e-01    1.4400000000e+02    1.4116855489e-01    1.3100000000e+02   -1.7257607568e-01    1.2500000000e+02    1.6585539569e-01    1.2400000000e+02   -4.7595180355e+00    1.6900000000e+02    4.4551170610e+00    1.5000000000e+02   -2.1302968190e-08   -4.7285708596e-13   -2.6054768931e-08    2.9477059823e-12
+    3.5721696883e+01    4.6454073556e-03    4.6453838714e-03    2.3484226006e-08    5.0553377234e-06    3.7212309360e-06    4.6416861247e-03   -4.7807124812e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944049801e-03    1.9800000000e+03   -8.0000000000e+00    2.3472811446e-03    3.6732142558e-06    3.5723309145e-11    1.0505982595e-10    0.0000000000e+00    3.5554366466e-08    1.2321530628e-08   -3.2869526816e-02    1.3400000000e+02    3.3518519758e-02    1.3600000000e+02   -8.7239973147e-05    8.4000000000e+01    6.1993601045e-05    1.8500000000e+02   -1.2686031576e-04    1.5500000000e+02    4.8974408895e-05    1.2400000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7212956977e-03    1.5200000000e+02   -5.2953362954e-05    1.1500000000e+02   -1.0488580048e-03    1.3400000000e+02    1.8187345575e-03    1.3200000000e+02   -1.7259035757e-01    9.9000000000e+01    1.6253582116e-01    1.6600000000e+02   -1.6391692109e-01    1.4300000000e+02    1.5679498438e-01    1.3000000000e+02   -1.4573065186e-01    1.3400000000e+02    1.4229017164e-01    1.4100000000e+02   -4.2764151563e+00    1.3800000000e+02    4.8813417460e+00    1.0500000000e+02   -2.1410940836e-08   -1.6429293276e-12   -2.6396183976e-08    1.8807373406e-12
+    3.6141952140e+01    4.6454077682e-03    4.6453834368e-03    2.4331346193e-08    5.2376932602e-06    2.4674668775e-06    4.6429403013e-03   -4.8241686037e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945369087e-03    1.9800000000e+03   -8.0000000000e+00    2.3484033926e-03    2.4168287510e-06    3.8375411191e-11    1.2071670677e-10    0.0000000000e+00    3.7697659912e-08    1.2781374471e-08   -2.8054101705e-02    1.0300000000e+02    2.7600500137e-02    1.3100000000e+02   -6.7982324865e-05    1.0600000000e+02    6.8171053214e-05    1.5600000000e+02   -9.4910174191e-05    1.3500000000e+02    8.9270120365e-05    1.1200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.0982178340e-03    1.3800000000e+02   -5.8503495204e-04    1.0600000000e+02   -1.0180961675e-03    1.3900000000e+02    1.9994493117e-03    1.4900000000e+02   -1.7945395921e-01    1.0500000000e+02    1.9864093715e-01    1.3000000000e+02   -1.4971930234e-01    1.2100000000e+02    1.3050910338e-01    9.2000000000e+01   -1.2881626696e-01    9.0000000000e+01    1.6231370268e-01    1.6600000000e+02   -4.5159300922e+00    1.2600000000e+02    4.4711763672e+00    1.5400000000e+02   -2.1645472465e-08   -3.1603949943e-12   -2.6596213572e-08    1.6097682344e-12
+    3.6562207398e+01    4.6454308225e-03    4.6453829830e-03    4.7839450650e-08    1.0298171184e-05    3.8933032289e-06    4.6415375192e-03   -4.8695490829e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945917439e-03    1.9800000000e+03   -8.0000000000e+00    2.3469457753e-03    3.8380239592e-06    5.0049641632e-11    9.1489299612e-11    0.0000000000e+00    4.2858087174e-08    1.2279643595e-08   -3.5265208697e-02    1.0800000000e+02    3.2442752866e-02    1.5000000000e+02   -3.9322688979e-05    9.6000000000e+01    1.1700233618e-04    1.3500000000e+02   -8.7983468378e-05    1.1900000000e+02    6.4462958712e-05    1.2000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.0657894790e-03    1.3600000000e+02   -4.7189964630e-04    1.1600000000e+02   -1.1144907165e-03    1.2400000000e+02    1.8325452387e-03    1.4100000000e+02   -1.5947438553e-01    1.2600000000e+02    1.6464365006e-01    1.2100000000e+02   -1.9614826946e-01    1.4300000000e+02    1.6124454141e-01    1.3600000000e+02   -1.3837898112e-01    1.0800000000e+02    1.4717712898e-01    1.2200000000e+02   -4.8595116062e+00    1.3000000000e+02    5.0216743545e+00    1.1200000000e+02   -2.1991655894e-08   -2.7276164561e-12   -2.6703834936e-08    4.2544484742e-13
+    3.6982462655e+01    4.6454064303e-03    4.6453826242e-03    2.3806096277e-08    5.1246252071e-06    5.1822434542e-06    4.6402241869e-03   -4.9054258652e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947000133e-03    1.9800000000e+03   -8.0000000000e+00    2.3455241736e-03    5.1218955586e-06    6.8101896673e-11    9.4821936606e-11    0.0000000000e+00    4.8552711953e-08    1.1632259803e-08   -4.1461890762e-02    1.1300000000e+02    3.5219820518e-02    1.5800000000e+02   -2.5064637788e-05    1.0500000000e+02    1.3326759759e-04    1.4600000000e+02   -8.0658006544e-05    1.9300000000e+02    5.4238904819e-05    1.1400000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.1074202845e-03    1.4900000000e+02   -5.0421840139e-04    9.6000000000e+01   -1.1459725385e-03    1.2300000000e+02    1.8786776441e-03    1.3800000000e+02   -1.8083763012e-01    1.8300000000e+02    1.6561812189e-01    1.5000000000e+02   -1.6280819030e-01    1.6500000000e+02    1.4694468059e-01    1.4800000000e+02   -1.6354587879e-01    9.9000000000e+01    1.3507781701e-01    1.3800000000e+02   -5.0430534297e+00    1.7000000000e+02    4.5259764563e+00    1.2800000000e+02   -2.2279001239e-08   -3.4222723192e-12   -2.6775257413e-08    1.0420827269e-12
+    3.7402717912e+01    4.6454176732e-03    4.6453823169e-03    3.5356238503e-08    7.6109694319e-06    4.2586098670e-06    4.6411590633e-03   -4.9361542810e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2948164654e-03    1.9800000000e+03   -8.0000000000e+00    2.3463425979e-03    4.1947244797e-06    4.5358331013e-11    1.0760972385e-10    0.0000000000e+00    5.1892594884e-08    1.1839824327e-08   -3.2624202970e-02    1.3000000000e+02    3.4425314252e-02    1.2400000000e+02   -3.8024343613e-05    9.8000000000e+01    1.1692683185e-04    1.4200000000e+02   -7.1543609584e-05    1.5500000000e+02    7.3182227141e-05    1.2600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.0667685456e-03    1.3000000000e+02   -3.0640247570e-04    1.3900000000e+02   -1.3097899642e-03    1.2400000000e+02    1.7876806950e-03    1.3100000000e+02   -1.7867632420e-01    1.1000000000e+02    1.4761898982e-01    1.3900000000e+02   -1.5412672642e-01    1.6700000000e+02    1.5688838638e-01    1.2200000000e+02   -1.4894390118e-01    1.0000000000e+02    1.5109165801e-01    9.2000000000e+01   -5.1278285195e+00    1.4100000000e+02    4.9439282367e+00    1.3800000000e+02   -2.2475155818e-08   -1.0370452703e-12   -2.6886386992e-08    1.1064381289e-12
+    3.7822973170e+01    4.6454257747e-03    4.6453821717e-03    4.3602995438e-08    9.3862096046e-06    4.4500403656e-06    4.6409757343e-03   -4.9506812063e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2948622409e-03    1.9800000000e+03   -8.0000000000e+00    2.3461134934e-03    4.3813077918e-06    4.2176612541e-11    2.0829514369e-10    0.0000000000e+00    5.6228851381e-08    1.2253250699e-08   -3.3130016962e-02    1.1400000000e+02    3.9040908326e-02    1.3500000000e+02   -8.6635354165e-05    1.0300000000e+02    5.0373560179e-05    1.3000000000e+02   -3.5659258939e-05    1.4500000000e+02    1.2696271567e-04    1.4000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.9952290466e-03    1.2800000000e+02   -5.3308112159e-04    1.3300000000e+02   -1.5416536843e-03    1.2600000000e+02    1.6684472688e-03    1.6100000000e+02   -1.7355540919e-01    1.3300000000e+02    1.7218189914e-01    1.2900000000e+02   -1.9998694178e-01    1.4800000000e+02    1.5747077727e-01    1.2900000000e+02   -1.4414307824e-01    1.2900000000e+02    1.4822624796e-01    1.8800000000e+02   -5.1269691242e+00    1.1100000000e+02    4.4598750071e+00    1.1400000000e+02   -2.2514359230e-08   -4.0042577466e-13   -2.6992452833e-08    1.0639758710e-12
+    3.8243228427e+01    4.6454133818e-03    4.6453820268e-03    3.1354991744e-08    6.7496400580e-06    4.9839151946e-06    4.6404294666e-03   -4.9651696691e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947481106e-03    1.9800000000e+03   -8.0000000000e+00    2.3456813560e-03    4.9076922999e-06    4.7168505354e-11    1.9773431598e-10    0.0000000000e+00    6.2662268521e-08    1.3315723381e-08   -3.2383979665e-02    1.1800000000e+02    4.0981455014e-02    1.3200000000e+02   -1.2154473210e-04    1.0200000000e+02    4.8503936305e-05    1.1800000000e+02    2.0894188345e-06    1.5600000000e+02    1.5928939081e-04    1.1900000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.1038365952e-03    1.4100000000e+02   -6.7314096221e-04    1.1800000000e+02   -1.8090657459e-03    1.2100000000e+02    1.4029515282e-03    1.3400000000e+02   -1.5318874388e-01    1.4200000000e+02    1.5274347489e-01    1.7500000000e+02   -1.8750079221e-01    1.2500000000e+02    1.7095077034e-01    1.3700000000e+02   -1.3890853318e-01    1.2200000000e+02    1.5841485107e-01    1.6000000000e+02   -4.0974138348e+00    1.4400000000e+02    4.9970180478e+00    1.4700000000e+02   -2.2573542201e-08   -4.0146212255e-13   -2.7078154490e-08    3.3703304646e-13
+    3.8663483685e+01    4.6454143646e-03    4.6453819333e-03    3.2431387804e-08    6.9813507224e-06    5.7843120470e-06    4.6396300526e-03   -4.9745234809e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946287675e-03    1.9800000000e+03   -8.0000000000e+00    2.3450012851e-03    5.7010885314e-06    9.8421737272e-11    2.1175044423e-10    0.0000000000e+00    7.0696634568e-08    1.2216708912e-08   -3.6025161777e-02    9.8000000000e+01    4.5447598596e-02    1.1900000000e+02   -1.1078583044e-04    1.2800000000e+02    8.7097601979e-05    1.8400000000e+02   -3.3575782149e-06    1.7400000000e+02    1.7152444278e-04    1.0500000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.3937699730e-03    1.1400000000e+02   -7.6015994698e-04    1.2600000000e+02   -1.7683800223e-03    1.4100000000e+02    1.6515092091e-03    1.1900000000e+02   -1.5466327846e-01    1.2800000000e+02    1.9979243490e-01    1.4600000000e+02   -1.7142843551e-01    1.2700000000e+02    1.3444432595e-01    1.0500000000e+02   -1.4993698918e-01    1.6200000000e+02    1.4484368855e-01    1.3400000000e+02   -5.3824900685e+00    1.5100000000e+02    4.9351177898e+00    1.0000000000e+02   -2.2609723013e-08   -2.7228295615e-13   -2.7135511796e-08    4.7922564347e-13
+    3.9083738942e+01    4.6454127124e-03    4.6453817892e-03    3.0923265087e-08    6.6567043123e-06    4.8662688038e-06    4.6405464436e-03   -4.9889331962e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2946009239e-03    1.9800000000e+03   -8.0000000000e+00    2.3459455197e-03    4.7702597815e-06    5.8486175009e-11    2.2885193488e-10    0.0000000000e+00    8.3805324693e-08    1.1916359492e-08   -4.1286897644e-02    9.9000000000e+01    3.3880798653e-02    1.3400000000e+02   -5.1591405980e-05    1.4000000000e+02    1.1156565689e-04    1.6000000000e+02   -1.0786902497e-05    1.5700000000e+02    1.6046376717e-04    9.7000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.5996964389e-03    1.4500000000e+02   -5.7508120335e-04    1.3800000000e+02   -1.8035670358e-03    1.1800000000e+02    1.6264404056e-03    1.4200000000e+02   -1.3331156755e-01    1.4100000000e+02    1.6638640367e-01    7.6000000000e+01   -1.9542837244e-01    1.4000000000e+02    1.5672858912e-01    1.0900000000e+02   -1.5713111204e-01    1.4400000000e+02    1.4214675711e-01    1.4500000000e+02   -4.2712024883e+00    1.4600000000e+02    5.2471982047e+00    1.5700000000e+02   -2.2668533468e-08   -8.5725074974e-13   -2.7220798494e-08    1.3400332735e-12
+    3.9503994200e+01    4.6454112918e-03    4.6453815427e-03    2.9749119759e-08    6.4039516277e-06    5.0231561918e-06    4.6403881356e-03   -5.0135801438e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947208154e-03    1.9800000000e+03   -8.0000000000e+00    2.3456673203e-03    4.9132622039e-06    1.1414424119e-10    2.5586310595e-10    0.0000000000e+00    9.7739581666e-08    1.1784398949e-08   -4.9781675960e-02    1.4500000000e+02    3.2473138091e-02    1.1400000000e+02   -1.8334891699e-05    7.0000000000e+01    1.0936266390e-04    1.2900000000e+02   -1.2015725756e-05    1.3900000000e+02    1.3940424281e-04    1.2200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.8223802951e-03    1.6300000000e+02   -5.2922586339e-04    1.4900000000e+02   -1.5747579455e-03    1.5500000000e+02    1.6334559629e-03    1.4600000000e+02   -1.4446196648e-01    1.5900000000e+02    1.6508811467e-01    1.2800000000e+02   -1.5464518632e-01    1.3900000000e+02    1.3502335651e-01    1.4100000000e+02   -1.7775618025e-01    1.5600000000e+02    1.5217291321e-01    1.4400000000e+02   -4.2022807640e+00    1.8100000000e+02    4.7882210915e+00    1.2500000000e+02   -2.2763272698e-08   -1.1578422322e-12   -2.7372528740e-08    2.1007765563e-12
+    3.9924249457e+01    4.6454091615e-03    4.6453810363e-03    2.8125214697e-08    6.0543813027e-06    3.8569011219e-06    4.6415522604e-03   -5.0642177247e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947801371e-03    1.9800000000e+03   -8.0000000000e+00    2.3467721233e-03    3.7374096869e-06    1.3880177052e-10    2.4097127261e-10    0.0000000000e+00    1.0850104518e-07    1.0610616800e-08   -3.9396575892e-02    1.4400000000e+02    3.1476337394e-02    1.1800000000e+02   -2.3382962092e-06    1.1500000000e+02    1.4710188003e-04    1.2900000000e+02   -3.1465513724e-05    1.7600000000e+02    1.1468737812e-04    1.0000000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.8330521843e-03    1.3600000000e+02   -8.9315573217e-04    1.6900000000e+02   -1.3009762263e-03    1.3200000000e+02    1.6867416243e-03    1.5000000000e+02   -1.7306099341e-01    1.0500000000e+02    1.6824435719e-01    9.5000000000e+01   -1.3358373953e-01    1.4400000000e+02    1.4360815240e-01    1.4200000000e+02   -1.3906651828e-01    1.8200000000e+02    1.5856546662e-01    1.5300000000e+02   -4.8038869624e+00    1.5200000000e+02    4.3930351443e+00    1.3100000000e+02   -2.2917910599e-08   -2.0424482294e-12   -2.7724266648e-08    3.9240239705e-12
+    4.0344504715e+01    4.6454113231e-03    4.6453803061e-03    3.1017065485e-08    6.6768962784e-06    3.7883694144e-06    4.6416229537e-03   -5.1372413031e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2947395560e-03    1.9800000000e+03   -8.0000000000e+00    2.3468833978e-03    3.6570577543e-06    1.3678492717e-10    2.6277883276e-10    0.0000000000e+00    1.1937307455e-07    1.1539021836e-08   -3.7052897185e-02    1.4900000000e+02    3.4554420453e-02    1.2900000000e+02   -2.5798993668e-05    1.3700000000e+02    1.5426050424e-04    1.1400000000e+02   -2.9013598346e-05    1.6100000000e+02    1.3491477184e-04    1.0100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.0449428975e-03    1.3700000000e+02   -9.7916727324e-04    1.4800000000e+02   -1.0022484336e-03    1.2000000000e+02    1.7258425123e-03    1.4200000000e+02   -1.5895605562e-01    1.1800000000e+02    1.5669024525e-01    1.2600000000e+02   -1.5304965675e-01    1.2200000000e+02    1.5790731268e-01    1.2300000000e+02   -1.3708790088e-01    1.4200000000e+02    1.6861639457e-01    1.0500000000e+02   -4.4293054175e+00    1.0400000000e+02    4.0583678892e+00    1.1600000000e+02   -2.3099858908e-08   -1.9380034290e-12   -2.8272554123e-08    6.4262423849e-12
+    4.0764759972e+01    4.6454198616e-03    4.6453791783e-03    4.0683299243e-08    8.7577004806e-06    5.0989689746e-06    4.6403208926e-03   -5.2500233957e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945856042e-03    1.9800000000e+03   -8.0000000000e+00    2.3457352884e-03    4.9506092726e-06    1.2282889570e-10    3.3320397650e-10    0.0000000000e+00    1.3092821548e-07    1.6975453611e-08   -3.3492684945e-02    1.3200000000e+02    4.7264927526e-02    1.5000000000e+02   -2.4378639078e-05    1.5100000000e+02    1.4786134596e-04    1.1600000000e+02   -6.1862266428e-05    2.0100000000e+02    1.1547286446e-04    9.7000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.3721436019e-03    1.1100000000e+02   -1.3127167459e-03    1.2600000000e+02   -1.0343333011e-03    1.2900000000e+02    1.7833392787e-03    1.5400000000e+02   -1.6567513734e-01    1.1700000000e+02    1.5545340600e-01    1.6000000000e+02   -1.7326693727e-01    1.5700000000e+02    1.5049876108e-01    1.3200000000e+02   -1.3241412495e-01    1.6600000000e+02    1.6719244541e-01    1.3600000000e+02   -5.0199484426e+00    1.7900000000e+02    4.6896452307e+00    1.7500000000e+02   -2.3427559484e-08   -4.5623708903e-12   -2.9072674473e-08    1.0541393151e-11
+    4.1185015229e+01    4.6454100928e-03    4.6453776585e-03    3.2434233418e-08    6.9819632841e-06    5.2317888561e-06    4.6401783039e-03   -5.4019946736e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945860182e-03    1.9800000000e+03   -8.0000000000e+00    2.3455922857e-03    5.0676427548e-06    1.0553755344e-10    4.0079059942e-10    0.0000000000e+00    1.4203095974e-07    2.1608813448e-08   -3.1987082410e-02    1.2400000000e+02    4.9069693794e-02    1.4800000000e+02   -3.6607569803e-05    1.2700000000e+02    1.2573334119e-04    1.4400000000e+02   -5.6378618725e-05    1.7000000000e+02    1.1437072454e-04    6.1000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.6765280602e-03    1.3400000000e+02   -1.6653341823e-03    1.5200000000e+02   -1.1378576111e-03    1.6700000000e+02    1.9190379195e-03    1.4700000000e+02   -1.6992103337e-01    1.6700000000e+02    1.7340364804e-01    1.1700000000e+02   -1.6244694183e-01    1.2900000000e+02    1.4630995969e-01    1.4100000000e+02   -1.2849697517e-01    1.2800000000e+02    1.5867649028e-01    8.7000000000e+01   -4.8782415984e+00    1.4800000000e+02    4.6605429087e+00    1.1300000000e+02   -2.3919849247e-08   -5.6552572401e-12   -3.0100097489e-08    1.0778268058e-11
+    4.1605270487e+01    4.6453962108e-03    4.6453758655e-03    2.0345236476e-08    4.3796223655e-06    4.3266697620e-06    4.6410695410e-03   -5.5812949934e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944468305e-03    1.9800000000e+03   -8.0000000000e+00    2.3466227105e-03    4.1415282577e-06    3.4864234328e-11    4.6945936387e-10    0.0000000000e+00    1.5761635737e-07    2.7020823407e-08   -2.1830010395e-02    1.1800000000e+02    4.4925378295e-02    1.1000000000e+02   -6.8475241771e-05    1.3700000000e+02    8.7690709882e-05    1.2100000000e+02   -1.0391819570e-04    1.8300000000e+02    5.9493013738e-05    5.4000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.0934536496e-03    1.4500000000e+02   -1.8252263170e-03    1.6700000000e+02   -7.9795096189e-04    1.1500000000e+02    2.0979373957e-03    1.4300000000e+02   -1.9977554445e-01    1.0900000000e+02    2.0973339810e-01    1.2700000000e+02   -1.7176425623e-01    1.4100000000e+02    1.5989291646e-01    1.5400000000e+02   -1.5790520586e-01    1.3300000000e+02    1.8197581834e-01    1.1200000000e+02   -4.9315399981e+00    1.1900000000e+02    4.6943220615e+00    1.7100000000e+02   -2.4618614763e-08   -1.0636639852e-11   -3.1194335170e-08    1.1027715978e-11
+    4.2025525744e+01    4.6454073979e-03    4.6453739041e-03    3.3493825860e-08    7.2100567135e-06    3.3835235712e-06    4.6420238744e-03   -5.7774395836e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2940978196e-03    1.9800000000e+03   -8.0000000000e+00    2.3479260548e-03    3.1824585938e-06    5.6911640231e-11    5.2633788466e-10    0.0000000000e+00    1.7015278059e-07    3.0328947276e-08   -2.5334483583e-02    1.0500000000e+02    3.6551931795e-02    1.1000000000e+02   -1.0826084182e-04    1.6500000000e+02    3.8543134904e-05    1.5400000000e+02   -1.7875016568e-04    1.7900000000e+02   -2.7527590618e-06    6.9000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.9888729460e-03    1.5500000000e+02   -2.1424468640e-03    1.5700000000e+02   -9.5617665905e-04    1.2900000000e+02    2.2164070212e-03    1.3800000000e+02   -1.3639110725e-01    1.2600000000e+02    1.9351108358e-01    1.2600000000e+02   -1.3168339907e-01    1.0100000000e+02    1.8509935433e-01    1.3200000000e+02   -1.2547716214e-01    1.8300000000e+02    1.4392266107e-01    1.2900000000e+02   -5.6322654154e+00    1.2300000000e+02    4.7752606047e+00    1.0600000000e+02   -2.5691631384e-08   -7.2061590767e-12   -3.2082764453e-08    7.3854167653e-12
+    4.2445781002e+01    4.6454072144e-03    4.6453722381e-03    3.4976279444e-08    7.5291774510e-06    3.7849881334e-06    4.6416222263e-03   -5.9440349825e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2937225900e-03    1.9800000000e+03   -8.0000000000e+00    2.3478996363e-03    3.5653283279e-06    1.1620361316e-10    7.2032014471e-10    0.0000000000e+00    1.8959596603e-07    2.9227315631e-08   -3.0539838089e-02    1.2000000000e+02    3.9741236346e-02    7.3000000000e+01   -1.6607062226e-04    1.8800000000e+02   -5.0489479390e-06    1.6100000000e+02   -2.3557227800e-04    1.6700000000e+02   -5.4024732559e-05    6.1000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.2701523077e-03    1.4200000000e+02   -2.3637789223e-03    1.3300000000e+02   -1.1621420264e-03    1.4800000000e+02    2.2873760944e-03    1.6500000000e+02   -1.5497408058e-01    1.3600000000e+02    1.4646051749e-01    1.4000000000e+02   -1.4401147058e-01    1.3700000000e+02    1.6884177810e-01    1.6900000000e+02   -1.3518719291e-01    1.2700000000e+02    1.3810448576e-01    1.3900000000e+02   -4.7377680831e+00    1.3300000000e+02    5.3196873331e+00    1.2700000000e+02   -2.6589307477e-08   -1.0396344167e-11   -3.2851042348e-08    1.0531704912e-11
+    4.2866036259e+01    4.6453952365e-03    4.6453704671e-03    2.4769359587e-08    5.3319823218e-06    4.1418369324e-06    4.6412533996e-03   -6.1211368012e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2935238074e-03    1.9800000000e+03   -8.0000000000e+00    2.3477295922e-03    3.9050057368e-06    1.7132194561e-10    5.7357243853e-10    0.0000000000e+00    2.1079416704e-07    2.5292134166e-08   -2.9529028197e-02    1.2000000000e+02    3.6970971196e-02    1.2100000000e+02   -1.9336445709e-04    1.3100000000e+02   -2.8698253038e-05    1.6600000000e+02   -2.1076335418e-04    1.5200000000e+02   -5.6097010503e-05    6.8000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.8564015459e-03    1.4000000000e+02   -2.6797324650e-03    1.2800000000e+02   -1.1572649254e-03    1.7800000000e+02    2.3659694725e-03    1.4700000000e+02   -1.7813347296e-01    1.3500000000e+02    1.7907710199e-01    1.1700000000e+02   -1.5371853598e-01    1.1300000000e+02    1.7143219595e-01    1.2400000000e+02   -1.3021436418e-01    1.4200000000e+02    1.5000415947e-01    1.1800000000e+02   -4.3228546681e+00    1.4300000000e+02    4.5906350076e+00    1.2200000000e+02   -2.7359062220e-08   -5.7281436387e-12   -3.3852305792e-08    6.6428195651e-12
+    4.3286291517e+01    4.6454127292e-03    4.6453691318e-03    4.3597374086e-08    9.3849995228e-06    4.5988579991e-06    4.6408138712e-03   -6.2546706683e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2933724542e-03    1.9800000000e+03   -8.0000000000e+00    2.3474414170e-03    4.3456445418e-06    2.1714194042e-10    4.5918249974e-10    0.0000000000e+00    2.3261068339e-07    1.9926449506e-08   -2.8940066901e-02    1.0900000000e+02    4.4886402007e-02    1.2700000000e+02   -1.9701651810e-04    8.6000000000e+01   -2.8164620814e-05    1.7900000000e+02   -1.6410758835e-04    2.2100000000e+02   -2.6043991178e-05    9.2000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.3537063541e-03    1.6700000000e+02   -2.8019727114e-03    1.2400000000e+02   -1.1667637363e-03    9.9000000000e+01    2.1483574123e-03    1.4200000000e+02   -1.7697024116e-01    1.2600000000e+02    1.6137371316e-01    1.5000000000e+02   -1.4212689785e-01    1.0900000000e+02    1.6260369747e-01    1.1900000000e+02   -1.5682796258e-01    1.5900000000e+02    1.6720917044e-01    1.3000000000e+02   -4.4420834237e+00    1.6700000000e+02    4.5616548604e+00    6.5000000000e+01   -2.7919863002e-08   -5.6031594192e-12   -3.4626843682e-08    8.2146293935e-12
+    4.3706546774e+01    4.6454044398e-03    4.6453679112e-03    3.6528578146e-08    7.8633334153e-06    5.7324137231e-06    4.6396720261e-03   -6.3767263765e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2932970707e-03    1.9800000000e+03   -8.0000000000e+00    2.3463749554e-03    5.4633313777e-06    1.5681337245e-10    3.0200748541e-10    0.0000000000e+00    2.5115417152e-07    1.7469353024e-08   -3.5806444091e-02    1.7200000000e+02    4.6553710072e-02    1.2700000000e+02   -1.7771315291e-04    1.3200000000e+02   -3.4309574111e-05    1.9300000000e+02   -1.0261832681e-04    1.5400000000e+02    3.5327493469e-05    5.6000000000e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.6249763488e-03    1.6500000000e+02   -2.9632933811e-03    1.4200000000e+02   -1.3910179920e-03    1.3700000000e+02    1.9909978399e-03    1.2600000000e+02   -1.6106558951e-01    1.3700000000e+02    1.5810801217e-01    1.2800000000e+02   -1.5906607088e-01    1.3100000000e+02    1.5400156106e-01    1.5000000000e+02   -1.4902952733e-01    1.3600000000e+02    1.4242925549e-01    1.2700000000e+02   -4.5466287346e+00    1.3800000000e+02    5.2056209247e+00    1.1800000000e+02   -2.8388002319e-08   -2.7518412160e-12   -3.5379261446e-08    6.3885573021e-12
+    4.4126802032e+01    4.6453943484e-03    4.6453672020e-03    2.7146404941e-08    5.8436775782e-06    4.6696409565e-06    4.6407247075e-03   -6.4476489181e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2934649793e-03    1.9800000000e+03   -8.0000000000e+00    2.3472597282e-03    4.3799743396e-06    1.5999895963e-10    3.1482957645e-10    0.0000000000e+00    2.7240370100e-07    1.6788087358e-08   -3.8645213572e-02    1.5100000000e+02    3.0414082377e-02    1.1900000000e+02   -1.7729572077e-04    9.5000000000e+01   -2.1111373332e-05    1.4500000000e+02   -6.2690425327e-05    1.7600000000e+02    1.0415699790e-04    1.0300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.6893649805e-03    1.5200000000e+02   -2.8633448704e-03    1.1900000000e+02   -1.6307675910e-03    1.3500000000e+02    1.7920000402e-03    1.3300000000e+02   -1.6612200622e-01    1.2700000000e+02    1.6583215558e-01    1.2300000000e+02   -1.7645543524e-01    1.0300000000e+02    1.5441140036e-01    1.2900000000e+02   -1.7197968928e-01    1.3200000000e+02    1.5034412035e-01    1.2300000000e+02   -4.2091874597e+00    1.2500000000e+02    4.6302478335e+00    1.3700000000e+02   -2.8673709693e-08   -2.3304015323e-12   -3.5802779488e-08    3.8977719136e-12
+    4.4547057289e+01    4.6454149792e-03    4.6453666960e-03    4.8283218764e-08    1.0393699037e-05    5.3824395639e-06    4.6400325397e-03   -6.4982490893e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2935327665e-03    1.9800000000e+03   -8.0000000000e+00    2.3464997732e-03    5.0733237360e-06    1.3269608722e-10    2.3494364883e-10    0.0000000000e+00    2.9187039203e-07    1.6877796115e-08   -3.9581379225e-02    1.4100000000e+02    3.1441070839e-02    1.5000000000e+02   -1.4884920745e-04    1.4400000000e+02    1.7549658196e-05    1.1700000000e+02   -4.5460455266e-05    1.4900000000e+02    1.3622624640e-04    1.0300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.5579847225e-03    1.3700000000e+02   -3.1055638024e-03    1.3700000000e+02   -1.6546182766e-03    1.5200000000e+02    1.7151803562e-03    1.5300000000e+02   -1.4274539206e-01    1.5500000000e+02    1.8812378520e-01    1.5000000000e+02   -1.6987949344e-01    1.0600000000e+02    1.5780935908e-01    1.2300000000e+02   -1.4675093904e-01    1.3700000000e+02    1.4294196553e-01    1.3200000000e+02   -4.5460361277e+00    1.0200000000e+02    4.7014140970e+00    1.2000000000e+02   -2.8915801460e-08   -2.1887089337e-12   -3.6066689432e-08    7.9721809458e-13
+    4.4967312546e+01    4.6454051264e-03    4.6453664444e-03    3.8681917064e-08    8.3268724503e-06    6.1460382481e-06    4.6392590881e-03   -6.5234045723e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2937058281e-03    1.9800000000e+03   -8.0000000000e+00    2.3455532601e-03    5.8199501147e-06    4.6775814174e-11    1.1929338051e-10    0.0000000000e+00    3.0705881986e-07    1.8863244338e-08   -4.3767072992e-02    1.3800000000e+02    3.6393323058e-02    1.5900000000e+02   -9.9217646070e-05    1.2900000000e+02    3.5437516630e-05    1.4200000000e+02   -4.0575643165e-05    1.7200000000e+02    1.1266384735e-04    1.2100000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.9870644990e-03    1.2300000000e+02   -3.2422009468e-03    1.4800000000e+02   -2.0730271617e-03    1.2200000000e+02    1.9245917175e-03    1.5800000000e+02   -1.5457813734e-01    1.3500000000e+02    1.8885040462e-01    1.6900000000e+02   -1.8715002255e-01    1.2100000000e+02    1.5061090561e-01    1.8200000000e+02   -1.8352623194e-01    1.3900000000e+02    1.3701063754e-01    1.3900000000e+02   -5.5661439601e+00    1.0200000000e+02    5.0867045630e+00    1.2100000000e+02   -2.9104927360e-08   -1.2451677148e-12   -3.6129118364e-08    3.1899189351e-13
+    4.5387567804e+01    4.6453952907e-03    4.6453663207e-03    2.8969993919e-08    6.2362329109e-06    4.7422072611e-06    4.6406530834e-03   -6.5357823417e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2938762651e-03    1.9800000000e+03   -8.0000000000e+00    2.3467768183e-03    4.4050010305e-06    6.3477646166e-11    1.2983879668e-10    0.0000000000e+00    3.2058219668e-07    1.6430717509e-08   -3.3674273842e-02    1.1800000000e+02    3.5286997875e-02    1.4900000000e+02   -8.0674470965e-05    1.2900000000e+02    6.2266126504e-05    1.5000000000e+02   -6.3544633322e-05    1.2800000000e+02    8.7973008271e-05    1.0600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.2822696794e-03    1.3200000000e+02   -3.4526906594e-03    9.5000000000e+01   -1.6946851282e-03    1.3400000000e+02    1.8353375390e-03    1.4800000000e+02   -1.5028497784e-01    1.3700000000e+02    1.9501737442e-01    1.1400000000e+02   -1.4099413705e-01    8.4000000000e+01    1.6813101945e-01    1.3900000000e+02   -1.3142670452e-01    1.6500000000e+02    1.4601784194e-01    1.3100000000e+02   -4.5267980300e+00    1.4300000000e+02    4.5302812641e+00    1.2000000000e+02   -2.9186937911e-08   -6.8472884982e-13   -3.6170885506e-08    4.2331782498e-13
+    4.5807823061e+01    4.6454015178e-03    4.6453662483e-03    3.5269423461e-08    7.5922811703e-06    4.5179622193e-06    4.6408835556e-03   -6.5430145452e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2938919298e-03    1.9800000000e+03   -8.0000000000e+00    2.3469916258e-03    4.1679657372e-06    7.3280287785e-11    1.0142183037e-10    0.0000000000e+00    3.3675864602e-07    1.3063133900e-08   -3.1244675836e-02    1.1700000000e+02    3.6916763424e-02    1.1600000000e+02   -9.6446722850e-05    1.2200000000e+02    7.5098624032e-05    1.0400000000e+02   -5.4025862658e-05    1.4400000000e+02    8.9419429443e-05    1.0900000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.2605091966e-03    1.0400000000e+02   -3.3366125400e-03    1.4100000000e+02   -1.5079021342e-03    1.2900000000e+02    1.4305851770e-03    1.3400000000e+02   -1.7981843439e-01    8.4000000000e+01    1.6611976082e-01    1.2400000000e+02   -1.4642623545e-01    1.1500000000e+02    1.5923023467e-01    1.2800000000e+02   -1.3534445863e-01    1.4800000000e+02    1.4710758438e-01    1.6000000000e+02   -5.2047677670e+00    1.3400000000e+02    3.9609870449e+00    1.2500000000e+02   -2.9235180101e-08   -5.1572037385e-13   -3.6194965351e-08    1.3468343257e-13
+    4.6228078319e+01    4.6454082299e-03    4.6453662016e-03    4.2028387539e-08    9.0472512455e-06    3.7433688661e-06    4.6416648611e-03   -6.5476938455e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2939006286e-03    1.9800000000e+03   -8.0000000000e+00    2.3477642324e-03    3.3803616111e-06    4.5598968390e-11    8.5801625152e-11    0.0000000000e+00    3.5176202646e-07    1.1113827934e-08   -3.4092548307e-02    1.1000000000e+02    3.2219197247e-02    1.0500000000e+02   -7.0370518579e-05    1.4100000000e+02    8.0300334403e-05    1.3700000000e+02   -7.8750477036e-05    1.2800000000e+02    8.0390731382e-05    1.1600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.2361964166e-03    1.4300000000e+02   -3.1379394199e-03    1.4400000000e+02   -1.5658960500e-03    1.4400000000e+02    1.5576260607e-03    1.4400000000e+02   -1.8961173303e-01    1.2200000000e+02    1.5805155147e-01    9.5000000000e+01   -1.5357623415e-01    1.1300000000e+02    1.4975537731e-01    7.8000000000e+01   -1.3799495917e-01    1.2800000000e+02    1.6060369674e-01    1.1000000000e+02   -5.3201529403e+00    1.1000000000e+02    5.0207801599e+00    1.1900000000e+02   -2.9275594752e-08   -4.2516482538e-13   -3.6201343702e-08    8.4371943340e-14
+    4.6648333576e+01    4.6454080071e-03    4.6453660603e-03    4.1946744723e-08    9.0296763844e-06    4.7384965523e-06    4.6406695105e-03   -6.5618156960e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2939646230e-03    1.9800000000e+03   -8.0000000000e+00    2.3467048875e-03    4.3691884309e-06    7.3232917287e-11    4.5433801166e-11    0.0000000000e+00    3.5831542724e-07    1.0874027418e-08   -4.0674774146e-02    1.1200000000e+02    3.7280126908e-02    1.6100000000e+02   -5.8765529328e-05    1.1400000000e+02    1.0228782791e-04    9.9000000000e+01   -7.6471282071e-05    1.5800000000e+02    6.7627561080e-05    1.8700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.8438270356e-03    1.5800000000e+02   -3.0865150227e-03    1.0200000000e+02   -1.1967043177e-03    1.3200000000e+02    1.7490201240e-03    1.3000000000e+02   -1.7040596329e-01    1.4800000000e+02    1.7839054869e-01    1.0000000000e+02   -1.5931183423e-01    1.4600000000e+02    1.4970657081e-01    1.0000000000e+02   -1.3657052976e-01    1.4900000000e+02    1.4558351731e-01    1.0900000000e+02   -5.9019498631e+00    1.2500000000e+02    4.1527460797e+00    1.2500000000e+02   -2.9390710683e-08   -1.3524926005e-12   -3.6227446277e-08    3.8898885753e-13
+    4.7068588834e+01    4.6454098717e-03    4.6453658642e-03    4.4007532443e-08    9.4732923630e-06    5.9203227751e-06    4.6394895489e-03   -6.5814308663e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941007331e-03    1.9800000000e+03   -8.0000000000e+00    2.3453888158e-03    5.5428346786e-06    4.7180260760e-11    3.1633199961e-11    0.0000000000e+00    3.6364529627e-07    1.3763986724e-08   -4.3507441181e-02    1.1100000000e+02    3.9209442149e-02    1.2300000000e+02   -6.5369605277e-05    1.2200000000e+02    8.9350842577e-05    8.3000000000e+01   -4.6896486721e-05    1.3500000000e+02    6.4335140305e-05    1.1700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.7223008981e-03    1.5500000000e+02   -3.3032454283e-03    1.1200000000e+02   -1.5251926576e-03    1.1100000000e+02    1.9592704014e-03    1.4300000000e+02   -1.9739614556e-01    1.1800000000e+02    1.9550725775e-01    1.6900000000e+02   -1.5883163232e-01    1.1400000000e+02    1.6743727436e-01    8.7000000000e+01   -1.3193228793e-01    1.7100000000e+02    1.1267123171e-01    1.7400000000e+02   -5.5326749782e+00    9.6000000000e+01    4.8977325041e+00    1.5600000000e+02   -2.9565115884e-08   -1.0024134421e-12   -3.6249192779e-08    1.8640451231e-13
+    4.7488844091e+01    4.6453924782e-03    4.6453657283e-03    2.6749957957e-08    5.7583363202e-06    5.9138068470e-06    4.6394786714e-03   -6.5950204796e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2941881330e-03    1.9800000000e+03   -8.0000000000e+00    2.3452905384e-03    5.5353428136e-06    5.4476193443e-11    3.8907906520e-11    0.0000000000e+00    3.6337195359e-07    1.4998695734e-08   -3.6811581830e-02    1.1200000000e+02    4.4705667650e-02    1.2500000000e+02   -2.2375372492e-05    1.1600000000e+02    1.1939556654e-04    1.0800000000e+02   -4.9614852497e-05    9.7000000000e+01    8.6751568822e-05    1.6300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.8013672094e-03    1.3200000000e+02   -3.1255219728e-03    1.2800000000e+02   -1.3373247826e-03    1.1800000000e+02    1.9896822199e-03    1.3100000000e+02   -1.5446147934e-01    1.1300000000e+02    1.6775625092e-01    1.3500000000e+02   -1.5803738255e-01    1.2800000000e+02    1.6219743247e-01    1.2200000000e+02   -1.5577391711e-01    1.2600000000e+02    1.3852107532e-01    1.5500000000e+02   -5.2470600595e+00    1.0200000000e+02    4.6990742901e+00    1.5200000000e+02   -2.9642313327e-08   -8.3941800724e-13   -3.6307891469e-08    8.8047333110e-13
+    4.7909099349e+01    4.6453855388e-03    4.6453656013e-03    1.9937564245e-08    4.2918647018e-06    4.3156450037e-06    4.6410698938e-03   -6.6077224645e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942490513e-03    1.9800000000e+03   -8.0000000000e+00    2.3468208426e-03    3.9439294696e-06    1.0292660090e-10    4.9086609657e-11    0.0000000000e+00    3.6087198060e-07    1.0691540287e-08   -3.3758285789e-02    1.5600000000e+02    4.1335323199e-02    1.5300000000e+02    1.2667140739e-06    1.4800000000e+02    1.7391486830e-04    1.1700000000e+02   -5.4253927501e-05    1.0600000000e+02    9.3389479326e-05    1.5300000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.6540485783e-03    1.5600000000e+02   -2.7332262396e-03    1.1800000000e+02   -1.2598822272e-03    1.3400000000e+02    1.8006490482e-03    1.2800000000e+02   -1.8027412911e-01    1.3100000000e+02    1.5770029469e-01    1.4300000000e+02   -1.3212500786e-01    1.6000000000e+02    1.5543353081e-01    1.2600000000e+02   -1.5252600201e-01    1.2600000000e+02    1.3599249006e-01    1.4500000000e+02   -4.6706862607e+00    1.3600000000e+02    4.6620437697e+00    1.4600000000e+02   -2.9706373583e-08   -4.3379609616e-13   -3.6370851061e-08    3.7112504787e-13
+    4.8329354606e+01    4.6453975152e-03    4.6453655388e-03    3.1976395536e-08    6.8834066991e-06    3.9922279954e-06    4.6414052872e-03   -6.6139679704e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2943564466e-03    1.9800000000e+03   -8.0000000000e+00    2.3470488407e-03    3.6305202675e-06    9.1706946157e-11    1.0044802788e-10    0.0000000000e+00    3.5285524291e-07    8.6603300783e-09   -3.0097826806e-02    1.1900000000e+02    4.0838433347e-02    1.3400000000e+02    1.4000382275e-05    1.2100000000e+02    1.5330621215e-04    1.6600000000e+02   -2.7934508384e-05    1.1400000000e+02    1.0511886632e-04    1.5200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.9947520832e-03    1.4100000000e+02   -3.0625364491e-03    1.1200000000e+02   -1.1429100979e-03    1.4000000000e+02    1.7451646259e-03    1.1400000000e+02   -1.4874491424e-01    1.4000000000e+02    1.7996000234e-01    1.3700000000e+02   -1.5347337132e-01    8.8000000000e+01    1.5446610189e-01    1.7100000000e+02   -1.5603751594e-01    1.6000000000e+02    1.4709587653e-01    1.1900000000e+02   -4.6001568063e+00    1.1700000000e+02    4.9978615262e+00    8.6000000000e+01   -2.9758313173e-08   -6.9012707985e-13   -3.6381366530e-08    9.3153948150e-14
+    4.8749609863e+01    4.6453964457e-03    4.6453654596e-03    3.0986148081e-08    6.6702408355e-06    3.8402063315e-06    4.6415562394e-03   -6.6218898278e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2944350576e-03    1.9800000000e+03   -8.0000000000e+00    2.3471211818e-03    3.4939297791e-06    6.5841421462e-11    1.0981415371e-10    0.0000000000e+00    3.3995315099e-07    6.1477457520e-09   -2.7650082450e-02    1.4400000000e+02    3.8297657403e-02    1.1700000000e+02   -4.9827418482e-06    1.1400000000e+02    1.2757669498e-04    1.4700000000e+02   -1.8769051468e-05    1.1000000000e+02    1.2839228795e-04    1.2600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.9248522752e-03    1.3800000000e+02   -2.8367137530e-03    9.3000000000e+01   -8.2092522738e-04    1.1000000000e+02    1.4132508119e-03    1.3500000000e+02   -1.5586171798e-01    1.2800000000e+02    2.0080054507e-01    1.4600000000e+02   -1.5157112872e-01    1.3400000000e+02    1.2992506047e-01    1.2800000000e+02   -1.3274946928e-01    1.5400000000e+02    1.5420477581e-01    1.3800000000e+02   -4.7469532655e+00    1.4200000000e+02    4.1451129628e+00    1.4400000000e+02   -2.9811411279e-08   -6.3914084672e-13   -3.6407486999e-08    5.1925111789e-13
+    4.9169865121e+01    4.6454051859e-03    4.6453653170e-03    3.9868862392e-08    8.5823805302e-06    4.6062657111e-06    4.6407989201e-03   -6.6361493695e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2945011452e-03    1.9800000000e+03   -8.0000000000e+00    2.3462977749e-03    4.2725755515e-06    4.3576578097e-11    1.3567856711e-10    0.0000000000e+00    3.2653318212e-07    6.9777224102e-09   -2.8769140517e-02    1.3100000000e+02    3.6011159321e-02    1.3100000000e+02   -5.0279881265e-05    1.3500000000e+02    8.8846105388e-05    1.9000000000e+02   -3.5385636612e-05    1.5500000000e+02    1.0256804018e-04    1.5600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.6994854304e-03    1.4000000000e+02   -2.9595415386e-03    1.2100000000e+02   -1.0312334230e-03    1.2900000000e+02    1.4927969196e-03    1.3400000000e+02   -1.6724915403e-01    1.3200000000e+02    1.5563601905e-01    1.7700000000e+02   -1.7787997924e-01    1.4400000000e+02    1.3299032838e-01    1.2500000000e+02   -1.4252318500e-01    1.1800000000e+02    1.6274784709e-01    1.4300000000e+02   -4.6508022548e+00    1.6300000000e+02    5.2459943262e+00    1.1900000000e+02   -2.9867400738e-08   -3.0746185663e-13   -3.6494092957e-08    1.4646820851e-12
+    4.9590120378e+01    4.6454024499e-03    4.6453651336e-03    3.7316302350e-08    8.0329030611e-06    5.9736560934e-06    4.6394287938e-03   -6.6544926993e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9800000000e+03    8.0000000000e+00    2.2942738911e-03    1.9800000000e+03   -8.0000000000e+00    2.3451549027e-03    5.6595944231e-06    5.0603543896e-11    2.1169835083e-10    0.0000000000e+00    3.0474086913e-07    9.0584993068e-09   -3.1695503508e-02    1.2100000000e+02    3.1538260136e-02    1.3100000000e+02   -6.8938678350e-05    8.0000000000e+01    8.7528847667e-05    1.7900000000e+02   -7.2793759615e-05    1.6500000000e+02    1.1444082154e-04    1.2200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.7718214442e-03    1.4800000000e+02   -3.1771815066e-03    1.0900000000e+02   -1.3343932298e-03    1.2800000000e+02    1.7647348962e-03    1.3100000000e+02   -1.5746919053e-01    1.4400000000e+02    1.7709959283e-01    1.1300000000e+02   -1.7664547486e-01    1.2500000000e+02    1.5676251193e-01    8.3000000000e+01   -1.6098920728e-01    1.1100000000e+02    1.5431764156e-01    1.4000000000e+02   -4.5334190329e+00    1.2900000000e+02    4.9010643386e+00    1.4200000000e+02   -2.9950264571e-08   -1.4634854973e-12   -3.6594662423e-08    5.2452453923e-13
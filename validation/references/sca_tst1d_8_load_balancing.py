@@ -0,0 +1,133 @@
+# 1 time
+# 2 Utot
+# 3 Uexp
+# 4 Ubal_norm
+# 5 Uelm
+# 6 Ukin
+# 7 Ukin_bnd
+# 8 Ukin_inj_mvw
+# 9 Ntot_ion
+# 10 Ukin_ion
+# 11 Ntot_eon
+# 12 Ukin_eon
+#
+#               time                Utot                Uexp           Ubal_norm                Uelm                Ukin            Ukin_bnd        Ukin_inj_mvw            Ntot_ion            Ukin_ion            Ntot_eon            Ukin_eon
+    0.0000000000e+00    2.5374566934e-03    5.0749133867e-03   -1.0000000000e+00    0.0000000000e+00    2.5374566934e-03    0.0000000000e+00    2.5374566934e-03    1.0000000000e+04    1.2976196035e-06    1.0000000000e+04    2.5361590738e-03
+    4.2025525744e-01    2.5374681935e-03    2.5374566788e-03    4.5379109377e-06    5.6228554113e-07    2.5369059080e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.2977020923e-06    1.0000000000e+04    2.5356082059e-03
+    8.4051051489e-01    2.5374850815e-03    2.5374566384e-03    1.1209313272e-05    3.2705627615e-06    2.5342145188e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.2997165919e-06    1.0000000000e+04    2.5329148022e-03
+    1.2607657723e+00    2.5375032628e-03    2.5374565923e-03    1.8392646957e-05    9.1038489701e-06    2.5283994139e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.3108073681e-06    1.0000000000e+04    2.5270886065e-03
+    1.6810210298e+00    2.5375204729e-03    2.5374565374e-03    2.5196664608e-05    1.8427435362e-05    2.5190930375e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.3442725924e-06    1.0000000000e+04    2.5177487649e-03
+    2.1012762872e+00    2.5375275050e-03    2.5374565180e-03    2.7975657583e-05    3.0201803079e-05    2.5073257019e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.4221016678e-06    1.0000000000e+04    2.5059036003e-03
+    2.5215315447e+00    2.5375293654e-03    2.5374565323e-03    2.8703206781e-05    4.3121891000e-05    2.4944074744e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.5728520830e-06    1.0000000000e+04    2.4928346223e-03
+    2.9417868021e+00    2.5375177237e-03    2.5374565389e-03    2.4112671765e-05    5.4833847559e-05    2.4826838762e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.8210132645e-06    1.0000000000e+04    2.4808628629e-03
+    3.3620420595e+00    2.5374978502e-03    2.5374565225e-03    1.6287045765e-05    6.3318772064e-05    2.4741790781e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.1782185669e-06    1.0000000000e+04    2.4720008596e-03
+    3.7822973170e+00    2.5374761037e-03    2.5374565159e-03    7.7194742188e-06    6.7379705725e-05    2.4700963980e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.6439504707e-06    1.0000000000e+04    2.4674524475e-03
+    4.2025525744e+00    2.5374561594e-03    2.5374564946e-03   -1.3210837889e-07    6.7317008887e-05    2.4701391505e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.1932190878e-06    1.0000000000e+04    2.4669459314e-03
+    4.6228078319e+00    2.5374506352e-03    2.5374564984e-03   -2.3106584594e-06    6.4908624875e-05    2.4725420103e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.7859058628e-06    1.0000000000e+04    2.4687561045e-03
+    5.0430630893e+00    2.5374554419e-03    2.5374564807e-03   -4.0935019400e-07    6.2350512826e-05    2.4751049291e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    4.3805969687e-06    1.0000000000e+04    2.4707243322e-03
+    5.4633183468e+00    2.5374615139e-03    2.5374564284e-03    2.0041790453e-06    6.0858687395e-05    2.4766028265e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    4.9555477955e-06    1.0000000000e+04    2.4716472787e-03
+    5.8835736042e+00    2.5374677918e-03    2.5374563606e-03    4.5049832358e-06    6.0414088715e-05    2.4770537031e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    5.5055954894e-06    1.0000000000e+04    2.4715481076e-03
+    6.3038288617e+00    2.5374733278e-03    2.5374563023e-03    6.7096746739e-06    6.1463072307e-05    2.4760102555e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    6.0482686487e-06    1.0000000000e+04    2.4699619869e-03
+    6.7240841191e+00    2.5374748167e-03    2.5374562319e-03    7.3241868951e-06    6.3481906260e-05    2.4739929104e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    6.6140277795e-06    1.0000000000e+04    2.4673788827e-03
+    7.1443393765e+00    2.5374762056e-03    2.5374561374e-03    7.9087826464e-06    6.5665939013e-05    2.4718102666e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    7.2393332831e-06    1.0000000000e+04    2.4645709333e-03
+    7.5645946340e+00    2.5374795070e-03    2.5374560486e-03    9.2448441772e-06    6.8279815067e-05    2.4691996919e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    7.9585427137e-06    1.0000000000e+04    2.4612411492e-03
+    7.9848498914e+00    2.5374829087e-03    2.5374559794e-03    1.0612683580e-05    7.1650731334e-05    2.4658321773e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    8.7954369031e-06    1.0000000000e+04    2.4570367404e-03
+    8.4051051489e+00    2.5374849224e-03    2.5374559301e-03    1.1425711629e-05    7.5631532024e-05    2.4618533903e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.7801935323e-06    1.0000000000e+04    2.4520731968e-03
+    8.8253604063e+00    2.5374851759e-03    2.5374558795e-03    1.1545568675e-05    7.9862614277e-05    2.4576225616e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.0920636447e-05    1.0000000000e+04    2.4467019251e-03
+    9.2456156638e+00    2.5374806668e-03    2.5374558031e-03    9.7986877293e-06    8.3571988146e-05    2.4539086787e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.2198724638e-05    1.0000000000e+04    2.4417099540e-03
+    9.6658709212e+00    2.5374757486e-03    2.5374557435e-03    7.8839124535e-06    8.6583853110e-05    2.4508918955e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.3593060271e-05    1.0000000000e+04    2.4372988352e-03
+    1.0086126179e+01    2.5374687763e-03    2.5374556423e-03    5.1760645725e-06    8.8299779699e-05    2.4491689966e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.5094213928e-05    1.0000000000e+04    2.4340747827e-03
+    1.0506381436e+01    2.5374563268e-03    2.5374555280e-03    3.1479879104e-07    8.7841059558e-05    2.4496152672e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.6668073760e-05    1.0000000000e+04    2.4329471935e-03
+    1.0926636694e+01    2.5374506730e-03    2.5374553945e-03   -1.8607113328e-06    8.5742736578e-05    2.4517079364e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.8260804932e-05    1.0000000000e+04    2.4334471315e-03
+    1.1346891951e+01    2.5374477589e-03    2.5374553054e-03   -2.9740497993e-06    8.2837726317e-05    2.4546100326e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.9834243306e-05    1.0000000000e+04    2.4347757893e-03
+    1.1767147208e+01    2.5374485591e-03    2.5374552378e-03   -2.6320473611e-06    7.9892000384e-05    2.4575565587e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.1385099078e-05    1.0000000000e+04    2.4361714596e-03
+    1.2187402466e+01    2.5374536877e-03    2.5374551802e-03   -5.8820635713e-07    7.7371324497e-05    2.4600823632e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.2917226825e-05    1.0000000000e+04    2.4371651364e-03
+    1.2607657723e+01    2.5374584461e-03    2.5374551242e-03    1.3091395354e-06    7.6098159028e-05    2.4613602870e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.4422724735e-05    1.0000000000e+04    2.4369375623e-03
+    1.3027912981e+01    2.5374561748e-03    2.5374550770e-03    4.3263513807e-07    7.4917820087e-05    2.4625383547e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.5906652424e-05    1.0000000000e+04    2.4366317023e-03
+    1.3448168238e+01    2.5374561858e-03    2.5374550465e-03    4.4903032415e-07    7.3677250698e-05    2.4637789351e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.7373735444e-05    1.0000000000e+04    2.4364051997e-03
+    1.3868423496e+01    2.5374594924e-03    2.5374549932e-03    1.7731446920e-06    7.2528097994e-05    2.4649313945e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    2.8843839902e-05    1.0000000000e+04    2.4360875545e-03
+    1.4288678753e+01    2.5374622720e-03    2.5374549552e-03    2.8835078188e-06    7.2024214581e-05    2.4654380574e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.0354067366e-05    1.0000000000e+04    2.4350839901e-03
+    1.4708934011e+01    2.5374673787e-03    2.5374549340e-03    4.9044209922e-06    7.2486629789e-05    2.4649807489e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.1940855974e-05    1.0000000000e+04    2.4330398930e-03
+    1.5129189268e+01    2.5374683974e-03    2.5374548954e-03    5.3210739595e-06    7.3524639079e-05    2.4639437583e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.3634366137e-05    1.0000000000e+04    2.4303093922e-03
+    1.5549444525e+01    2.5374698121e-03    2.5374548462e-03    5.8979837618e-06    7.4950756898e-05    2.4625190552e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.5438508990e-05    1.0000000000e+04    2.4270805462e-03
+    1.5969699783e+01    2.5374699757e-03    2.5374548154e-03    5.9746134548e-06    7.6492114332e-05    2.4609778614e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.7343581658e-05    1.0000000000e+04    2.4236342797e-03
+    1.6389955040e+01    2.5374712926e-03    2.5374547525e-03    6.5183562516e-06    7.8274434786e-05    2.4591968578e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    3.9344895686e-05    1.0000000000e+04    2.4198519621e-03
+    1.6810210298e+01    2.5374675264e-03    2.5374546755e-03    5.0644802698e-06    7.9666780830e-05    2.4578007456e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    4.1419098176e-05    1.0000000000e+04    2.4163816474e-03
+    1.7230465555e+01    2.5374591619e-03    2.5374545142e-03    1.8316676583e-06    7.9802618267e-05    2.4576565437e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    4.3528736479e-05    1.0000000000e+04    2.4141278072e-03
+    1.7650720813e+01    2.5374517969e-03    2.5374543584e-03   -1.0094644543e-06    7.8178390440e-05    2.4592734065e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    4.5643537150e-05    1.0000000000e+04    2.4136298693e-03
+    1.8070976070e+01    2.5374484878e-03    2.5374541232e-03   -2.2208731608e-06    7.5527566680e-05    2.4619209212e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    4.7752234946e-05    1.0000000000e+04    2.4141686862e-03
+    1.8491231328e+01    2.5374494153e-03    2.5374538528e-03   -1.7488129196e-06    7.2811397501e-05    2.4646380178e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    4.9831396041e-05    1.0000000000e+04    2.4148066217e-03
+    1.8911486585e+01    2.5374537885e-03    2.5374536339e-03    6.0891876270e-08    7.0867735334e-05    2.4665860531e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    5.1854069533e-05    1.0000000000e+04    2.4147319836e-03
+    1.9331741842e+01    2.5374506333e-03    2.5374533687e-03   -1.0779857752e-06    6.9051003626e-05    2.4683996297e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    5.3809889141e-05    1.0000000000e+04    2.4145897406e-03
+    1.9751997100e+01    2.5374452842e-03    2.5374530691e-03   -3.0679626123e-06    6.6151859928e-05    2.4712934243e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    5.5697626373e-05    1.0000000000e+04    2.4155957979e-03
+    2.0172252357e+01    2.5374444759e-03    2.5374529085e-03   -3.3232255396e-06    6.2916618666e-05    2.4745278573e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    5.7536071984e-05    1.0000000000e+04    2.4169917853e-03
+    2.0592507615e+01    2.5374461608e-03    2.5374527645e-03   -2.6024714583e-06    5.9533165114e-05    2.4779129957e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    5.9345869843e-05    1.0000000000e+04    2.4185671258e-03
+    2.1012762872e+01    2.5374495849e-03    2.5374525708e-03   -1.1767082215e-06    5.6866835268e-05    2.4805827497e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    6.1137391170e-05    1.0000000000e+04    2.4194453585e-03
+    2.1433018130e+01    2.5374534355e-03    2.5374523985e-03    4.0866751978e-07    5.5163494331e-05    2.4822899411e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    6.2937013353e-05    1.0000000000e+04    2.4193529278e-03
+    2.1853273387e+01    2.5374553383e-03    2.5374522337e-03    1.2234833721e-06    5.4042942254e-05    2.4834123960e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    6.4776224806e-05    1.0000000000e+04    2.4186361712e-03
+    2.2273528645e+01    2.5374598049e-03    2.5374520944e-03    3.0386971073e-06    5.3561643589e-05    2.4838981613e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    6.6659488893e-05    1.0000000000e+04    2.4172386724e-03
+    2.2693783902e+01    2.5374566902e-03    2.5374519442e-03    1.8703741715e-06    5.3005652784e-05    2.4844510374e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    6.8593979785e-05    1.0000000000e+04    2.4158570576e-03
+    2.3114039159e+01    2.5374570860e-03    2.5374517402e-03    2.1067742436e-06    5.2579025636e-05    2.4848780604e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    7.0580504026e-05    1.0000000000e+04    2.4142975564e-03
+    2.3534294417e+01    2.5374499799e-03    2.5374515196e-03   -6.0679515079e-07    5.1585589165e-05    2.4858643907e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    7.2618369601e-05    1.0000000000e+04    2.4132460211e-03
+    2.3954549674e+01    2.5374446589e-03    2.5374513281e-03   -2.6283221460e-06    4.9230837974e-05    2.4882138209e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    7.4690668867e-05    1.0000000000e+04    2.4135231520e-03
+    2.4374804932e+01    2.5374433575e-03    2.5374511639e-03   -3.0764786909e-06    4.6352758225e-05    2.4910905993e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    7.6760881497e-05    1.0000000000e+04    2.4143297178e-03
+    2.4795060189e+01    2.5374437478e-03    2.5374510513e-03   -2.8782580308e-06    4.3357851959e-05    2.4940858958e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    7.8781988327e-05    1.0000000000e+04    2.4153039075e-03
+    2.5215315447e+01    2.5374444556e-03    2.5374509707e-03   -2.5675539692e-06    4.0565416391e-05    2.4968790392e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    8.0719725808e-05    1.0000000000e+04    2.4161593134e-03
+    2.5635570704e+01    2.5374473011e-03    2.5374508764e-03   -1.4090326086e-06    3.7991187173e-05    2.4994561139e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    8.2557145357e-05    1.0000000000e+04    2.4168989685e-03
+    2.6055825962e+01    2.5374508118e-03    2.5374507574e-03    2.1434593533e-08    3.6339124510e-05    2.5011116873e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    8.4296901010e-05    1.0000000000e+04    2.4168147863e-03
+    2.6476081219e+01    2.5374487152e-03    2.5374506624e-03   -7.6736866863e-07    3.4788775464e-05    2.5026599398e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    8.5944532418e-05    1.0000000000e+04    2.4167154074e-03
+    2.6896336476e+01    2.5374470112e-03    2.5374504727e-03   -1.3641797940e-06    3.2565788820e-05    2.5048812223e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    8.7514862688e-05    1.0000000000e+04    2.4173663596e-03
+    2.7316591734e+01    2.5374459681e-03    2.5374502686e-03   -1.6948021336e-06    3.0389183543e-05    2.5070567845e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    8.9024301262e-05    1.0000000000e+04    2.4180324833e-03
+    2.7736846991e+01    2.5374513166e-03    2.5374501203e-03    4.7145808296e-07    2.8693723534e-05    2.5087575931e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.0497937857e-05    1.0000000000e+04    2.4182596552e-03
+    2.8157102249e+01    2.5374552843e-03    2.5374500320e-03    2.0698921871e-06    2.8072236559e-05    2.5093830477e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.1964796605e-05    1.0000000000e+04    2.4174182511e-03
+    2.8577357506e+01    2.5374564191e-03    2.5374498292e-03    2.5970483218e-06    2.7964178262e-05    2.5094922408e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.3454722469e-05    1.0000000000e+04    2.4160375183e-03
+    2.8997612764e+01    2.5374565793e-03    2.5374495704e-03    2.7621593174e-06    2.8074935059e-05    2.5093816442e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.4990372847e-05    1.0000000000e+04    2.4143912714e-03
+    2.9417868021e+01    2.5374571724e-03    2.5374494163e-03    3.0566511745e-06    2.8423928888e-05    2.5090332436e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.6588281120e-05    1.0000000000e+04    2.4124449624e-03
+    2.9838123278e+01    2.5374534181e-03    2.5374491927e-03    1.6652381717e-06    2.8321704989e-05    2.5091317131e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.8257787219e-05    1.0000000000e+04    2.4108739259e-03
+    3.0258378536e+01    2.5374534478e-03    2.5374490589e-03    1.7296459184e-06    2.8087982830e-05    2.5093654649e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    9.9989379028e-05    1.0000000000e+04    2.4093760859e-03
+    3.0678633793e+01    2.5374552815e-03    2.5374489505e-03    2.4949973639e-06    2.7911686890e-05    2.5095435946e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.0175119844e-04    1.0000000000e+04    2.4077923961e-03
+    3.1098889051e+01    2.5374588682e-03    2.5374488039e-03    3.9662909620e-06    2.8302780340e-05    2.5091560879e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.0352197849e-04    1.0000000000e+04    2.4056341094e-03
+    3.1519144308e+01    2.5374597677e-03    2.5374486148e-03    4.3952909271e-06    2.9155440566e-05    2.5083043271e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.0529286008e-04    1.0000000000e+04    2.4030114671e-03
+    3.1939399566e+01    2.5374569215e-03    2.5374484048e-03    3.3563838321e-06    2.9723613963e-05    2.5077333075e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.0706307624e-04    1.0000000000e+04    2.4006702313e-03
+    3.2359654823e+01    2.5374603474e-03    2.5374481952e-03    4.7891196973e-06    3.0348693195e-05    2.5071116542e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.0883553080e-04    1.0000000000e+04    2.3982761234e-03
+    3.2779910081e+01    2.5374587072e-03    2.5374480263e-03    4.2092766856e-06    3.1159806698e-05    2.5062989005e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.1061557200e-04    1.0000000000e+04    2.3956833285e-03
+    3.3200165338e+01    2.5374572692e-03    2.5374478408e-03    3.7156558323e-06    3.1769575307e-05    2.5056876939e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.1241174301e-04    1.0000000000e+04    2.3932759508e-03
+    3.3620420595e+01    2.5374609330e-03    2.5374476950e-03    5.2169979937e-06    3.2802560672e-05    2.5046583723e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.1422800096e-04    1.0000000000e+04    2.3904303713e-03
+    3.4040675853e+01    2.5374651086e-03    2.5374475498e-03    6.9198537964e-06    3.4490440071e-05    2.5029746685e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.1606977260e-04    1.0000000000e+04    2.3869048959e-03
+    3.4460931110e+01    2.5374655656e-03    2.5374473766e-03    7.1682119066e-06    3.6461842460e-05    2.5010037232e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.1793902532e-04    1.0000000000e+04    2.3830646979e-03
+    3.4881186368e+01    2.5374685737e-03    2.5374471586e-03    8.4395819876e-06    3.9063957706e-05    2.4984046160e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.1984042685e-04    1.0000000000e+04    2.3785641891e-03
+    3.5301441625e+01    2.5374660390e-03    2.5374469578e-03    7.5198122612e-06    4.1503525870e-05    2.4959625131e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.2178866025e-04    1.0000000000e+04    2.3741738528e-03
+    3.5721696883e+01    2.5374629868e-03    2.5374467597e-03    6.3950410640e-06    4.3319164290e-05    2.4941438225e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.2380983479e-04    1.0000000000e+04    2.3703339877e-03
+    3.6141952140e+01    2.5374651000e-03    2.5374465594e-03    7.3067567121e-06    4.5265994582e-05    2.4921991054e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.2592135271e-04    1.0000000000e+04    2.3662777527e-03
+    3.6562207398e+01    2.5374650058e-03    2.5374463747e-03    7.3424425456e-06    4.7299024654e-05    2.4901659811e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.2812732459e-04    1.0000000000e+04    2.3620386565e-03
+    3.6982462655e+01    2.5374662502e-03    2.5374461385e-03    7.9259250554e-06    4.9660744738e-05    2.4878055054e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.3043059452e-04    1.0000000000e+04    2.3573749109e-03
+    3.7402717912e+01    2.5374664203e-03    2.5374459028e-03    8.0858432743e-06    5.1994821164e-05    2.4854715991e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.3282404594e-04    1.0000000000e+04    2.3526475532e-03
+    3.7822973170e+01    2.5374603463e-03    2.5374456779e-03    5.7807638398e-06    5.3901582696e-05    2.4835587636e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.3529321626e-04    1.0000000000e+04    2.3482655474e-03
+    3.8243228427e+01    2.5374553773e-03    2.5374455024e-03    3.8916811014e-06    5.4941476662e-05    2.4825139007e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.3781769187e-04    1.0000000000e+04    2.3446962088e-03
+    3.8663483685e+01    2.5374506589e-03    2.5374453022e-03    2.1110454484e-06    5.4990198921e-05    2.4824604600e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.4037991450e-04    1.0000000000e+04    2.3420805455e-03
+    3.9083738942e+01    2.5374493820e-03    2.5374451297e-03    1.6758142281e-06    5.4324307987e-05    2.4831250741e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.4296189199e-04    1.0000000000e+04    2.3401631821e-03
+    3.9503994200e+01    2.5374495809e-03    2.5374449515e-03    1.8244260136e-06    5.3609751071e-05    2.4838398299e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.4553948428e-04    1.0000000000e+04    2.3383003456e-03
+    3.9924249457e+01    2.5374503323e-03    2.5374447722e-03    2.1911870910e-06    5.2801201945e-05    2.4846491303e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.4809648614e-04    1.0000000000e+04    2.3365526442e-03
+    4.0344504715e+01    2.5374495573e-03    2.5374445945e-03    1.9558128273e-06    5.2136013070e-05    2.4853135443e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.5062421408e-04    1.0000000000e+04    2.3346893302e-03
+    4.0764759972e+01    2.5374479800e-03    2.5374443873e-03    1.4158738863e-06    5.1315158661e-05    2.4861328213e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.5311798652e-04    1.0000000000e+04    2.3330148348e-03
+    4.1185015229e+01    2.5374439757e-03    2.5374442038e-03   -8.9864315992e-08    4.9914181935e-05    2.4875297938e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.5556919365e-04    1.0000000000e+04    2.3319606001e-03
+    4.1605270487e+01    2.5374409208e-03    2.5374439880e-03   -1.2087384057e-06    4.7958888510e-05    2.4894820323e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.5797342245e-04    1.0000000000e+04    2.3315086099e-03
+    4.2025525744e+01    2.5374433715e-03    2.5374438139e-03   -1.7432042747e-07    4.6160263738e-05    2.4912831078e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.6032633300e-04    1.0000000000e+04    2.3309567748e-03
+    4.2445781002e+01    2.5374447333e-03    2.5374436829e-03    4.1396472847e-07    4.4554211507e-05    2.4928905218e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.6263211220e-04    1.0000000000e+04    2.3302584096e-03
+    4.2866036259e+01    2.5374457292e-03    2.5374435789e-03    8.4740367574e-07    4.3349084655e-05    2.4940966445e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.6488917857e-04    1.0000000000e+04    2.3292074659e-03
+    4.3286291517e+01    2.5374452315e-03    2.5374434923e-03    6.8541172995e-07    4.2220976351e-05    2.4952242551e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.6709959768e-04    1.0000000000e+04    2.3281246575e-03
+    4.3706546774e+01    2.5374455926e-03    2.5374433984e-03    8.6473079288e-07    4.1126394941e-05    2.4963191977e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.6926149936e-04    1.0000000000e+04    2.3270576983e-03
+    4.4126802032e+01    2.5374442481e-03    2.5374433387e-03    3.5839179469e-07    3.9913358651e-05    2.4975308895e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.7137489377e-04    1.0000000000e+04    2.3261559957e-03
+    4.4547057289e+01    2.5374445775e-03    2.5374432647e-03    5.1736053211e-07    3.8437428029e-05    2.4990071495e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.7344617436e-04    1.0000000000e+04    2.3255609751e-03
+    4.4967312546e+01    2.5374437590e-03    2.5374431761e-03    2.2971999293e-07    3.6997382850e-05    2.5004463761e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.7548059029e-04    1.0000000000e+04    2.3249657859e-03
+    4.5387567804e+01    2.5374452774e-03    2.5374430911e-03    8.6163311421e-07    3.5589803491e-05    2.5018554739e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.7748470633e-04    1.0000000000e+04    2.3243707676e-03
+    4.5807823061e+01    2.5374462535e-03    2.5374430623e-03    1.2576186821e-06    3.4458287873e-05    2.5029879656e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.7946604588e-04    1.0000000000e+04    2.3235219197e-03
+    4.6228078319e+01    2.5374478120e-03    2.5374429984e-03    1.8970327450e-06    3.3709645921e-05    2.5037381661e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.8143675773e-04    1.0000000000e+04    2.3223014084e-03
+    4.6648333576e+01    2.5374495338e-03    2.5374429388e-03    2.5990524909e-06    3.3120954108e-05    2.5043285797e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.8340610792e-04    1.0000000000e+04    2.3209224718e-03
+    4.7068588834e+01    2.5374510121e-03    2.5374428638e-03    3.2111996648e-06    3.3147284429e-05    2.5043037277e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.8538829666e-04    1.0000000000e+04    2.3189154310e-03
+    4.7488844091e+01    2.5374498359e-03    2.5374427795e-03    2.7808930520e-06    3.3113699570e-05    2.5043361363e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.8739689879e-04    1.0000000000e+04    2.3169392375e-03
+    4.7909099349e+01    2.5374495368e-03    2.5374427092e-03    2.6907176652e-06    3.3090354007e-05    2.5043591828e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.8943588911e-04    1.0000000000e+04    2.3149232937e-03
+    4.8329354606e+01    2.5374487345e-03    2.5374426100e-03    2.4136302504e-06    3.2868483074e-05    2.5045802514e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.9150312194e-04    1.0000000000e+04    2.3130771295e-03
+    4.8749609863e+01    2.5374485437e-03    2.5374425322e-03    2.3691294785e-06    3.2552073726e-05    2.5048964700e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.9359197125e-04    1.0000000000e+04    2.3113044987e-03
+    4.9169865121e+01    2.5374480836e-03    2.5374424313e-03    2.2275413177e-06    3.2157986362e-05    2.5052900973e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.9569686816e-04    1.0000000000e+04    2.3095932291e-03
+    4.9590120378e+01    2.5374475533e-03    2.5374422862e-03    2.0757463968e-06    3.1591294024e-05    2.5058562593e-03    0.0000000000e+00    0.0000000000e+00    1.0000000000e+04    1.9780545456e-04    1.0000000000e+04    2.3080508047e-03
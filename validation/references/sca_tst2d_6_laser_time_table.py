@@ -0,0 +1,91 @@
+# 1 time
+# 2 Utot
+# 3 Uexp
+# 4 Ubal
+# 5 Ubal_norm
+# 6 Uelm
+# 7 Ukin
+# 8 Uelm_bnd
+# 9 Ukin_bnd
+# 10 Uelm_inj_mvw
+# 11 Uelm_out_mvw
+# 12 Ukin_inj_mvw
+# 13 Ukin_out_mvw
+# 14 Uelm_Ex
+# 15 Uelm_Ey
+# 16 Uelm_Ez
+# 17 Uelm_Bx_m
+# 18 Uelm_By_m
+# 19 Uelm_Bz_m
+# 20 ExMin
+# 21 ExMinCell
+# 22 ExMax
+# 23 ExMaxCell
+# 24 EyMin
+# 25 EyMinCell
+# 26 EyMax
+# 27 EyMaxCell
+# 28 EzMin
+# 29 EzMinCell
+# 30 EzMax
+# 31 EzMaxCell
+# 32 Bx_mMin
+# 33 Bx_mMinCell
+# 34 Bx_mMax
+# 35 Bx_mMaxCell
+# 36 By_mMin
+# 37 By_mMinCell
+# 38 By_mMax
+# 39 By_mMaxCell
+# 40 Bz_mMin
+# 41 Bz_mMinCell
+# 42 Bz_mMax
+# 43 Bz_mMaxCell
+# 44 JxMin
+# 45 JxMinCell
+# 46 JxMax
+# 47 JxMaxCell
+# 48 JyMin
+# 49 JyMinCell
+# 50 JyMax
+# 51 JyMaxCell
+# 52 JzMin
+# 53 JzMinCell
+# 54 JzMax
+# 55 JzMaxCell
+# 56 RhoMin
+# 57 RhoMinCell
+# 58 RhoMax
+# 59 RhoMaxCell
+# 60 PoyEast
+# 61 PoyEastInst
+# 62 PoySouth
+# 63 PoySouthInst
+# 64 PoyWest
+# 65 PoyWestInst
+# 66 PoyNorth
+# 67 PoyNorthInst
+#
+#               time                Utot                Uexp                Ubal           Ubal_norm                Uelm                Ukin            Uelm_bnd            Ukin_bnd        Uelm_inj_mvw        Uelm_out_mvw        Ukin_inj_mvw        Ukin_out_mvw             Uelm_Ex             Uelm_Ey             Uelm_Ez           Uelm_Bx_m           Uelm_By_m           Uelm_Bz_m               ExMin           ExMinCell               ExMax           ExMaxCell               EyMin           EyMinCell               EyMax           EyMaxCell               EzMin           EzMinCell               EzMax           EzMaxCell             Bx_mMin         Bx_mMinCell             Bx_mMax         Bx_mMaxCell             By_mMin         By_mMinCell             By_mMax         By_mMaxCell             Bz_mMin         Bz_mMinCell             Bz_mMax         Bz_mMaxCell               JxMin           JxMinCell               JxMax           JxMaxCell               JyMin           JyMinCell               JyMax           JyMaxCell               JzMin           JzMinCell               JzMax           JzMaxCell              RhoMin          RhoMinCell              RhoMax          RhoMaxCell             PoyEast         PoyEastInst            PoySouth        PoySouthInst             PoyWest         PoyWestInst            PoyNorth        PoyNorthInst
+    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    6.2831853072e+00    1.5719780411e+00    1.3331039799e+00    2.3887406112e-01    0.0000000000e+00    1.5719780411e+00    0.0000000000e+00    1.3331039799e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    9.3208851395e-02    6.4034558256e-01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    8.3842360711e-01   -1.8913539274e-01    5.7300000000e+02    1.8985383147e-01    7.2300000000e+02   -5.4906437960e-01    6.9300000000e+02    5.6987145638e-01    5.1700000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.4036790991e-01    7.3000000000e+02    6.2478924152e-01    4.6800000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.3333680525e+00    4.7036622831e-03   -2.6407253758e-04    9.8807684271e-58    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    1.2566370614e+01    1.1805124729e+01    1.0803227632e+01    1.0018970966e+00    0.0000000000e+00    1.1805124729e+01    0.0000000000e+00    1.0803227632e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    5.6016320639e-01    5.1401207153e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    6.1048408068e+00   -4.3878466361e-01    7.4200000000e+02    4.5914840690e-01    1.7120000000e+03   -1.3472336512e+00    2.5950000000e+03    1.3932315537e+00    8.6600000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.5199330921e+00    2.6650000000e+03    1.4224550517e+00    9.3200000000e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.0804481237e+01    2.2507227470e-02   -1.2536049250e-03   -2.8680988254e-19    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    1.8849555922e+01    4.6431155468e+01    4.4026977731e+01    2.4041777369e+00    0.0000000000e+00    4.6431155468e+01    0.0000000000e+00    4.4026977731e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1551887764e+00    2.0557521733e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.3718444958e+01   -7.8175412314e-01    1.3740000000e+03    8.2052272542e-01    4.3610000000e+03   -2.4541132753e+00    5.5590000000e+03    2.5591879936e+00    1.3040000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -2.7238984844e+00    5.7850000000e+03    2.5550633550e+00    1.3710000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.4030448443e+01    6.2717060232e-02   -3.4707127744e-03    1.2732569804e-08    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00
+    2.5132741229e+01    1.2011759238e+02    1.1670992453e+02    3.4076678521e+00    0.0000000000e+00    1.2011759238e+02    0.0000000000e+00    1.1670992453e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    5.5247673930e+00    5.3703572053e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    6.0889252937e+01   -1.3227831139e+00    1.7920000000e+03    1.2875696519e+00    7.4820000000e+03   -4.0628974619e+00    9.0840000000e+03    4.1964225168e+00    1.5360000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.2352361026e+00    7.4800000000e+03    4.3707204093e+00    2.0920000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.1671652698e+02    1.1540833039e-01   -6.6024458266e-03   -3.2896414600e-07  -5.4152639464e-152   2.2577349767e-153   -1.0819667129e-09    0.0000000000e+00
+    3.1415926536e+01    2.2768081651e+02    2.2534797089e+02    2.3328456203e+00    0.0000000000e+00    2.2768081651e+02    0.0000000000e+00    2.2534797089e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.0379753009e+01    1.0263787205e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.1466319145e+02   -1.8211494557e+00    2.1600000000e+03    1.7295779566e+00    8.5750000000e+03   -5.4882111856e+00    9.7040000000e+03    5.6745411124e+00    2.0770000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -5.6721982487e+00    1.0670000000e+04    6.0730681628e+00    2.3730000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.2535796538e+02    1.4877009983e-01   -9.9935314093e-03    1.4990058578e-06  -1.7474570193e-102   7.0027993485e-104   -9.6498211894e-07    4.7800379210e-34
+    3.7699111843e+01    3.4002774436e+02    3.4137732967e+02   -1.3495853132e+00    0.0000000000e+00    3.4002774436e+02    0.0000000000e+00    3.4137732967e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.5386110305e+01    1.5428485814e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.7035677591e+02   -2.3089828543e+00    4.0190000000e+03    2.2494367653e+00    1.0285000000e+04   -7.0487258879e+00    1.0558000000e+04    7.2000241788e+00    4.7290000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.4220620924e+00    1.0863000000e+04    7.6906527304e+00    4.3300000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.4139021307e+02    1.3777638560e-01   -1.2863425540e-02   -1.2865860468e-07   -3.6534679556e-69    1.3704875860e-70   -1.9974426272e-05    1.5128658315e-13
+    4.3982297150e+01    4.2438308105e+02    4.3051748259e+02   -6.1344015438e+00    0.0000000000e+00    4.2438308105e+02    0.0000000000e+00    4.3051748259e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9101186038e+01    1.9345173789e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1183015711e+02   -2.8019261042e+00    6.1440000000e+03    2.8336996178e+00    1.1089000000e+04   -8.8888787218e+00    1.1193000000e+04    8.6750903909e+00    6.5670000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.3482000743e+00    1.1270000000e+04    9.2542091865e+00    6.8180000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.3053242763e+02    9.0566381990e-02   -1.4809111654e-02    9.2803841149e-07   -9.4180964063e-45    3.2294136307e-46   -1.3592895881e-04    2.8906567833e-08
+    5.0265482457e+01    4.6849148881e+02    4.7836243056e+02   -9.8709417523e+00    0.0000000000e+00    4.6849148881e+02    0.0000000000e+00    4.7836243056e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1012782198e+01    2.1418249839e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.3329620822e+02   -3.1687183607e+00    8.4830000000e+03    3.2577799442e+00    1.0513000000e+04   -1.0333803585e+01    1.0908000000e+04    9.9236632884e+00    9.0080000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0819638580e+01    1.1176000000e+04    1.0475170068e+01    8.3720000000e+03    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.7837907953e+02    3.9755938951e-02   -1.6119612209e-02   -4.4220822553e-07   -1.1846059883e-26    3.6020480609e-28   -5.2935215438e-04    5.4653336467e-07
+    5.6548667765e+01    4.8340193376e+02    4.9507785132e+02   -1.1675917554e+01    0.0000000000e+00    4.8340193376e+02    0.0000000000e+00    4.9507785132e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1643064513e+01    2.2130636935e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4045249990e+02   -3.5109768634e+00    1.0401000000e+04    3.5378615614e+00    1.2414000000e+04   -1.1251448762e+01    1.2538000000e+04    1.1072401292e+01    1.0669000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1812274846e+01    1.2655000000e+04    1.1652537830e+01    1.1081000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9509638566e+02    1.0001005287e-02   -1.7056977773e-02   -2.7773898023e-06   -9.1448883966e-14    2.3244834245e-15   -1.4773698061e-03    2.2374878231e-06
+    6.2831853072e+01    4.8627624401e+02    4.9844427834e+02   -1.2168034323e+01    0.0000000000e+00    4.8627624401e+02    0.0000000000e+00    4.9844427834e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1760649055e+01    2.2270767189e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4180792307e+02   -3.6978802250e+00    1.2943000000e+04    3.6784156190e+00    1.3190000000e+04   -1.1625475368e+01    1.4067000000e+04    1.1829080456e+01    1.3040000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.2284263720e+01    1.4218000000e+04    1.2209853813e+01    1.3421000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9846537795e+02    1.0929348008e-03   -1.7767371061e-02   -2.3337285633e-07   -4.7121150958e-06    7.2148132017e-08   -3.3275331672e-03    4.9721015397e-06
+    6.9115038379e+01    4.8653093801e+02    4.9876085153e+02   -1.2229913519e+01    0.0000000000e+00    4.8653093801e+02    0.0000000000e+00    4.9876085153e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1770614055e+01    2.2283459068e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4192573328e+02   -3.7420202922e+00    1.4845000000e+04    3.6846585213e+00    1.5119000000e+04   -1.1672338709e+01    1.6249000000e+04    1.2071144878e+01    1.5209000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.2251064858e+01    1.5750000000e+04    1.2389733164e+01    1.5338000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9879541707e+02    8.2483416950e-05   -1.8343164285e-02   -1.6508173566e-06   -9.6729289166e-03    5.5542646429e-05   -6.5494501166e-03    8.7260409163e-06
+    7.5398223686e+01    4.8547098637e+02    4.9770566684e+02   -1.2234680474e+01    0.0000000000e+00    4.8547098637e+02    0.0000000000e+00    4.9770566684e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1731611719e+01    2.2229491158e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.4144446307e+02   -3.5738496258e+00    1.7015000000e+04    3.5536146779e+00    1.7321000000e+04   -1.1362668905e+01    1.7916000000e+04    1.1555293088e+01    1.7653000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.1780210018e+01    1.8081000000e+04    1.1874424000e+01    1.7803000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880818808e+02    6.7277367405e-07   -1.8670197407e-02   -1.1113252198e-06   -1.0719715021e+00    4.5292249538e-03   -1.1879539100e-02    1.2932704722e-05
+    8.1681408993e+01    4.7628794885e+02    4.8926015367e+02   -1.2972204819e+01    0.0000000000e+00    4.7628794885e+02    0.0000000000e+00    4.8926015367e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.1334300741e+01    2.1789770260e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.3705594551e+02   -3.2931587246e+00    1.9353000000e+04    3.3413628680e+00    1.8917000000e+04   -1.0656385966e+01    1.9219000000e+04    1.0497683331e+01    1.9449000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.0936786705e+01    1.9385000000e+04    1.0976471539e+01    1.9870000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880833418e+02   -8.5739096612e-09   -1.8799175670e-02   -7.4619170907e-07   -9.5088628992e+00    1.9705162934e-02   -2.0518435732e-02    1.6565167348e-05
+    8.7964594301e+01    4.4488884758e+02    4.6130953331e+02   -1.6420685729e+01    0.0000000000e+00    4.4488884758e+02    0.0000000000e+00    4.6130953331e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9997209580e+01    2.0303948871e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    2.2185214929e+02   -2.9039549758e+00    2.1624000000e+04    2.9061156216e+00    2.0931000000e+04   -9.3987378517e+00    2.1904000000e+04    9.2617407846e+00    2.2148000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -9.6265060851e+00    2.2423000000e+04    9.6435094057e+00    2.1797000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880832824e+02   -7.2206214732e-09   -1.8869305767e-02   -3.4529170071e-07   -3.7445538118e+01    5.3934710092e-02   -3.4387505238e-02    1.8155986852e-05
+    9.4247779608e+01    3.7480583034e+02    4.0034595436e+02   -2.5540124017e+01    0.0000000000e+00    3.7480583034e+02    0.0000000000e+00    4.0034595436e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.6912391907e+01    1.7037394608e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.8751949236e+02   -2.3923104117e+00    2.2763000000e+04    2.3833249644e+00    2.2884000000e+04   -7.7268650759e+00    2.3456000000e+04    7.7300584201e+00    2.3297000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -7.9360604084e+00    2.3815000000e+04    7.9350243155e+00    2.3557000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880832344e+02   -4.6920655143e-09   -1.8898387422e-02   -6.8905425184e-08   -9.8387160091e+01    9.6980548571e-02   -5.6310604521e-02    2.0187146676e-05
+    1.0053096491e+02    2.6966398578e+02    3.1064369937e+02   -4.0979713591e+01    0.0000000000e+00    2.6966398578e+02    0.0000000000e+00    3.1064369937e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.2252738994e+01    1.2185478628e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.3555646050e+02   -1.9167893036e+00    2.4577000000e+04    1.9232194644e+00    2.4589000000e+04   -6.1704193419e+00    2.4047000000e+04    6.1909619651e+00    2.4816000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -6.3294684392e+00    2.5542000000e+04    6.2948124510e+00    2.5610000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880831999e+02   -5.3890506263e-09   -1.8907769441e-02   -9.2772094150e-08   -1.8805681382e+02    1.2424052133e-01   -8.8899023082e-02    1.3544996915e-05
+    1.0681415022e+02    1.5614424681e+02    2.1570154792e+02   -5.9557301109e+01    0.0000000000e+00    1.5614424681e+02    0.0000000000e+00    2.1570154792e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.1450641844e+00    7.0029057755e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    7.8970124867e+01   -1.4379640793e+00    2.5100000000e+04    1.4509475050e+00    2.4307000000e+04   -4.6002048114e+00    2.4710000000e+04    4.5976990599e+00    2.5472000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -4.7993725446e+00    2.5298000000e+04    4.7338820556e+00    2.5766000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880831744e+02   -5.5631639494e-09   -1.8910218461e-02   -1.1238296825e-09   -2.8295663796e+02    1.1254566046e-01   -1.3122134504e-01    4.3602291983e-06
+    1.1309733553e+02    6.8205101763e+01    1.4356511801e+02   -7.5360016248e+01    0.0000000000e+00    6.8205101763e+01    0.0000000000e+00    1.4356511801e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.1474528366e+00    3.0281018195e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    3.4776630731e+01   -9.6608943350e-01    2.4900000000e+04    9.7644650784e-01    2.4211000000e+04   -2.9871985777e+00    2.3925000000e+04    2.9626271012e+00    2.4886000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -3.1774539917e+00    2.5902000000e+04    3.1493015678e+00    2.6573000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880831572e+02   -3.3855020571e-09   -1.8911740717e-02   -1.4026277824e-09   -3.5504832376e+02    7.2476908342e-02   -1.7596221012e-01    3.7204140689e-07
+    1.1938052084e+02    2.0592247750e+01    1.0546275106e+02   -8.4870503311e+01    0.0000000000e+00    2.0592247750e+01    0.0000000000e+00    1.0546275106e+02    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    9.6074159009e-01    9.0158526325e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.0615653527e+01   -5.6808261502e-01    2.4459000000e+04    5.7637171169e-01    2.4047000000e+04   -1.6083968425e+00    2.4133000000e+04    1.7241720431e+00    2.4567000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -1.8637949725e+00    2.3536000000e+04    1.8609547514e+00    2.4510000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880831457e+02   -2.5963727260e-09   -1.8913034974e-02   -7.6344825522e-10   -3.9311428451e+02    3.0861187306e-02   -2.1236596403e-01   -7.5291562745e-06
+    1.2566370614e+02    3.7714369943e+00    9.2417399228e+01   -8.8645962234e+01    0.0000000000e+00    3.7714369943e+00    0.0000000000e+00    9.2417399228e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.7708011667e-01    1.6170545760e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9773023015e+00   -2.8021535588e-01    2.1224000000e+04    2.7032161446e-01    2.2733000000e+04   -7.4119262944e-01    2.2054000000e+04    8.4002257984e-01    2.2544000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.7995959387e-01    2.3069000000e+04    9.2135860575e-01    2.2436000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880831388e+02   -1.1057152231e-09   -1.8914160494e-02   -7.4284686333e-10   -4.0613775248e+02    7.5630583435e-03   -2.3424801543e-01   -6.8381287390e-06
+    1.2566370614e+02    3.7714369943e+00    9.2216435397e+01   -8.8444998403e+01    0.0000000000e+00    3.7714369943e+00    0.0000000000e+00    9.2216435397e+01    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.7708011667e-01    1.6170545760e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    1.9773023015e+00   -2.8021535588e-01    2.1224000000e+04    2.7032161446e-01    2.2733000000e+04   -7.4119262944e-01    2.2054000000e+04    8.4002257984e-01    2.2544000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00   -8.7995959387e-01    2.3069000000e+04    9.2135860575e-01    2.2436000000e+04    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    0.0000000000e+00    4.9880831386e+02   -1.1057152231e-09   -1.8914202880e-02   -7.4284686333e-10   -4.0633830670e+02    7.5630583435e-03   -2.3465755746e-01   -6.8381287390e-06